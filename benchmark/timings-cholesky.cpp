@@ -1,5 +1,5 @@
 //
-// Copyright (c) 2018-2025 CNRS
+// Copyright (c) 2018-2026 CNRS
 //
 
 #include "model-fixture.hpp"
@@ -7,9 +7,16 @@
 #include "pinocchio/spatial.hpp"
 #include "pinocchio/multibody.hpp"
 
+#include "pinocchio/constraints.hpp"
 #include "pinocchio/algorithm/crba.hpp"
 #include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/jacobian.hpp"
 #include "pinocchio/algorithm/cholesky.hpp"
+#include "pinocchio/algorithm/constraint-cholesky.hpp"
+
+#ifdef _OPENMP
+  #include "pinocchio/algorithm/parallel/constraint-cholesky.hpp"
+#endif
 
 struct CholeskyFixture : ModelFixture
 {
@@ -40,11 +47,59 @@ struct CholeskyFixture : ModelFixture
   }
 };
 
+/// ConstraintCholeskyFixture adds a 3D contact on each joint of the model, leading to a large
+/// constraint system.
+struct ConstraintCholeskyFixture : ModelFixture
+{
+  void SetUp(benchmark::State & st)
+  {
+    ModelFixture::SetUp(st);
+
+    constraint_models.clear();
+    constraint_datas.clear();
+    for (pinocchio::JointIndex joint_id = 1; joint_id < (pinocchio::JointIndex)model.njoints;
+         ++joint_id)
+    {
+      const pinocchio::RigidConstraintModel cmodel(
+        pinocchio::CONTACT_3D, model, joint_id, pinocchio::LOCAL);
+      constraint_models.push_back(cmodel);
+      constraint_datas.push_back(pinocchio::RigidConstraintData(cmodel));
+    }
+
+    pinocchio::computeJointJacobians(model, data, q);
+    pinocchio::crba(model, data, q, pinocchio::Convention::WORLD);
+    pinocchio::calc(model, data, constraint_models, constraint_datas);
+
+    constraint_chol = pinocchio::ConstraintCholeskyDecomposition(
+      model, data, constraint_models, constraint_datas);
+    constraint_chol.updateDamping(1e-6);
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    ModelFixture::TearDown(st);
+  }
+
+  std::vector<pinocchio::RigidConstraintModel> constraint_models;
+  std::vector<pinocchio::RigidConstraintData> constraint_datas;
+  pinocchio::ConstraintCholeskyDecomposition constraint_chol;
+};
+
 static void CustomArguments(benchmark::internal::Benchmark * b)
 {
   b->MinWarmUpTime(3.);
 }
 
+#ifdef _OPENMP
+static void MultiThreadCustomArguments(benchmark::internal::Benchmark * b)
+{
+  b->MinWarmUpTime(3.)
+    ->ArgsProduct({benchmark::CreateRange(1, omp_get_max_threads(), 2)})
+    ->ArgNames({"NUM_THREADS"})
+    ->UseRealTime();
+}
+#endif
+
 // choleskyDecompose
 
 PINOCCHIO_DONT_INLINE static void
@@ -216,4 +271,70 @@ BENCHMARK_DEFINE_F(ModelFixture, COMPUTE_M_INVERSE_Q)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(ModelFixture, COMPUTE_M_INVERSE_Q)->Apply(CustomArguments);
 
+// CONSTRAINT_CHOLESKY_COMPUTE
+
+PINOCCHIO_DONT_INLINE static void constraintCholeskyComputeCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const std::vector<pinocchio::RigidConstraintModel> & constraint_models,
+  const std::vector<pinocchio::RigidConstraintData> & constraint_datas,
+  pinocchio::ConstraintCholeskyDecomposition & constraint_chol)
+{
+  constraint_chol.compute(model, data, constraint_models, constraint_datas);
+}
+BENCHMARK_DEFINE_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE)(benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    constraintCholeskyComputeCall(
+      model, data, constraint_models, constraint_datas, constraint_chol);
+  }
+}
+BENCHMARK_REGISTER_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE)
+  ->Apply(CustomArguments);
+
+#ifdef _OPENMP
+// CONSTRAINT_CHOLESKY_COMPUTE_IN_PARALLEL
+
+template<typename Executor>
+PINOCCHIO_DONT_INLINE static void constraintCholeskyComputeInParallelCall(
+  pinocchio::ExecutorBase<Executor> & executor,
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const std::vector<pinocchio::RigidConstraintModel> & constraint_models,
+  const std::vector<pinocchio::RigidConstraintData> & constraint_datas,
+  pinocchio::ConstraintCholeskyDecomposition & constraint_chol)
+{
+  pinocchio::computeConstraintCholeskyInParallel(
+    executor, model, data, constraint_models, constraint_datas, constraint_chol);
+}
+BENCHMARK_DEFINE_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE_IN_PARALLEL)(
+  benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(0);
+  pinocchio::OpenMPExecutor executor(static_cast<size_t>(NUM_THREADS));
+  for (auto _ : st)
+  {
+    constraintCholeskyComputeInParallelCall(
+      executor, model, data, constraint_models, constraint_datas, constraint_chol);
+  }
+}
+BENCHMARK_REGISTER_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE_IN_PARALLEL)
+  ->Apply(MultiThreadCustomArguments);
+
+BENCHMARK_DEFINE_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE_IN_PARALLEL_THREAD_POOL)(
+  benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(0);
+  pinocchio::ThreadPoolExecutor executor(static_cast<size_t>(NUM_THREADS));
+  for (auto _ : st)
+  {
+    constraintCholeskyComputeInParallelCall(
+      executor, model, data, constraint_models, constraint_datas, constraint_chol);
+  }
+}
+BENCHMARK_REGISTER_F(ConstraintCholeskyFixture, CONSTRAINT_CHOLESKY_COMPUTE_IN_PARALLEL_THREAD_POOL)
+  ->Apply(MultiThreadCustomArguments);
+#endif
+
 PINOCCHIO_BENCHMARK_MAIN_WITH_SETUP(CholeskyFixture::GlobalSetUp);
@@ -319,4 +319,116 @@ BENCHMARK_DEFINE_F(DelassusFixture, COMPUTE_DAMPED_DELASSUS_MATRIX_INVERSE_NO_SC
 BENCHMARK_REGISTER_F(DelassusFixture, COMPUTE_DAMPED_DELASSUS_MATRIX_INVERSE_NO_SCALE_NO_PV)
   ->Apply(CustomArguments);
 
+/// Scene made of several free-floating arms, each of them having a 3D contact on its base and a
+/// 6D contact on its end effector. The Delassus matrix is block diagonal, one block per arm.
+struct MultiRobotDelassusFixture : benchmark::Fixture
+{
+  void SetUp(benchmark::State & st)
+  {
+    const std::size_t num_robots = static_cast<std::size_t>(st.range(0));
+    const std::size_t num_arm_joints = 6;
+    const pinocchio::Inertia link_inertia = pinocchio::Inertia::FromBox(1., 0.1, 0.1, 0.5);
+    const pinocchio::SE3 link_placement(
+      pinocchio::SE3::Matrix3::Identity(), pinocchio::SE3::Vector3(0., 0., 0.5));
+
+    model = pinocchio::Model();
+    contact_models.clear();
+    contact_data.clear();
+    for (std::size_t r = 0; r < num_robots; ++r)
+    {
+      const std::string prefix = "robot_" + std::to_string(r) + "_";
+      pinocchio::JointIndex joint_id = model.addJoint(
+        0, pinocchio::JointModelFreeFlyer(), pinocchio::SE3::Identity(), prefix + "root_joint");
+      model.appendBodyToJoint(joint_id, link_inertia);
+      contact_models.push_back(
+        pinocchio::RigidConstraintModel(pinocchio::CONTACT_3D, model, joint_id, pinocchio::LOCAL));
+
+      for (std::size_t j = 0; j < num_arm_joints; ++j)
+      {
+        joint_id = model.addJoint(
+          joint_id, pinocchio::JointModelRY(), link_placement,
+          prefix + "joint_" + std::to_string(j));
+        model.appendBodyToJoint(joint_id, link_inertia);
+      }
+      contact_models.push_back(
+        pinocchio::RigidConstraintModel(pinocchio::CONTACT_6D, model, joint_id, pinocchio::LOCAL));
+    }
+    for (const pinocchio::RigidConstraintModel & cmodel : contact_models)
+      contact_data.push_back(pinocchio::RigidConstraintData(cmodel));
+
+    data = pinocchio::Data(model);
+    const Eigen::VectorXd qmax(Eigen::VectorXd::Ones(model.nq));
+    q = randomConfiguration(model, -qmax, qmax);
+
+    const Eigen::Index constraint_size = getTotalConstraintResidualSize(contact_models);
+    delassus_dense.resize(constraint_size, constraint_size);
+  }
+
+  void TearDown(benchmark::State &)
+  {
+  }
+
+  pinocchio::Model model;
+  pinocchio::Data data;
+  Eigen::VectorXd q;
+
+  std::vector<pinocchio::RigidConstraintModel> contact_models;
+  std::vector<pinocchio::RigidConstraintData> contact_data;
+
+  Eigen::MatrixXd delassus_dense;
+  Eigen::SparseMatrix<double> delassus_sparse;
+};
+
+static void MultiRobotArguments(benchmark::internal::Benchmark * b)
+{
+  b->MinWarmUpTime(3.)->ArgName("num_robots")->Arg(2)->Arg(8)->Arg(32);
+}
+
+// COMPUTE_DELASSUS_MATRIX
+
+PINOCCHIO_DONT_INLINE static void computeDelassusMatrixCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const Eigen::VectorXd & q,
+  const std::vector<pinocchio::RigidConstraintModel> & contact_models,
+  std::vector<pinocchio::RigidConstraintData> & contact_data,
+  Eigen::MatrixXd & delassus)
+{
+  pinocchio::computeDelassusMatrix(model, data, q, contact_models, contact_data, delassus);
+}
+
+BENCHMARK_DEFINE_F(MultiRobotDelassusFixture, COMPUTE_DELASSUS_MATRIX)(benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    computeDelassusMatrixCall(model, data, q, contact_models, contact_data, delassus_dense);
+  }
+}
+BENCHMARK_REGISTER_F(MultiRobotDelassusFixture, COMPUTE_DELASSUS_MATRIX)
+  ->Apply(MultiRobotArguments);
+
+// COMPUTE_SPARSE_DELASSUS_MATRIX
+
+PINOCCHIO_DONT_INLINE static void computeSparseDelassusMatrixCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const Eigen::VectorXd & q,
+  const std::vector<pinocchio::RigidConstraintModel> & contact_models,
+  std::vector<pinocchio::RigidConstraintData> & contact_data,
+  Eigen::SparseMatrix<double> & delassus)
+{
+  pinocchio::computeSparseDelassusMatrix(model, data, q, contact_models, contact_data, delassus);
+}
+
+BENCHMARK_DEFINE_F(MultiRobotDelassusFixture, COMPUTE_SPARSE_DELASSUS_MATRIX)(
+  benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    computeSparseDelassusMatrixCall(model, data, q, contact_models, contact_data, delassus_sparse);
+  }
+}
+BENCHMARK_REGISTER_F(MultiRobotDelassusFixture, COMPUTE_SPARSE_DELASSUS_MATRIX)
+  ->Apply(MultiRobotArguments);
+
 PINOCCHIO_BENCHMARK_MAIN();
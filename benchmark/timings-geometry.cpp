@@ -111,6 +111,28 @@ BENCHMARK_DEFINE_F(GeometryFixture, UPDATE_GEOMETRY_PLACEMENTS)(benchmark::State
 }
 BENCHMARK_REGISTER_F(GeometryFixture, UPDATE_GEOMETRY_PLACEMENTS)->Apply(CustomArguments);
 
+// UPDATE_GEOMETRY_PLACEMENTS_BATCH
+
+PINOCCHIO_DONT_INLINE static void updateGeometryPlacementsBatchCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  pinocchio::GeometryPlacementsBatch & batch,
+  const Eigen::VectorXd & q)
+{
+  pinocchio::updateGeometryPlacements(model, data, geometry_model, geometry_data, batch, q);
+}
+BENCHMARK_DEFINE_F(GeometryFixture, UPDATE_GEOMETRY_PLACEMENTS_BATCH)(benchmark::State & st)
+{
+  pinocchio::GeometryPlacementsBatch batch(geometry_model);
+  for (auto _ : st)
+  {
+    updateGeometryPlacementsBatchCall(model, data, geometry_model, geometry_data, batch, q);
+  }
+}
+BENCHMARK_REGISTER_F(GeometryFixture, UPDATE_GEOMETRY_PLACEMENTS_BATCH)->Apply(CustomArguments);
+
 #ifdef PINOCCHIO_WITH_COLLISION
 
 struct CollisionFixture : GeometryFixture
@@ -192,6 +214,132 @@ BENCHMARK_DEFINE_F(CollisionFixture, COMPUTE_DISTANCES)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(CollisionFixture, COMPUTE_DISTANCES)->Apply(CustomArguments);
 
+// COMPUTE_DISTANCES_DERIVATIVES
+
+PINOCCHIO_DONT_INLINE static void computeDistancesDerivativesCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const Eigen::VectorXd & q,
+  Eigen::MatrixXd & distance_jacobian)
+{
+  pinocchio::computeDistancesDerivatives(
+    model, data, geometry_model, geometry_data, q, distance_jacobian);
+}
+BENCHMARK_DEFINE_F(CollisionFixture, COMPUTE_DISTANCES_DERIVATIVES)(benchmark::State & st)
+{
+  Eigen::MatrixXd distance_jacobian(
+    Eigen::DenseIndex(geometry_model.collisionPairs.size()), model.nv);
+  for (auto _ : st)
+  {
+    computeDistancesDerivativesCall(
+      model, data, geometry_model, geometry_data, q, distance_jacobian);
+  }
+}
+BENCHMARK_REGISTER_F(CollisionFixture, COMPUTE_DISTANCES_DERIVATIVES)->Apply(CustomArguments);
+
+// COMPUTE_COLLISIONS_DENSE_TRAJECTORY
+
+struct DenseTrajectoryFixture : CollisionFixture
+{
+  void SetUp(benchmark::State & st)
+  {
+    CollisionFixture::SetUp(st);
+    pinocchio::computeBodyRadius(model, geometry_model, geometry_data);
+
+    // Straight line in configuration space, discretized as done by motion planners.
+    const Eigen::VectorXd qmax = Eigen::VectorXd::Ones(model.nq);
+    const Eigen::VectorXd q_goal = randomConfiguration(model, -qmax, qmax);
+    const int num_steps = 1000;
+    trajectory.clear();
+    for (int k = 0; k <= num_steps; ++k)
+      trajectory.push_back(pinocchio::interpolate(model, q, q_goal, double(k) / num_steps));
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    CollisionFixture::TearDown(st);
+  }
+
+  std::vector<Eigen::VectorXd> trajectory;
+};
+
+PINOCCHIO_DONT_INLINE static void computeTrajectoryCollisionsCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const std::vector<Eigen::VectorXd> & trajectory)
+{
+  for (const Eigen::VectorXd & q : trajectory)
+    pinocchio::computeCollisions(model, data, geometry_model, geometry_data, q, false);
+}
+BENCHMARK_DEFINE_F(DenseTrajectoryFixture, COMPUTE_COLLISIONS_DENSE_TRAJECTORY)(
+  benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    computeTrajectoryCollisionsCall(model, data, geometry_model, geometry_data, trajectory);
+  }
+}
+BENCHMARK_REGISTER_F(DenseTrajectoryFixture, COMPUTE_COLLISIONS_DENSE_TRAJECTORY)
+  ->Apply(CustomArguments);
+
+// COMPUTE_COLLISIONS_WITH_TEMPORAL_COHERENCE_DENSE_TRAJECTORY
+
+PINOCCHIO_DONT_INLINE static void computeTrajectoryCollisionsWithTemporalCoherenceCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const std::vector<Eigen::VectorXd> & trajectory)
+{
+  geometry_data.resetCollisionCoherenceCache();
+  for (const Eigen::VectorXd & q : trajectory)
+    pinocchio::computeCollisionsWithTemporalCoherence(
+      model, data, geometry_model, geometry_data, q, false);
+}
+BENCHMARK_DEFINE_F(
+  DenseTrajectoryFixture, COMPUTE_COLLISIONS_WITH_TEMPORAL_COHERENCE_DENSE_TRAJECTORY)(
+  benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    computeTrajectoryCollisionsWithTemporalCoherenceCall(
+      model, data, geometry_model, geometry_data, trajectory);
+  }
+}
+BENCHMARK_REGISTER_F(
+  DenseTrajectoryFixture, COMPUTE_COLLISIONS_WITH_TEMPORAL_COHERENCE_DENSE_TRAJECTORY)
+  ->Apply(CustomArguments);
+
+// COMPUTE_CONTINUOUS_COLLISIONS_SEGMENT
+
+PINOCCHIO_DONT_INLINE static void computeContinuousCollisionsCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const Eigen::VectorXd & q0,
+  const Eigen::VectorXd & q1)
+{
+  double time_of_contact;
+  pinocchio::computeContinuousCollisions(
+    model, data, geometry_model, geometry_data, q0, q1, time_of_contact);
+}
+BENCHMARK_DEFINE_F(DenseTrajectoryFixture, COMPUTE_CONTINUOUS_COLLISIONS_SEGMENT)(
+  benchmark::State & st)
+{
+  for (auto _ : st)
+  {
+    computeContinuousCollisionsCall(
+      model, data, geometry_model, geometry_data, trajectory.front(), trajectory.back());
+  }
+}
+BENCHMARK_REGISTER_F(DenseTrajectoryFixture, COMPUTE_CONTINUOUS_COLLISIONS_SEGMENT)
+  ->Apply(CustomArguments);
+
 #endif // #ifdef PINOCCHIO_WITH_COLLISION
 
 #ifdef PINOCCHIO_WITH_COLLISION
@@ -6,6 +6,10 @@
 
 #include "pinocchio/algorithm/parallel/rnea.hpp"
 #include "pinocchio/algorithm/parallel/aba.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/algorithm/parallel/rnea-derivatives.hpp"
+#include "pinocchio/algorithm/parallel/aba-derivatives.hpp"
+#include "pinocchio/algorithm/parallel/constrained-dynamics-derivatives.hpp"
 #include "pinocchio/algorithm/joint-configuration.hpp"
 
 #include "pinocchio/parsers/urdf.hpp"
@@ -203,6 +207,184 @@ BENCHMARK_DEFINE_F(ParallelFixture, ABA_IN_PARALLEL)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(ParallelFixture, ABA_IN_PARALLEL)->Apply(MultiThreadCustomArguments);
 
+// ABA_IN_PARALLEL_WITH_EXECUTOR
+
+template<typename Executor>
+PINOCCHIO_DONT_INLINE static void abaInParallelWithExecutorCall(
+  pinocchio::ExecutorBase<Executor> & executor,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & taus,
+  const Eigen::MatrixXd & res)
+{
+  pinocchio::abaInParallel(executor, pool, qs, vs, taus, res);
+}
+BENCHMARK_DEFINE_F(ParallelFixture, ABA_IN_PARALLEL_OPENMP_DYNAMIC)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  pinocchio::OpenMPExecutor executor(static_cast<size_t>(NUM_THREADS), true);
+  for (auto _ : st)
+  {
+    abaInParallelWithExecutorCall(executor, *pool, qs, vs, taus, res);
+  }
+}
+BENCHMARK_REGISTER_F(ParallelFixture, ABA_IN_PARALLEL_OPENMP_DYNAMIC)
+  ->Apply(MultiThreadCustomArguments);
+
+BENCHMARK_DEFINE_F(ParallelFixture, ABA_IN_PARALLEL_THREAD_POOL)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  pinocchio::ThreadPoolExecutor executor(static_cast<size_t>(NUM_THREADS));
+  for (auto _ : st)
+  {
+    abaInParallelWithExecutorCall(executor, *pool, qs, vs, taus, res);
+  }
+}
+BENCHMARK_REGISTER_F(ParallelFixture, ABA_IN_PARALLEL_THREAD_POOL)
+  ->Apply(MultiThreadCustomArguments);
+
+struct DerivativesFixture : ParallelFixture
+{
+  void SetUp(benchmark::State & st)
+  {
+    ParallelFixture::SetUp(st);
+
+    const auto BATCH_SIZE = st.range(0);
+    const Eigen::Index nv = model.nv;
+    partial_dq = Eigen::MatrixXd::Zero(nv, nv * BATCH_SIZE);
+    partial_dv = Eigen::MatrixXd::Zero(nv, nv * BATCH_SIZE);
+    partial_dtau = Eigen::MatrixXd::Zero(nv, nv * BATCH_SIZE);
+
+    contact_models.clear();
+    contact_models.push_back(pinocchio::RigidConstraintModel(
+      pinocchio::CONTACT_6D, model, model.getJointId("leg_left_6_joint"), pinocchio::LOCAL));
+    contact_models.push_back(pinocchio::RigidConstraintModel(
+      pinocchio::CONTACT_6D, model, model.getJointId("leg_right_6_joint"), pinocchio::LOCAL));
+
+    Eigen::Index nc = 0;
+    for (const pinocchio::RigidConstraintModel & cmodel : contact_models)
+      nc += cmodel.residualSize();
+    lambda_partial_dq = Eigen::MatrixXd::Zero(nc, nv * BATCH_SIZE);
+    lambda_partial_dv = Eigen::MatrixXd::Zero(nc, nv * BATCH_SIZE);
+    lambda_partial_dtau = Eigen::MatrixXd::Zero(nc, nv * BATCH_SIZE);
+
+    contact_datas.resize(pool->size());
+    for (size_t k = 0; k < pool->size(); ++k)
+    {
+      contact_datas[k] = pinocchio::createData(contact_models);
+      pinocchio::initConstraintDynamics(model, pool->getData(k), contact_models, contact_datas[k]);
+    }
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+    ParallelFixture::TearDown(st);
+  }
+
+  Eigen::MatrixXd partial_dq;
+  Eigen::MatrixXd partial_dv;
+  Eigen::MatrixXd partial_dtau;
+  Eigen::MatrixXd lambda_partial_dq;
+  Eigen::MatrixXd lambda_partial_dv;
+  Eigen::MatrixXd lambda_partial_dtau;
+  pinocchio::RigidConstraintModelVector contact_models;
+  std::vector<pinocchio::RigidConstraintDataVector> contact_datas;
+  pinocchio::ProximalSettings prox_settings;
+};
+
+// RNEA_DERIVATIVES_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void computeRNEADerivativesInParallelCall(
+  size_t num_threads,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & as,
+  Eigen::MatrixXd & partial_dq,
+  Eigen::MatrixXd & partial_dv,
+  Eigen::MatrixXd & partial_da)
+{
+  pinocchio::computeRNEADerivativesInParallel(
+    num_threads, pool, qs, vs, as, partial_dq, partial_dv, partial_da);
+}
+BENCHMARK_DEFINE_F(DerivativesFixture, RNEA_DERIVATIVES_IN_PARALLEL)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  for (auto _ : st)
+  {
+    computeRNEADerivativesInParallelCall(
+      static_cast<size_t>(NUM_THREADS), *pool, qs, vs, as, partial_dq, partial_dv, partial_dtau);
+  }
+}
+BENCHMARK_REGISTER_F(DerivativesFixture, RNEA_DERIVATIVES_IN_PARALLEL)
+  ->Apply(MultiThreadCustomArguments);
+
+// ABA_DERIVATIVES_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void computeABADerivativesInParallelCall(
+  size_t num_threads,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & taus,
+  Eigen::MatrixXd & partial_dq,
+  Eigen::MatrixXd & partial_dv,
+  Eigen::MatrixXd & partial_dtau)
+{
+  pinocchio::computeABADerivativesInParallel(
+    num_threads, pool, qs, vs, taus, partial_dq, partial_dv, partial_dtau);
+}
+BENCHMARK_DEFINE_F(DerivativesFixture, ABA_DERIVATIVES_IN_PARALLEL)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  for (auto _ : st)
+  {
+    computeABADerivativesInParallelCall(
+      static_cast<size_t>(NUM_THREADS), *pool, qs, vs, taus, partial_dq, partial_dv, partial_dtau);
+  }
+}
+BENCHMARK_REGISTER_F(DerivativesFixture, ABA_DERIVATIVES_IN_PARALLEL)
+  ->Apply(MultiThreadCustomArguments);
+
+// CONSTRAINT_DYNAMICS_DERIVATIVES_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void computeConstraintDynamicsDerivativesInParallelCall(
+  size_t num_threads,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & taus,
+  const pinocchio::RigidConstraintModelVector & contact_models,
+  std::vector<pinocchio::RigidConstraintDataVector> & contact_datas,
+  const pinocchio::ProximalSettings & prox_settings,
+  Eigen::MatrixXd & partial_dq,
+  Eigen::MatrixXd & partial_dv,
+  Eigen::MatrixXd & partial_dtau,
+  Eigen::MatrixXd & lambda_partial_dq,
+  Eigen::MatrixXd & lambda_partial_dv,
+  Eigen::MatrixXd & lambda_partial_dtau)
+{
+  pinocchio::computeConstraintDynamicsDerivativesInParallel(
+    num_threads, pool, qs, vs, taus, contact_models, contact_datas, prox_settings, partial_dq,
+    partial_dv, partial_dtau, lambda_partial_dq, lambda_partial_dv, lambda_partial_dtau);
+}
+BENCHMARK_DEFINE_F(DerivativesFixture, CONSTRAINT_DYNAMICS_DERIVATIVES_IN_PARALLEL)(
+  benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  for (auto _ : st)
+  {
+    computeConstraintDynamicsDerivativesInParallelCall(
+      static_cast<size_t>(NUM_THREADS), *pool, qs, vs, taus, contact_models, contact_datas,
+      prox_settings, partial_dq, partial_dv, partial_dtau, lambda_partial_dq, lambda_partial_dv,
+      lambda_partial_dtau);
+  }
+}
+BENCHMARK_REGISTER_F(DerivativesFixture, CONSTRAINT_DYNAMICS_DERIVATIVES_IN_PARALLEL)
+  ->Apply(MultiThreadCustomArguments);
+
 #ifdef PINOCCHIO_WITH_COLLISION
 
 struct GeometryFixture : ParallelFixture
@@ -306,6 +488,62 @@ BENCHMARK_DEFINE_F(GeometryFixture, COMPUTE_COLLISIONS_IN_PARALLEL)(benchmark::S
 BENCHMARK_REGISTER_F(GeometryFixture, COMPUTE_COLLISIONS_IN_PARALLEL)
   ->Apply(MultiThreadCustomArguments);
 
+// COMPUTE_DISTANCES_DERIVATIVES
+
+PINOCCHIO_DONT_INLINE static void computeDistancesDerivativesCall(
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const Eigen::VectorXd & q,
+  Eigen::MatrixXd & distance_jacobian)
+{
+  pinocchio::computeDistancesDerivatives(
+    model, data, geometry_model, geometry_data, q, distance_jacobian);
+}
+BENCHMARK_DEFINE_F(GeometryFixture, COMPUTE_DISTANCES_DERIVATIVES)(benchmark::State & st)
+{
+  Eigen::MatrixXd distance_jacobian(
+    Eigen::DenseIndex(geometry_model.collisionPairs.size()), model.nv);
+  for (auto _ : st)
+  {
+    computeDistancesDerivativesCall(
+      model, data, geometry_model, geometry_data, q, distance_jacobian);
+  }
+}
+BENCHMARK_REGISTER_F(GeometryFixture, COMPUTE_DISTANCES_DERIVATIVES)
+  ->Apply(MonoThreadCustomArguments);
+
+// COMPUTE_DISTANCES_DERIVATIVES_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void computeDistancesDerivativesInParallelCall(
+  size_t num_threads,
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const pinocchio::GeometryModel & geometry_model,
+  pinocchio::GeometryData & geometry_data,
+  const Eigen::VectorXd & q,
+  Eigen::MatrixXd & distance_jacobian)
+{
+  pinocchio::computeDistancesDerivativesInParallel(
+    num_threads, model, data, geometry_model, geometry_data, q, distance_jacobian);
+}
+BENCHMARK_DEFINE_F(GeometryFixture, COMPUTE_DISTANCES_DERIVATIVES_IN_PARALLEL)(
+  benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  Eigen::MatrixXd distance_jacobian(
+    Eigen::DenseIndex(geometry_model.collisionPairs.size()), model.nv);
+  for (auto _ : st)
+  {
+    computeDistancesDerivativesInParallelCall(
+      static_cast<size_t>(NUM_THREADS), model, data, geometry_model, geometry_data, q,
+      distance_jacobian);
+  }
+}
+BENCHMARK_REGISTER_F(GeometryFixture, COMPUTE_DISTANCES_DERIVATIVES_IN_PARALLEL)
+  ->Apply(MultiThreadCustomArguments);
+
 // COMPUTE_COLLISIONS_BATCH
 
 PINOCCHIO_DONT_INLINE static void computeCollisionsBatchCall(
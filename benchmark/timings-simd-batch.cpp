@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "model-fixture.hpp"
+
+#include "pinocchio/math/batch-scalar.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/rnea.hpp"
+#include "pinocchio/algorithm/parallel/aba.hpp"
+#include "pinocchio/algorithm/parallel/rnea.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "pinocchio/parsers/urdf.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <iostream>
+
+// Number of lanes matching the width of the SIMD registers for double.
+#if defined(EIGEN_VECTORIZE_AVX512)
+static const int BATCH_LANES = 8;
+#else
+static const int BATCH_LANES = 4;
+#endif
+
+typedef pinocchio::BatchScalarTpl<double, BATCH_LANES> BatchScalar;
+typedef pinocchio::ModelTpl<BatchScalar> ModelBatch;
+typedef pinocchio::DataTpl<BatchScalar> DataBatch;
+
+struct SIMDBatchFixture : benchmark::Fixture
+{
+  void SetUp(benchmark::State & st)
+  {
+    const auto BATCH_SIZE = st.range(0);
+    const auto NUM_THREADS = st.range(1);
+
+    model = MODEL;
+    model_batch = model.cast<BatchScalar>();
+    data_batch = DataBatch(model_batch);
+
+    const Eigen::VectorXd qmax = Eigen::VectorXd::Ones(model.nq);
+    qs = Eigen::MatrixXd(model.nq, BATCH_SIZE);
+    vs = Eigen::MatrixXd(model.nv, BATCH_SIZE);
+    as = Eigen::MatrixXd(model.nv, BATCH_SIZE);
+    taus = Eigen::MatrixXd(model.nv, BATCH_SIZE);
+    res = Eigen::MatrixXd(model.nv, BATCH_SIZE);
+
+    for (Eigen::Index i = 0; i < BATCH_SIZE; ++i)
+    {
+      qs.col(i) = randomConfiguration(model, -qmax, qmax);
+      vs.col(i) = Eigen::VectorXd::Random(model.nv);
+      as.col(i) = Eigen::VectorXd::Random(model.nv);
+      taus.col(i) = Eigen::VectorXd::Random(model.nv);
+    }
+
+    q_batch = ModelBatch::ConfigVectorType(model.nq);
+    v_batch = ModelBatch::TangentVectorType(model.nv);
+    a_batch = ModelBatch::TangentVectorType(model.nv);
+    tau_batch = ModelBatch::TangentVectorType(model.nv);
+
+    pool = std::make_unique<pinocchio::ModelPool>(model, static_cast<size_t>(NUM_THREADS));
+  }
+
+  void TearDown(benchmark::State & st)
+  {
+    // Report the number of evaluated configurations per second.
+    st.SetItemsProcessed(st.iterations() * st.range(0));
+  }
+
+  pinocchio::Model model;
+  ModelBatch model_batch;
+  DataBatch data_batch;
+  Eigen::MatrixXd qs;
+  Eigen::MatrixXd vs;
+  Eigen::MatrixXd as;
+  Eigen::MatrixXd taus;
+  Eigen::MatrixXd res;
+  ModelBatch::ConfigVectorType q_batch;
+  ModelBatch::TangentVectorType v_batch;
+  ModelBatch::TangentVectorType a_batch;
+  ModelBatch::TangentVectorType tau_batch;
+  std::unique_ptr<pinocchio::ModelPool> pool;
+
+  static pinocchio::Model MODEL;
+
+  static void GlobalSetUp(const ExtraArgs &)
+  {
+    const std::string filename =
+      EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/talos_data/robots/talos_reduced.urdf");
+
+    pinocchio::urdf::buildModel(
+      filename,
+      pinocchio::JointModelFreeFlyerTpl<pinocchio::context::Scalar, pinocchio::context::Options>(),
+      MODEL);
+
+    std::cout << "nq = " << MODEL.nq << std::endl;
+    std::cout << "nv = " << MODEL.nv << std::endl;
+    std::cout << "name = " << MODEL.name << std::endl;
+    std::cout << "lanes = " << BATCH_LANES << std::endl;
+    std::cout << "--" << std::endl;
+  }
+};
+
+pinocchio::Model SIMDBatchFixture::MODEL;
+
+static void MonoThreadCustomArguments(benchmark::internal::Benchmark * b)
+{
+  b->MinWarmUpTime(3.)->ArgsProduct({{256}, {1}})->ArgNames({"BATCH_SIZE", "NUM_THREADS"});
+}
+
+static void MultiThreadCustomArguments(benchmark::internal::Benchmark * b)
+{
+  b->MinWarmUpTime(3.)
+    ->ArgsProduct({{256}, benchmark::CreateRange(1, omp_get_max_threads(), 2)})
+    ->ArgNames({"BATCH_SIZE", "NUM_THREADS"})
+    ->UseRealTime();
+}
+
+// RNEA_SIMD_BATCH
+
+PINOCCHIO_DONT_INLINE static void rneaSIMDBatchCall(
+  const ModelBatch & model,
+  DataBatch & data,
+  const ModelBatch::ConfigVectorType & q,
+  const ModelBatch::TangentVectorType & v,
+  const ModelBatch::TangentVectorType & a)
+{
+  pinocchio::rnea(model, data, q, v, a);
+}
+BENCHMARK_DEFINE_F(SIMDBatchFixture, RNEA_SIMD_BATCH)(benchmark::State & st)
+{
+  const auto BATCH_SIZE = st.range(0);
+  for (auto _ : st)
+  {
+    for (Eigen::Index i = 0; i + BATCH_LANES <= BATCH_SIZE; i += BATCH_LANES)
+    {
+      pinocchio::packBatch(qs.middleCols<BATCH_LANES>(i), q_batch);
+      pinocchio::packBatch(vs.middleCols<BATCH_LANES>(i), v_batch);
+      pinocchio::packBatch(as.middleCols<BATCH_LANES>(i), a_batch);
+      rneaSIMDBatchCall(model_batch, data_batch, q_batch, v_batch, a_batch);
+      pinocchio::unpackBatch(data_batch.tau, res.middleCols<BATCH_LANES>(i));
+    }
+  }
+}
+BENCHMARK_REGISTER_F(SIMDBatchFixture, RNEA_SIMD_BATCH)->Apply(MonoThreadCustomArguments);
+
+// RNEA_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void rneaInParallelCall(
+  size_t num_threads,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & as,
+  const Eigen::MatrixXd & res)
+{
+  pinocchio::rneaInParallel(num_threads, pool, qs, vs, as, res);
+}
+BENCHMARK_DEFINE_F(SIMDBatchFixture, RNEA_IN_PARALLEL)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  for (auto _ : st)
+  {
+    rneaInParallelCall(static_cast<size_t>(NUM_THREADS), *pool, qs, vs, as, res);
+  }
+}
+BENCHMARK_REGISTER_F(SIMDBatchFixture, RNEA_IN_PARALLEL)->Apply(MultiThreadCustomArguments);
+
+// ABA_SIMD_BATCH
+
+PINOCCHIO_DONT_INLINE static void abaSIMDBatchCall(
+  const ModelBatch & model,
+  DataBatch & data,
+  const ModelBatch::ConfigVectorType & q,
+  const ModelBatch::TangentVectorType & v,
+  const ModelBatch::TangentVectorType & tau)
+{
+  pinocchio::aba(model, data, q, v, tau, pinocchio::Convention::WORLD);
+}
+BENCHMARK_DEFINE_F(SIMDBatchFixture, ABA_SIMD_BATCH)(benchmark::State & st)
+{
+  const auto BATCH_SIZE = st.range(0);
+  for (auto _ : st)
+  {
+    for (Eigen::Index i = 0; i + BATCH_LANES <= BATCH_SIZE; i += BATCH_LANES)
+    {
+      pinocchio::packBatch(qs.middleCols<BATCH_LANES>(i), q_batch);
+      pinocchio::packBatch(vs.middleCols<BATCH_LANES>(i), v_batch);
+      pinocchio::packBatch(taus.middleCols<BATCH_LANES>(i), tau_batch);
+      abaSIMDBatchCall(model_batch, data_batch, q_batch, v_batch, tau_batch);
+      pinocchio::unpackBatch(data_batch.ddq, res.middleCols<BATCH_LANES>(i));
+    }
+  }
+}
+BENCHMARK_REGISTER_F(SIMDBatchFixture, ABA_SIMD_BATCH)->Apply(MonoThreadCustomArguments);
+
+// ABA_IN_PARALLEL
+
+PINOCCHIO_DONT_INLINE static void abaInParallelCall(
+  size_t num_threads,
+  pinocchio::ModelPool & pool,
+  const Eigen::MatrixXd & qs,
+  const Eigen::MatrixXd & vs,
+  const Eigen::MatrixXd & taus,
+  const Eigen::MatrixXd & res)
+{
+  pinocchio::abaInParallel(num_threads, pool, qs, vs, taus, res);
+}
+BENCHMARK_DEFINE_F(SIMDBatchFixture, ABA_IN_PARALLEL)(benchmark::State & st)
+{
+  const auto NUM_THREADS = st.range(1);
+  for (auto _ : st)
+  {
+    abaInParallelCall(static_cast<size_t>(NUM_THREADS), *pool, qs, vs, taus, res);
+  }
+}
+BENCHMARK_REGISTER_F(SIMDBatchFixture, ABA_IN_PARALLEL)->Apply(MultiThreadCustomArguments);
+
+PINOCCHIO_BENCHMARK_MAIN_WITH_SETUP(SIMDBatchFixture::GlobalSetUp);
@@ -16,6 +16,7 @@
 #include "pinocchio/algorithm/center-of-mass.hpp"
 #include "pinocchio/algorithm/compute-all-terms.hpp"
 #include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/compiled-model.hpp"
 
 #include <benchmark/benchmark.h>
 
@@ -209,6 +210,28 @@ BENCHMARK_DEFINE_F(ModelFixture, RNEA)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(ModelFixture, RNEA)->Apply(CustomArguments);
 
+// RNEA on the compiled model
+
+PINOCCHIO_DONT_INLINE static void rneaCompiledCall(
+  const pinocchio::CompiledModel & compiled_model,
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const Eigen::VectorXd & q,
+  const Eigen::VectorXd & v,
+  const Eigen::VectorXd & a)
+{
+  pinocchio::rnea(compiled_model, model, data, q, v, a);
+}
+BENCHMARK_DEFINE_F(ModelFixture, RNEA_COMPILED)(benchmark::State & st)
+{
+  const pinocchio::CompiledModel compiled_model(model);
+  for (auto _ : st)
+  {
+    rneaCompiledCall(compiled_model, model, data, q, v, a);
+  }
+}
+BENCHMARK_REGISTER_F(ModelFixture, RNEA_COMPILED)->Apply(CustomArguments);
+
 // nonLinearEffects
 
 PINOCCHIO_DONT_INLINE static void nonLinearEffectsCall(
@@ -422,6 +445,26 @@ BENCHMARK_DEFINE_F(ModelFixture, FORWARD_KINEMATICS_Q)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(ModelFixture, FORWARD_KINEMATICS_Q)->Apply(CustomArguments);
 
+// forwardKinematicsQ on the compiled model
+
+PINOCCHIO_DONT_INLINE static void forwardKinematicsQCompiledCall(
+  const pinocchio::CompiledModel & compiled_model,
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const Eigen::VectorXd & q)
+{
+  pinocchio::forwardKinematics(compiled_model, model, data, q);
+}
+BENCHMARK_DEFINE_F(ModelFixture, FORWARD_KINEMATICS_Q_COMPILED)(benchmark::State & st)
+{
+  const pinocchio::CompiledModel compiled_model(model);
+  for (auto _ : st)
+  {
+    forwardKinematicsQCompiledCall(compiled_model, model, data, q);
+  }
+}
+BENCHMARK_REGISTER_F(ModelFixture, FORWARD_KINEMATICS_Q_COMPILED)->Apply(CustomArguments);
+
 // forwardKinematicsQV
 
 PINOCCHIO_DONT_INLINE static void forwardKinematicsQVCall(
@@ -533,6 +576,28 @@ BENCHMARK_DEFINE_F(ModelFixture, ABA_LOCAL)(benchmark::State & st)
 }
 BENCHMARK_REGISTER_F(ModelFixture, ABA_LOCAL)->Apply(CustomArguments);
 
+// ABA Local on the compiled model
+
+PINOCCHIO_DONT_INLINE static void abaLocalCompiledCall(
+  const pinocchio::CompiledModel & compiled_model,
+  const pinocchio::Model & model,
+  pinocchio::Data & data,
+  const Eigen::VectorXd & q,
+  const Eigen::VectorXd & v,
+  const Eigen::VectorXd & tau)
+{
+  pinocchio::aba(compiled_model, model, data, q, v, tau);
+}
+BENCHMARK_DEFINE_F(ModelFixture, ABA_LOCAL_COMPILED)(benchmark::State & st)
+{
+  const pinocchio::CompiledModel compiled_model(model);
+  for (auto _ : st)
+  {
+    abaLocalCompiledCall(compiled_model, model, data, q, v, tau);
+  }
+}
+BENCHMARK_REGISTER_F(ModelFixture, ABA_LOCAL_COMPILED)->Apply(CustomArguments);
+
 // ABA World
 
 PINOCCHIO_DONT_INLINE static void abaWorldCall(
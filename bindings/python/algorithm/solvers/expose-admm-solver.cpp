@@ -172,6 +172,8 @@ namespace pinocchio
         .PINOCCHIO_ADD_PROPERTY_READONLY(
           ADMMSolverResult, spectral_rho_power, "Final spectral rho power")
         .PINOCCHIO_ADD_PROPERTY_READONLY(ADMMSolverResult, mu_prox, "Final proximal parameter")
+        .PINOCCHIO_ADD_PROPERTY_READONLY(
+          ADMMSolverResult, residual, "Infinity norm of the optimality residual at the solution")
 
         .def(
           "resize", &ADMMSolverResult::resize, bp::args("self", "problem_size"),
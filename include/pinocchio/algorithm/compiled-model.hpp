@@ -0,0 +1,222 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <Eigen/Core>
+
+#include <cassert>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/variant.hpp>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/multibody.hpp"
+#include "pinocchio/multibody/joint.hpp"
+
+#include "pinocchio/algorithm/check.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/rnea.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+
+  namespace details
+  {
+    template<typename JointModelTypes>
+    struct CompiledJointArrays;
+
+    template<typename... JointModels>
+    struct CompiledJointArrays<std::tuple<JointModels...>>
+    {
+      typedef std::tuple<std::vector<JointModels, Eigen::aligned_allocator<JointModels>>...>
+        type;
+    };
+  } // namespace details
+
+  ///
+  /// \brief Variant-free representation of the joints of a ModelTpl, built once from the model.
+  ///
+  /// The joints are copied into contiguous arrays, one per joint type, and the model traversal is
+  /// stored as a program of segments: each segment is a run of consecutive joints (in the
+  /// topological order of the model) sharing the same type. The algorithms taking a compiled
+  /// model dispatch once per segment and then call the joint kernels of the concrete joint type,
+  /// which can be inlined, instead of visiting the boost::variant of every joint.
+  ///
+  /// The joint types which have no dedicated array (composite, mimic, helical, ...) are stored as
+  /// generic joints and go through the usual visitors.
+  ///
+  template<
+    typename _Scalar,
+    int _Options = context::Options,
+    template<typename, int> class JointCollectionTpl = JointCollectionDefaultTpl>
+  struct CompiledModelTpl
+  {
+    typedef _Scalar Scalar;
+    enum
+    {
+      Options = _Options
+    };
+
+    typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+    typedef typename Model::JointIndex JointIndex;
+    typedef typename Model::JointModel JointModel;
+
+    /// \brief Joint types having a dedicated array, the generic joint being the last one.
+    typedef std::tuple<
+      JointModelRevoluteTpl<Scalar, Options, 0>,
+      JointModelRevoluteTpl<Scalar, Options, 1>,
+      JointModelRevoluteTpl<Scalar, Options, 2>,
+      JointModelRevoluteUnalignedTpl<Scalar, Options>,
+      JointModelRevoluteUnboundedTpl<Scalar, Options, 0>,
+      JointModelRevoluteUnboundedTpl<Scalar, Options, 1>,
+      JointModelRevoluteUnboundedTpl<Scalar, Options, 2>,
+      JointModelPrismaticTpl<Scalar, Options, 0>,
+      JointModelPrismaticTpl<Scalar, Options, 1>,
+      JointModelPrismaticTpl<Scalar, Options, 2>,
+      JointModelPrismaticUnalignedTpl<Scalar, Options>,
+      JointModelSphericalTpl<Scalar, Options>,
+      JointModelTranslationTpl<Scalar, Options>,
+      JointModelPlanarTpl<Scalar, Options>,
+      JointModelFreeFlyerTpl<Scalar, Options>,
+      JointModel>
+      JointModelTypes;
+
+    /// \brief Number of joint types, including the generic joint.
+    static constexpr std::size_t num_joint_types = std::tuple_size<JointModelTypes>::value;
+
+    /// \brief One array per joint type.
+    typedef typename details::CompiledJointArrays<JointModelTypes>::type JointArrays;
+
+    ///
+    /// \brief Run of consecutive joints of the same type: the joints begin to end - 1 of the
+    /// array of the joint type.
+    ///
+    struct Segment
+    {
+      std::size_t joint_type;
+      std::size_t begin;
+      std::size_t end;
+    };
+
+    /// \brief Default constructor, building an empty program.
+    CompiledModelTpl()
+    : njoints(0)
+    {
+    }
+
+    ///
+    /// \brief Compile the joints of model.
+    ///
+    /// \param[in] model The model structure of the rigid body system.
+    ///
+    explicit CompiledModelTpl(const Model & model);
+
+    /// \brief Number of joints of the compiled model, including the universe.
+    JointIndex njoints;
+
+    /// \brief Segments of the program, in the topological order of the model.
+    std::vector<Segment> program;
+
+    /// \brief Joints of each type, in the topological order of the model.
+    JointArrays joints;
+  }; // struct CompiledModelTpl
+
+  typedef CompiledModelTpl<context::Scalar, context::Options> CompiledModel;
+
+  ///
+  /// \brief Update the joint placements according to the current joint configuration, traversing
+  /// the compiled model instead of the joint variants of model.
+  ///
+  /// \param[in] compiled_model The compiled joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration (vector dim model.nq).
+  ///
+  /// \sa forwardKinematics(const ModelTpl &, DataTpl &, const Eigen::MatrixBase &)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  void forwardKinematics(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q);
+
+  ///
+  /// \brief The Recursive Newton-Euler algorithm, traversing the compiled model instead of the
+  /// joint variants of model.
+  ///
+  /// \param[in] compiled_model The compiled joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration vector (dim model.nq).
+  /// \param[in] v The joint velocity vector (dim model.nv).
+  /// \param[in] a The joint acceleration vector (dim model.nv).
+  ///
+  /// \return The desired joint torques stored in data.tau.
+  ///
+  /// \sa rnea(const ModelTpl &, DataTpl &, const Eigen::MatrixBase &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & rnea(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & a);
+
+  ///
+  /// \brief The Articulated-Body algorithm in the local convention, traversing the compiled model
+  /// instead of the joint variants of model.
+  ///
+  /// \param[in] compiled_model The compiled joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration vector (dim model.nq).
+  /// \param[in] v The joint velocity vector (dim model.nv).
+  /// \param[in] tau The joint torque vector (dim model.nv).
+  ///
+  /// \return The current joint acceleration stored in data.ddq.
+  ///
+  /// \sa aba(const ModelTpl &, DataTpl &, const Eigen::MatrixBase &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & aba(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & tau);
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/compiled-model.hxx"
+// IWYU pragma: end_exports
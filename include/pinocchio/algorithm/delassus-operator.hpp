@@ -10,6 +10,7 @@
 #include <stdexcept>
 #include <new>
 #include <functional>
+#include <optional>
 #include <utility>
 #include <vector>
 #include <type_traits>
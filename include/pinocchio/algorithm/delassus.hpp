@@ -13,6 +13,7 @@
 #include <limits>
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 #include <boost/fusion/container/vector.hpp>
 
 #include "pinocchio/macros.hpp"
@@ -78,6 +79,49 @@ namespace pinocchio
     const Eigen::MatrixBase<MatrixType> & delassus,
     const Scalar mu = 0);
 
+  ///
+  /// \brief Computes the Delassus matrix associated to a set of given constraints as a sparse
+  /// matrix, which can be used to build a DelassusOperatorSparseTpl.
+  ///
+  /// Only the blocks coupling two constraints sharing a common ancestor joint other than the
+  /// universe are computed and stored. Contrary to computeDelassusMatrix, which only fills the
+  /// upper triangular part, both triangular parts of the matrix are filled.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorType Type of the joint configuration vector.
+  /// \tparam ModelAllocator Allocator class for the std::vector.
+  /// \tparam DataAllocator Allocator class for the std::vector.
+  ///
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration (size model.nq).
+  /// \param[in] contact_models Vector of contact models.
+  /// \param[in] contact_data Vector of contact data.
+  /// \param[out] delassus The resulting sparse Delassus matrix, resized and compressed.
+  /// \param[in] mu Optional damping factor used when computing the inverse of the Delassus matrix.
+  ///
+  /// \note This is well suited to scenes composed of several robots or free-floating objects, for
+  /// which most of the blocks of the Delassus matrix are structurally zero.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    class ModelAllocator,
+    class DataAllocator,
+    int SparseOptions,
+    typename StorageIndex>
+  PINOCCHIO_UNSUPPORTED_MESSAGE("The API will change towards more flexibility")
+  void computeSparseDelassusMatrix(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ModelAllocator> & contact_models,
+    std::vector<RigidConstraintDataTpl<Scalar, Options>, DataAllocator> & contact_data,
+    Eigen::SparseMatrix<Scalar, SparseOptions, StorageIndex> & delassus,
+    const Scalar mu = 0);
+
   ///
   /// \brief Computes the inverse of the Delassus matrix associated to a set of given constraints.
   ///
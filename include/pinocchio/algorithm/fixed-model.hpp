@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <boost/variant.hpp>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/multibody.hpp"
+#include "pinocchio/multibody/joint.hpp"
+
+#include "pinocchio/algorithm/check.hpp"
+#include "pinocchio/algorithm/rnea.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/crba.hpp"
+#include "pinocchio/algorithm/compiled-model.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+
+  namespace details
+  {
+    /// \brief Sum of the sizes of fixed-size joints, Eigen::Dynamic if one of them is dynamic.
+    template<typename... Sizes>
+    constexpr int fixedModelSize(const Sizes... sizes)
+    {
+      int res = 0;
+      for (const int size : {0, sizes...})
+      {
+        if (size == Eigen::Dynamic)
+          return Eigen::Dynamic;
+        res += size;
+      }
+      return res;
+    }
+  } // namespace details
+
+  ///
+  /// \brief Joints of a ModelTpl whose types, and thus the topology of the traversal, are fixed at
+  /// compile time.
+  ///
+  /// JointModels are the types of the joints 1 to njoints - 1 of the model, in its topological
+  /// order. The algorithms taking a fixed model unroll the traversal of the joints and call the
+  /// joint kernels of the concrete joint types, without any runtime dispatch. The configuration
+  /// and tangent vectors have a compile-time size when all the joints have a fixed size.
+  ///
+  /// The remaining quantities (parents, placements, inertias, ...) are read from the model, which
+  /// must be the one the fixed model has been built from. The typedef of a fixed model can be
+  /// generated from a parsed model with fixedModelTypedef.
+  ///
+  template<
+    typename _Scalar,
+    int _Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels>
+  struct FixedModelTpl
+  {
+    typedef _Scalar Scalar;
+    enum
+    {
+      Options = _Options
+    };
+
+    typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+    typedef typename Model::JointIndex JointIndex;
+
+    /// \brief Number of joints, including the universe.
+    static constexpr JointIndex njoints = JointIndex(sizeof...(JointModels) + 1);
+
+    /// \brief Dimension of the configuration vector, Eigen::Dynamic if not fixed.
+    static constexpr int nq = details::fixedModelSize(JointModels::NQ...);
+
+    /// \brief Dimension of the tangent vector, Eigen::Dynamic if not fixed.
+    static constexpr int nv = details::fixedModelSize(JointModels::NV...);
+
+    typedef Eigen::Matrix<Scalar, nq, 1, Options> ConfigVectorType;
+    typedef Eigen::Matrix<Scalar, nv, 1, Options> TangentVectorType;
+
+    typedef std::tuple<JointModels...> JointModelTuple;
+
+    /// \brief Default constructor, with joints which are not initialized.
+    FixedModelTpl()
+    {
+    }
+
+    ///
+    /// \brief Copy the joints of model, checking their types.
+    ///
+    /// \param[in] model The model structure of the rigid body system.
+    ///
+    explicit FixedModelTpl(const Model & model);
+
+    /// \brief Joints of the model.
+    JointModelTuple joints;
+
+  private:
+    template<std::size_t... I>
+    void setJoints(const Model & model, std::index_sequence<I...>);
+  }; // struct FixedModelTpl
+
+  template<typename... JointModels>
+  using FixedModel =
+    FixedModelTpl<context::Scalar, context::Options, JointCollectionDefaultTpl, JointModels...>;
+
+  ///
+  /// \brief Generate the typedef of the FixedModel matching the joints of model, to be written in a
+  /// header at build time (e.g. by a generator run with add_custom_command on the URDF of the
+  /// robot).
+  ///
+  /// Only the joint types handled without the generic joint by CompiledModelTpl are supported.
+  ///
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] type_name Name of the generated type.
+  ///
+  /// \returns The C++ typedef of the fixed model.
+  ///
+  inline std::string fixedModelTypedef(const Model & model, const std::string & type_name);
+
+  ///
+  /// \brief The Recursive Newton-Euler algorithm, unrolled over the joints of a fixed model.
+  ///
+  /// \param[in] fixed_model The fixed joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration vector (dim model.nq).
+  /// \param[in] v The joint velocity vector (dim model.nv).
+  /// \param[in] a The joint acceleration vector (dim model.nv).
+  ///
+  /// \return The desired joint torques stored in data.tau.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & rnea(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & a);
+
+  ///
+  /// \brief The Articulated-Body algorithm in the local convention, unrolled over the joints of a
+  /// fixed model.
+  ///
+  /// \param[in] fixed_model The fixed joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration vector (dim model.nq).
+  /// \param[in] v The joint velocity vector (dim model.nv).
+  /// \param[in] tau The joint torque vector (dim model.nv).
+  ///
+  /// \return The current joint acceleration stored in data.ddq.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & aba(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & tau);
+
+  ///
+  /// \brief The Composite Rigid Body algorithm in the local convention, unrolled over the joints
+  /// of a fixed model.
+  ///
+  /// \param[in] fixed_model The fixed joints of model.
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] q The joint configuration vector (dim model.nq).
+  ///
+  /// \return The joint space inertia matrix, with only the upper triangular part computed,
+  /// stored in data.M.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::MatrixXs & crba(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q);
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/fixed-model.hxx"
+// IWYU pragma: end_exports
@@ -70,6 +70,51 @@ namespace pinocchio
     const GeometryModel & geom_model,
     GeometryData & geom_data);
 
+  ///
+  /// \brief Update the placement of the geometry objects according to the current joint placements
+  /// contained in data, using the structure-of-arrays storage of batch.
+  ///
+  /// The placements of all the geometries supported by a joint are composed with the joint
+  /// placement by a single matrix product, and stored contiguously in batch.oRotations and
+  /// batch.oTranslations before being written in geom_data.oMg.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  ///
+  /// \param[in] model The model structure of the rigid body system.
+  /// \param[in] data The data structure of the rigid body system.
+  /// \param[in] geom_model The geometry model containing the collision objects.
+  /// \param[out] geom_data The geometry data containing the placements of the collision objects.
+  /// See oMg field in GeometryData.
+  /// \param[in,out] batch The placements of the geometries of geom_model, grouped by joint.
+  ///
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  void updateGeometryPlacements(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    GeometryPlacementsBatch & batch);
+
+  ///
+  /// \brief Apply a forward kinematics and update the placement of the geometry objects, using
+  /// the structure-of-arrays storage of batch.
+  ///
+  /// \sa updateGeometryPlacements(const ModelTpl &, const DataTpl &, const GeometryModel &,
+  /// GeometryData &, GeometryPlacementsBatch &)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  void updateGeometryPlacements(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    GeometryPlacementsBatch & batch,
+    const Eigen::MatrixBase<ConfigVectorType> & q);
+
   ///
   /// Append geom_model2 to geom_model1
   ///
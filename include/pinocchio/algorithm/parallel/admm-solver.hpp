@@ -0,0 +1,257 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/algorithm/solvers/fwd.hpp"
+#include "pinocchio/algorithm/solvers/admm-solver.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief Pool of ADMM constraint solvers, one per thread.
+  ///
+  /// Each solver owns its workspace, so that several constraint problems can be solved
+  /// concurrently without sharing any memory between the threads.
+  ///
+  template<typename _Scalar, int _Options>
+  class ADMMConstraintSolverPoolTpl
+  {
+  public:
+    typedef _Scalar Scalar;
+    static constexpr int Options = _Options;
+
+    typedef ADMMConstraintSolverTpl<Scalar, Options> ADMMConstraintSolver;
+    typedef std::vector<ADMMConstraintSolver> ADMMConstraintSolverVector;
+
+    /// \brief Default constructor from a pool size.
+    ///
+    /// \param[in] pool_size total size of the pool.
+    /// \param[in] max_problem_size problem size used to preallocate the workspaces of the solvers.
+    ///
+    explicit ADMMConstraintSolverPoolTpl(
+      const size_t pool_size = (size_t)omp_get_max_threads(), const size_t max_problem_size = 0)
+    : m_solvers(pool_size, ADMMConstraintSolver(max_problem_size))
+    {
+    }
+
+    /// \brief Returns the size of the pool.
+    size_t size() const
+    {
+      return m_solvers.size();
+    }
+
+    /// \brief Set the size of the pool.
+    void resize(const size_t new_size)
+    {
+      m_solvers.resize(new_size);
+    }
+
+    /// \brief Returns the vector of solvers.
+    const ADMMConstraintSolverVector & getSolvers() const
+    {
+      return m_solvers;
+    }
+
+    /// \brief Returns the vector of solvers.
+    ADMMConstraintSolverVector & getSolvers()
+    {
+      return m_solvers;
+    }
+
+    /// \brief Returns a specific solver.
+    const ADMMConstraintSolver & getSolver(const size_t index) const
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        index < m_solvers.size(), "Index greater than the size of the solver vector.");
+      return m_solvers[index];
+    }
+
+    /// \brief Returns a specific solver.
+    ADMMConstraintSolver & getSolver(const size_t index)
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        index < m_solvers.size(), "Index greater than the size of the solver vector.");
+      return m_solvers[index];
+    }
+
+  protected:
+    /// \brief Vector of solvers.
+    ADMMConstraintSolverVector m_solvers;
+  }; // class ADMMConstraintSolverPoolTpl
+
+  ///
+  /// \brief Aggregated statistics of a batch of constraint problems solved by
+  /// solveConstraintProblemsInParallel.
+  ///
+  template<typename _Scalar>
+  struct ADMMBatchSolverStatsTpl
+  {
+    typedef _Scalar Scalar;
+
+    /// \brief Default constructor.
+    ADMMBatchSolverStatsTpl()
+    {
+      reset();
+    }
+
+    /// \brief Reset the statistics.
+    void reset()
+    {
+      num_problems = 0;
+      num_converged = 0;
+      num_warmstarted = 0;
+      total_iterations = 0;
+      max_iterations = 0;
+      max_primal_feasibility = Scalar(0);
+      max_dual_feasibility = Scalar(0);
+      max_complementarity = Scalar(0);
+      total_elapsed_time = 0.;
+    }
+
+    /// \brief Returns true if all the problems of the batch have converged.
+    bool allConverged() const
+    {
+      return num_converged == num_problems;
+    }
+
+    /// \brief Number of problems of the batch.
+    std::size_t num_problems;
+
+    /// \brief Number of problems which have converged.
+    std::size_t num_converged;
+
+    /// \brief Number of problems warm-started with their previous solution.
+    std::size_t num_warmstarted;
+
+    /// \brief Sum of the iterations over the batch.
+    std::size_t total_iterations;
+
+    /// \brief Largest number of iterations over the batch.
+    std::size_t max_iterations;
+
+    /// \brief Largest primal feasibility over the batch.
+    Scalar max_primal_feasibility;
+
+    /// \brief Largest dual feasibility over the batch.
+    Scalar max_dual_feasibility;
+
+    /// \brief Largest complementarity over the batch.
+    Scalar max_complementarity;
+
+    /// \brief Sum of the solve timings over the batch, in microseconds.
+    /// It is only filled when settings.measure_timings is set.
+    double total_elapsed_time;
+  }; // struct ADMMBatchSolverStatsTpl
+
+  ///
+  /// \brief Solves a batch of independent constraint problems with the ADMM solvers of the pool.
+  ///
+  /// The i-th problem is defined by delassus_operators[i], gs[i], constraint_models[i] and
+  /// constraint_datas[i], and its solution is stored in results[i]. When
+  /// warmstart_with_previous_result is true and results[i] contains a valid solution of a problem
+  /// of the same size (e.g. the one of the previous simulation step), this solution is used as the
+  /// primal/dual guess of the solver unless a guess has been explicitly set by the user.
+  /// The value of rho is warm-started according to settings.warmstart_rho_with_previous_result.
+  ///
+  /// \param[in] executor Executor distributing the problems over the threads.
+  /// \param[in] pool Pool of ADMM solvers, one per thread.
+  /// \param[in] delassus_operators Delassus operators of the problems. They are updated by the
+  /// solver.
+  /// \param[in] gs Free constraint velocities of the problems.
+  /// \param[in] constraint_models Constraint models of the problems.
+  /// \param[in] constraint_datas Constraint datas of the problems.
+  /// \param[in] settings Settings shared by all the solves.
+  /// \param[in/out] results Solutions of the problems. They also contain the warm starts.
+  /// \param[in] warmstart_with_previous_result Warm-start the problems with their previous
+  /// solution.
+  ///
+  /// \returns The statistics aggregated over the batch.
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    typename DelassusOperator,
+    typename DelassusOperatorAllocator,
+    typename VectorLike,
+    typename VectorLikeAllocator,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintModelVectorAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator,
+    typename ConstraintDataVectorAllocator,
+    typename ResultAllocator>
+  ADMMBatchSolverStatsTpl<Scalar> solveConstraintProblemsInParallel(
+    ExecutorBase<Executor> & executor,
+    ADMMConstraintSolverPoolTpl<Scalar, Options> & pool,
+    std::vector<DelassusOperator, DelassusOperatorAllocator> & delassus_operators,
+    const std::vector<VectorLike, VectorLikeAllocator> & gs,
+    const std::vector<
+      std::vector<ConstraintModel, ConstraintModelAllocator>,
+      ConstraintModelVectorAllocator> & constraint_models,
+    const std::vector<
+      std::vector<ConstraintData, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & constraint_datas,
+    const ADMMSolverSettingsTpl<Scalar> & settings,
+    std::vector<ADMMSolverResultTpl<Scalar, Options>, ResultAllocator> & results,
+    const bool warmstart_with_previous_result = true);
+
+  ///
+  /// \brief Solves a batch of independent constraint problems with the ADMM solvers of the pool,
+  /// relying on OpenMP with a dynamic scheduling as the costs of the problems are uneven.
+  ///
+  /// \param[in] num_threads Number of threads used for the parallel computations.
+  ///
+  /// \sa solveConstraintProblemsInParallel(ExecutorBase<Executor> &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    typename DelassusOperator,
+    typename DelassusOperatorAllocator,
+    typename VectorLike,
+    typename VectorLikeAllocator,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintModelVectorAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator,
+    typename ConstraintDataVectorAllocator,
+    typename ResultAllocator>
+  ADMMBatchSolverStatsTpl<Scalar> solveConstraintProblemsInParallel(
+    const size_t num_threads,
+    ADMMConstraintSolverPoolTpl<Scalar, Options> & pool,
+    std::vector<DelassusOperator, DelassusOperatorAllocator> & delassus_operators,
+    const std::vector<VectorLike, VectorLikeAllocator> & gs,
+    const std::vector<
+      std::vector<ConstraintModel, ConstraintModelAllocator>,
+      ConstraintModelVectorAllocator> & constraint_models,
+    const std::vector<
+      std::vector<ConstraintData, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & constraint_datas,
+    const ADMMSolverSettingsTpl<Scalar> & settings,
+    std::vector<ADMMSolverResultTpl<Scalar, Options>, ResultAllocator> & results,
+    const bool warmstart_with_previous_result = true);
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/admm-solver.hxx"
+// IWYU pragma: end_exports
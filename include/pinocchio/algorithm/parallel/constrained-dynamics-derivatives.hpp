@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <cstddef>
+#include <vector>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+#include "pinocchio/unsupported.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/multibody/pool.hpp"
+#include "pinocchio/algorithm/constrained-dynamics.hpp"
+#include "pinocchio/algorithm/constrained-dynamics-derivatives.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief A parallel version of the derivatives of the constrained dynamics. For each element of
+  /// the batch, it calls constraintDynamics followed by computeConstraintDynamicsDerivatives.
+  ///
+  /// The partial derivatives of the i-th element of the batch are stored in the i-th block of
+  /// model.nv columns of the stacked outputs, i.e. ddq_partial_dq.middleCols(i * model.nv,
+  /// model.nv). The outputs are written in place: no memory is allocated once the pool, the
+  /// contact datas and the outputs have been allocated.
+  ///
+  /// \note initConstraintDynamics must have been called with contact_models on the data of the
+  /// pool associated to each thread.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorPool Matrix type of the joint configuration vector.
+  /// \tparam TangentVectorPool1 Matrix type of the joint velocity vector.
+  /// \tparam TangentVectorPool2 Matrix type of the joint torque vector.
+  /// \tparam MatrixPool1 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint configuration vector.
+  /// \tparam MatrixPool2 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint velocity vector.
+  /// \tparam MatrixPool3 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint torque vector.
+  /// \tparam MatrixPool4 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint configuration vector.
+  /// \tparam MatrixPool5 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint velocity vector.
+  /// \tparam MatrixPool6 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint torque vector.
+  ///
+  /// \param[in] num_threads Number of threads used for parallel computations.
+  /// \param[in] pool Pool containing model and data for parallel computations.
+  /// \param[in] q The joint configuration vector (dim model.nq x batch_size).
+  /// \param[in] v The joint velocity vector (dim model.nv x batch_size).
+  /// \param[in] tau The joint torque vector (dim model.nv x batch_size).
+  /// \param[in] contact_models Vector of contact models, shared by all the elements of the batch.
+  /// \param[in] contact_datas Vectors of contact data, one per thread (size at least num_threads).
+  /// \param[in] settings Proximal settings, copied by each thread.
+  /// \param[out] ddq_partial_dq Stacked joint acceleration derivatives with respect to the joint
+  /// configuration (dim model.nv x model.nv * batch_size).
+  /// \param[out] ddq_partial_dv Stacked joint acceleration derivatives with respect to the joint
+  /// velocity (dim model.nv x model.nv * batch_size).
+  /// \param[out] ddq_partial_dtau Stacked joint acceleration derivatives with respect to the joint
+  /// torque (dim model.nv x model.nv * batch_size).
+  /// \param[out] lambda_partial_dq Stacked contact force derivatives with respect to the joint
+  /// configuration (dim nc x model.nv * batch_size).
+  /// \param[out] lambda_partial_dv Stacked contact force derivatives with respect to the joint
+  /// velocity (dim nc x model.nv * batch_size).
+  /// \param[out] lambda_partial_dtau Stacked contact force derivatives with respect to the joint
+  /// torque (dim nc x model.nv * batch_size).
+  ///
+  /// \note This overload relies on an OpenMPExecutor with a static scheduling.
+  ///
+  /// \sa pinocchio::computeConstraintDynamicsDerivatives
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    class ConstraintModelAllocator,
+    class ConstraintDataAllocator,
+    class ConstraintDataVectorAllocator,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3,
+    typename MatrixPool4,
+    typename MatrixPool5,
+    typename MatrixPool6>
+  PINOCCHIO_UNSUPPORTED_MESSAGE("The API will change towards more flexibility")
+  void computeConstraintDynamicsDerivativesInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ConstraintModelAllocator> &
+      contact_models,
+    std::vector<
+      std::vector<RigidConstraintDataTpl<Scalar, Options>, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & contact_datas,
+    const ProximalSettingsTpl<Scalar> & settings,
+    const Eigen::MatrixBase<MatrixPool1> & ddq_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & ddq_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & ddq_partial_dtau,
+    const Eigen::MatrixBase<MatrixPool4> & lambda_partial_dq,
+    const Eigen::MatrixBase<MatrixPool5> & lambda_partial_dv,
+    const Eigen::MatrixBase<MatrixPool6> & lambda_partial_dtau);
+
+  ///
+  /// \brief A parallel version of the derivatives of the constrained dynamics. For each element of
+  /// the batch, it calls constraintDynamics followed by computeConstraintDynamicsDerivatives.
+  ///
+  /// The partial derivatives of the i-th element of the batch are stored in the i-th block of
+  /// model.nv columns of the stacked outputs, i.e. ddq_partial_dq.middleCols(i * model.nv,
+  /// model.nv). The outputs are written in place: no memory is allocated once the pool, the
+  /// contact datas and the outputs have been allocated.
+  ///
+  /// \note initConstraintDynamics must have been called with contact_models on the data of the
+  /// pool associated to each thread.
+  ///
+  /// \tparam Executor Type of the executor.
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorPool Matrix type of the joint configuration vector.
+  /// \tparam TangentVectorPool1 Matrix type of the joint velocity vector.
+  /// \tparam TangentVectorPool2 Matrix type of the joint torque vector.
+  /// \tparam MatrixPool1 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint configuration vector.
+  /// \tparam MatrixPool2 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint velocity vector.
+  /// \tparam MatrixPool3 Matrix type of the stacked joint acceleration derivatives with respect to
+  /// the joint torque vector.
+  /// \tparam MatrixPool4 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint configuration vector.
+  /// \tparam MatrixPool5 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint velocity vector.
+  /// \tparam MatrixPool6 Matrix type of the stacked contact force derivatives with respect to the
+  /// joint torque vector.
+  ///
+  /// \param[in] executor Executor distributing the batch over the threads (see ExecutorBase).
+  /// \param[in] pool Pool containing model and data for parallel computations.
+  /// \param[in] q The joint configuration vector (dim model.nq x batch_size).
+  /// \param[in] v The joint velocity vector (dim model.nv x batch_size).
+  /// \param[in] tau The joint torque vector (dim model.nv x batch_size).
+  /// \param[in] contact_models Vector of contact models, shared by all the elements of the batch.
+  /// \param[in] contact_datas Vectors of contact data, one per thread (size at least
+  /// executor.numThreads()).
+  /// \param[in] settings Proximal settings, copied by each thread.
+  /// \param[out] ddq_partial_dq Stacked joint acceleration derivatives with respect to the joint
+  /// configuration (dim model.nv x model.nv * batch_size).
+  /// \param[out] ddq_partial_dv Stacked joint acceleration derivatives with respect to the joint
+  /// velocity (dim model.nv x model.nv * batch_size).
+  /// \param[out] ddq_partial_dtau Stacked joint acceleration derivatives with respect to the joint
+  /// torque (dim model.nv x model.nv * batch_size).
+  /// \param[out] lambda_partial_dq Stacked contact force derivatives with respect to the joint
+  /// configuration (dim nc x model.nv * batch_size).
+  /// \param[out] lambda_partial_dv Stacked contact force derivatives with respect to the joint
+  /// velocity (dim nc x model.nv * batch_size).
+  /// \param[out] lambda_partial_dtau Stacked contact force derivatives with respect to the joint
+  /// torque (dim nc x model.nv * batch_size).
+  ///
+  /// \sa pinocchio::computeConstraintDynamicsDerivatives
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    class ConstraintModelAllocator,
+    class ConstraintDataAllocator,
+    class ConstraintDataVectorAllocator,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3,
+    typename MatrixPool4,
+    typename MatrixPool5,
+    typename MatrixPool6>
+  PINOCCHIO_UNSUPPORTED_MESSAGE("The API will change towards more flexibility")
+  void computeConstraintDynamicsDerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ConstraintModelAllocator> &
+      contact_models,
+    std::vector<
+      std::vector<RigidConstraintDataTpl<Scalar, Options>, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & contact_datas,
+    const ProximalSettingsTpl<Scalar> & settings,
+    const Eigen::MatrixBase<MatrixPool1> & ddq_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & ddq_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & ddq_partial_dtau,
+    const Eigen::MatrixBase<MatrixPool4> & lambda_partial_dq,
+    const Eigen::MatrixBase<MatrixPool5> & lambda_partial_dv,
+    const Eigen::MatrixBase<MatrixPool6> & lambda_partial_dtau);
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/constrained-dynamics-derivatives.hxx"
+// IWYU pragma: end_exports
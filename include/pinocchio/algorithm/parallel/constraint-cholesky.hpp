@@ -0,0 +1,106 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/utils/reference.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/multibody/fwd.hpp"
+#include "pinocchio/algorithm/constraint-cholesky.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief A parallel version of ConstraintCholeskyDecompositionTpl::compute.
+  ///
+  /// The factorization is split in three stages:
+  ///   - the columns of the mass matrix part are eliminated level by level along the elimination
+  ///     tree given by model.parents: the columns of a level belong to disjoint subtrees and are
+  ///     factorized concurrently;
+  ///   - the constraint rows only depend on the factorized mass matrix part. Each constraint is
+  ///     processed independently as a dense block of rows (supernode), skipping the columns lying
+  ///     outside of its sparsity pattern;
+  ///   - the Delassus block is assembled by blocks of rows, one per constraint.
+  /// The Cholesky decomposition of the (dense) Delassus block is then performed on the calling
+  /// thread.
+  ///
+  /// \tparam Executor Type of the executor.
+  /// \tparam JointCollection Collection of Joint types.
+  ///
+  /// \param[in] executor Executor distributing the work over the threads (see ExecutorBase).
+  /// \param[in] model Model of the dynamical system.
+  /// \param[in] data Data related to model containing the computed mass matrix and the Jacobian of
+  /// the kinematic tree.
+  /// \param[in] constraint_models Vector of constraint models.
+  /// \param[in] constraint_datas Vector of constraint datas related to constraint_models.
+  /// \param[in,out] chol Decomposition previously built with constraint_models.
+  /// \param[in] apply_on_the_right compute quantities related to applyOnTheRight.
+  /// \param[in] solve_in_place compute quantities related to solveInPlace.
+  ///
+  /// \remarks The result matches the one of the serial ConstraintCholeskyDecompositionTpl::compute
+  /// up to round-off errors. The speed-up is significant for large constraint systems, where the
+  /// constraint part dominates the cost of the factorization.
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  void computeConstraintCholeskyInParallel(
+    ExecutorBase<Executor> & executor,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
+    const bool apply_on_the_right = true,
+    const bool solve_in_place = true);
+
+  ///
+  /// \brief A parallel version of ConstraintCholeskyDecompositionTpl::compute.
+  ///
+  /// \param[in] num_threads Number of threads used for parallel computations.
+  ///
+  /// \note This overload relies on an OpenMPExecutor with a static scheduling.
+  ///
+  /// \sa computeConstraintCholeskyInParallel(ExecutorBase<Executor> &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  void computeConstraintCholeskyInParallel(
+    const size_t num_threads,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
+    const bool apply_on_the_right = true,
+    const bool solve_in_place = true);
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/constraint-cholesky.hxx"
+// IWYU pragma: end_exports
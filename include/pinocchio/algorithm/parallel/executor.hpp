@@ -0,0 +1,29 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+// IWYU pragma: end_keep
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/executor.hxx"
+// IWYU pragma: end_exports
@@ -0,0 +1,138 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/utils/reference.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/multibody/fwd.hpp"
+#include "pinocchio/algorithm/solvers/fwd.hpp"
+#include "pinocchio/algorithm/solvers/pgs-solver.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief Greedy coloring of the coupling graph of the constraints.
+  ///
+  /// Two constraints are coupled when they share at least one supporting joint, i.e. when the
+  /// corresponding block of the Delassus matrix is not structurally zero. Constraints sharing
+  /// the same color are pairwise uncoupled and can be updated concurrently by the PGS solver.
+  ///
+  /// \param[in] model Model of the dynamical system.
+  /// \param[in] data Data related to model.
+  /// \param[in] constraint_models Vector of constraint models.
+  /// \param[in] constraint_datas Vector of constraint datas related to constraint_models.
+  /// \param[out] constraint_colors Color of each constraint, in [0, num_colors).
+  ///
+  /// \returns The number of colors.
+  ///
+  /// \remarks The constraints of a floating base system all share the floating base joint and
+  /// thus get distinct colors. The coloring is useful for scenes made of several independent
+  /// kinematic trees, e.g. many free-floating objects in contact.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  std::size_t computeConstraintGraphColoring(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    std::vector<std::size_t> & constraint_colors);
+
+  ///
+  /// \brief Solves a single constraint problem with the PGS solver, updating the constraints of a
+  /// same color concurrently.
+  ///
+  /// The colors are processed sequentially, in increasing order. Within a color, the constraint
+  /// velocities are first computed from the current impulses, then the projection steps are
+  /// performed in parallel. As the constraints of a same color are uncoupled, this is equivalent
+  /// to a sequential Gauss-Seidel sweep ordered by colors. The stopping criteria are the ones of
+  /// PGSConstraintSolverTpl::solve and rely on the same settings.
+  ///
+  /// \param[in] executor Executor distributing the constraints of a color over the threads.
+  /// \param[in,out] solver PGS solver.
+  /// \param[in] delassus Delassus operator of the problem.
+  /// \param[in] g Free velocity of the constraints.
+  /// \param[in] constraint_models Vector of constraint models.
+  /// \param[in] constraint_datas Vector of constraint datas related to constraint_models.
+  /// \param[in] constraint_colors Coloring of the constraints, typically obtained with
+  /// computeConstraintGraphColoring.
+  /// \param[in] settings Settings of the PGS solver.
+  /// \param[in,out] result Result of the solver, possibly containing a warm start.
+  ///
+  /// \returns True if the solver has converged.
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    typename DelassusDerived,
+    typename VectorLike,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  bool solveConstraintProblemInParallel(
+    ExecutorBase<Executor> & executor,
+    PGSConstraintSolverTpl<Scalar, Options> & solver,
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const std::vector<std::size_t> & constraint_colors,
+    const PGSSolverSettingsTpl<Scalar> & settings,
+    PGSSolverResultTpl<Scalar, Options> & result);
+
+  ///
+  /// \brief Solves a single constraint problem with the PGS solver, updating the constraints of a
+  /// same color concurrently.
+  ///
+  /// \param[in] num_threads Number of threads used for the parallel computations.
+  ///
+  /// \note This overload relies on an OpenMPExecutor with a static scheduling.
+  ///
+  /// \sa solveConstraintProblemInParallel(ExecutorBase<Executor> &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    typename DelassusDerived,
+    typename VectorLike,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  bool solveConstraintProblemInParallel(
+    const size_t num_threads,
+    PGSConstraintSolverTpl<Scalar, Options> & solver,
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const std::vector<std::size_t> & constraint_colors,
+    const PGSSolverSettingsTpl<Scalar> & settings,
+    PGSSolverResultTpl<Scalar, Options> & result);
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/pgs-solver.hxx"
+// IWYU pragma: end_exports
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <cstddef>
+
+#include <omp.h>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
+#include "pinocchio/multibody/pool.hpp"
+#include "pinocchio/algorithm/rnea-derivatives.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief A parallel version of the derivatives of the Recursive Newton-Euler algorithm.
+  ///
+  /// The partial derivatives of the i-th element of the batch are stored in the i-th block of
+  /// model.nv columns of the stacked outputs, i.e. rnea_partial_dq.middleCols(i * model.nv,
+  /// model.nv). The outputs are written in place: no memory is allocated once the pool and the
+  /// outputs have been allocated.
+  ///
+  /// \remarks Contrary to computeRNEADerivatives, the outputs do not need to be initialized with
+  /// zeros. As for pinocchio::crba, only the upper triangular part of each block of
+  /// rnea_partial_da is filled.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorPool Matrix type of the joint configuration vector.
+  /// \tparam TangentVectorPool1 Matrix type of the joint velocity vector.
+  /// \tparam TangentVectorPool2 Matrix type of the joint acceleration vector.
+  /// \tparam MatrixPool1 Matrix type of the stacked partial derivatives with respect to the joint
+  /// configuration vector.
+  /// \tparam MatrixPool2 Matrix type of the stacked partial derivatives with respect to the joint
+  /// velocity vector.
+  /// \tparam MatrixPool3 Matrix type of the stacked partial derivatives with respect to the joint
+  /// acceleration vector.
+  ///
+  /// \param[in] num_threads Number of threads used for parallel computations.
+  /// \param[in] pool Pool containing model and data for parallel computations.
+  /// \param[in] q The joint configuration vector (dim model.nq x batch_size).
+  /// \param[in] v The joint velocity vector (dim model.nv x batch_size).
+  /// \param[in] a The joint acceleration vector (dim model.nv x batch_size).
+  /// \param[out] rnea_partial_dq Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint configuration (dim model.nv x model.nv * batch_size).
+  /// \param[out] rnea_partial_dv Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint velocity (dim model.nv x model.nv * batch_size).
+  /// \param[out] rnea_partial_da Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint acceleration (dim model.nv x model.nv * batch_size).
+  ///
+  /// \note This overload relies on an OpenMPExecutor with a static scheduling.
+  ///
+  /// \sa pinocchio::computeRNEADerivatives
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeRNEADerivativesInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<MatrixPool1> & rnea_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & rnea_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & rnea_partial_da);
+
+  ///
+  /// \brief A parallel version of the derivatives of the Recursive Newton-Euler algorithm.
+  ///
+  /// The partial derivatives of the i-th element of the batch are stored in the i-th block of
+  /// model.nv columns of the stacked outputs, i.e. rnea_partial_dq.middleCols(i * model.nv,
+  /// model.nv). The outputs are written in place: no memory is allocated once the pool and the
+  /// outputs have been allocated.
+  ///
+  /// \remarks Contrary to computeRNEADerivatives, the outputs do not need to be initialized with
+  /// zeros. As for pinocchio::crba, only the upper triangular part of each block of
+  /// rnea_partial_da is filled.
+  ///
+  /// \tparam Executor Type of the executor.
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorPool Matrix type of the joint configuration vector.
+  /// \tparam TangentVectorPool1 Matrix type of the joint velocity vector.
+  /// \tparam TangentVectorPool2 Matrix type of the joint acceleration vector.
+  /// \tparam MatrixPool1 Matrix type of the stacked partial derivatives with respect to the joint
+  /// configuration vector.
+  /// \tparam MatrixPool2 Matrix type of the stacked partial derivatives with respect to the joint
+  /// velocity vector.
+  /// \tparam MatrixPool3 Matrix type of the stacked partial derivatives with respect to the joint
+  /// acceleration vector.
+  ///
+  /// \param[in] executor Executor distributing the batch over the threads (see ExecutorBase).
+  /// \param[in] pool Pool containing model and data for parallel computations.
+  /// \param[in] q The joint configuration vector (dim model.nq x batch_size).
+  /// \param[in] v The joint velocity vector (dim model.nv x batch_size).
+  /// \param[in] a The joint acceleration vector (dim model.nv x batch_size).
+  /// \param[out] rnea_partial_dq Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint configuration (dim model.nv x model.nv * batch_size).
+  /// \param[out] rnea_partial_dv Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint velocity (dim model.nv x model.nv * batch_size).
+  /// \param[out] rnea_partial_da Stacked partial derivatives of the joint torque vector with
+  /// respect to the joint acceleration (dim model.nv x model.nv * batch_size).
+  ///
+  /// \sa pinocchio::computeRNEADerivatives
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeRNEADerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<MatrixPool1> & rnea_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & rnea_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & rnea_partial_da);
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/parallel/rnea-derivatives.hxx"
+// IWYU pragma: end_exports
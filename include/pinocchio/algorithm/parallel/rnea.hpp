@@ -13,6 +13,7 @@
 #include "pinocchio/macros.hpp"
 
 #include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
 #include "pinocchio/multibody/pool.hpp"
 #include "pinocchio/algorithm/rnea.hpp"
 // IWYU pragma: end_keep
@@ -36,6 +37,8 @@ namespace pinocchio
   /// \param[in] a The joint acceleration vector (dim model.nv x batch_size).
   /// \param[out] tau The joint torque vector (dim model.nv x batch_size).
   ///
+  /// \note This overload relies on an OpenMPExecutor with a static scheduling.
+  ///
   template<
     typename Scalar,
     int Options,
@@ -51,6 +54,41 @@ namespace pinocchio
     const Eigen::MatrixBase<TangentVectorPool1> & v,
     const Eigen::MatrixBase<TangentVectorPool2> & a,
     const Eigen::MatrixBase<TangentVectorPool3> & tau);
+
+  ///
+  /// \brief The Recursive Newton-Euler algorithm. It computes the inverse dynamics, aka the joint
+  /// torques according to the current state of the system and the desired joint accelerations.
+  ///
+  /// \tparam Executor Type of the executor.
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorPool Matrix type of the joint configuration vector.
+  /// \tparam TangentVectorPool1 Matrix type of the joint velocity vector.
+  /// \tparam TangentVectorPool2 Matrix type of the joint acceleration vector.
+  /// \tparam TangentVectorPool3 Matrix type of the joint torque vector.
+  ///
+  /// \param[in] pool Pool containing model and data for parallel computations.
+  /// \param[in] executor Executor distributing the batch over the threads (see ExecutorBase).
+  /// \param[in] q The joint configuration vector (dim model.nq x batch_size).
+  /// \param[in] v The joint velocity vector (dim model.nv x batch_size).
+  /// \param[in] a The joint acceleration vector (dim model.nv x batch_size).
+  /// \param[out] tau The joint torque vector (dim model.nv x batch_size).
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename TangentVectorPool3>
+  void rneaInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<TangentVectorPool3> & tau);
 } // namespace pinocchio
 
 // IWYU pragma: begin_exports
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/utils/check.hpp"
+
+#include "pinocchio/algorithm/solvers/fwd.hpp"
+#include "pinocchio/algorithm/solvers/admm-solver.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief Mixed-precision ADMM constraint solver.
+  ///
+  /// The bulk of the ADMM iterations is performed in LowScalar precision (typically float), which
+  /// halves the memory traffic of the Delassus applications and solves. The low precision
+  /// solution, together with the final value of rho, then warm-starts an ADMM solve in Scalar
+  /// precision which acts as an iterative refinement step and restores the requested accuracy.
+  /// The accuracy actually achieved is reported by ADMMSolverResultTpl::residual.
+  ///
+  /// \remarks The low precision problem is provided by the user: the constraint sets may depend
+  /// on the constraint datas (e.g. joint limits), which thus have to be computed in LowScalar
+  /// precision as well. A dense low precision Delassus can be obtained by casting
+  /// delassus.matrix() and the constraint models with cast<LowScalar>().
+  ///
+  template<typename _Scalar, typename _LowScalar, int _Options>
+  struct ADMMMixedPrecisionConstraintSolverTpl
+  {
+    typedef _Scalar Scalar;
+    typedef _LowScalar LowScalar;
+    static constexpr int Options = _Options;
+
+    typedef ADMMConstraintSolverTpl<Scalar, Options> ADMMConstraintSolver;
+    typedef ADMMSolverSettingsTpl<Scalar> ADMMSolverSettings;
+    typedef ADMMSolverResultTpl<Scalar, Options> ADMMSolverResult;
+
+    typedef ADMMConstraintSolverTpl<LowScalar, Options> LowPrecisionADMMConstraintSolver;
+    typedef ADMMSolverSettingsTpl<LowScalar> LowPrecisionADMMSolverSettings;
+    typedef ADMMSolverResultTpl<LowScalar, Options> LowPrecisionADMMSolverResult;
+
+    typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1, Options> VectorXs;
+    typedef Eigen::Matrix<LowScalar, Eigen::Dynamic, 1, Options> VectorXl;
+
+    /// \brief Default constructor.
+    ///
+    /// \param[in] max_problem_size problem size used to preallocate the workspaces of the solvers.
+    ///
+    explicit ADMMMixedPrecisionConstraintSolverTpl(std::size_t max_problem_size = 0)
+    : solver(max_problem_size)
+    , low_precision_solver(max_problem_size)
+    , low_precision_tolerance(Scalar(100) * Scalar(Eigen::NumTraits<LowScalar>::epsilon()))
+    {
+    }
+
+    ///
+    /// \brief Solves the constraint problem, first in LowScalar and then in Scalar precision.
+    ///
+    /// \param[in] low_precision_delassus Delassus operator of the problem in LowScalar precision.
+    /// \param[in] low_precision_constraint_models Constraint models in LowScalar precision.
+    /// \param[in] low_precision_constraint_datas Constraint datas in LowScalar precision.
+    /// \param[in] delassus Delassus operator of the problem.
+    /// \param[in] g Free velocity of the constraints.
+    /// \param[in] constraint_models Vector of constraint models.
+    /// \param[in] constraint_datas Vector of constraint datas related to constraint_models.
+    /// \param[in] settings Settings of the solver. The tolerances of the low precision solve are
+    /// bounded from below by low_precision_tolerance.
+    /// \param[in,out] result Result of the solver, possibly containing a warm start which is then
+    /// used by the low precision solve.
+    ///
+    /// \returns True if the refinement step has converged.
+    ///
+    template<
+      typename LowPrecisionDelassusDerived,
+      typename LowPrecisionConstraintModel,
+      typename LowPrecisionConstraintModelAllocator,
+      typename LowPrecisionConstraintData,
+      typename LowPrecisionConstraintDataAllocator,
+      typename DelassusDerived,
+      typename VectorLike,
+      typename ConstraintModel,
+      typename ConstraintModelAllocator,
+      typename ConstraintData,
+      typename ConstraintDataAllocator>
+    bool solve(
+      DelassusOperatorBase<LowPrecisionDelassusDerived> & low_precision_delassus,
+      const std::vector<LowPrecisionConstraintModel, LowPrecisionConstraintModelAllocator> &
+        low_precision_constraint_models,
+      const std::vector<LowPrecisionConstraintData, LowPrecisionConstraintDataAllocator> &
+        low_precision_constraint_datas,
+      DelassusOperatorBase<DelassusDerived> & delassus,
+      const Eigen::MatrixBase<VectorLike> & g,
+      const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+      const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+      const ADMMSolverSettings & settings,
+      ADMMSolverResult & result);
+
+    /// \brief ADMM solver performing the refinement step in Scalar precision.
+    ADMMConstraintSolver solver;
+
+    /// \brief ADMM solver performing the bulk of the iterations in LowScalar precision.
+    LowPrecisionADMMConstraintSolver low_precision_solver;
+
+    /// \brief Result of the low precision solve.
+    /// It is kept between two calls to solve so that rho can be warm-started in low precision.
+    LowPrecisionADMMSolverResult low_precision_result;
+
+    /// \brief Lower bound on the tolerances of the low precision solve.
+    /// Tighter tolerances cannot be reached in LowScalar precision and would only waste
+    /// iterations.
+    Scalar low_precision_tolerance;
+
+  protected:
+    /// \brief Free velocity of the constraints in LowScalar precision.
+    VectorXl m_low_precision_g;
+
+    /// \brief Guesses transferred between the two precisions.
+    VectorXl m_low_precision_guess;
+    VectorXs m_guess;
+  }; // struct ADMMMixedPrecisionConstraintSolverTpl
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/algorithm/solvers/admm-solver-mixed-precision.hxx"
+// IWYU pragma: end_exports
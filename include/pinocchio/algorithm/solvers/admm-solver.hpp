@@ -170,6 +170,16 @@ namespace pinocchio
       return m_is_valid;
     }
 
+    /// \brief Reserve the workspace of the solver for problems of size up to max_problem_size.
+    /// Once reserved, solving a problem of smaller size does not allocate any memory, as long as
+    /// the initial rho does not have to be estimated with a Lanczos decomposition (i.e. it is
+    /// provided by the settings or warm-started from the result) and the Anderson acceleration
+    /// is disabled.
+    void reserve(std::size_t max_problem_size)
+    {
+      m_workspace.reserve(max_problem_size);
+    }
+
     template<
       typename DelassusDerived,
       typename VectorLike,
@@ -206,6 +216,9 @@ namespace pinocchio
     bool m_is_valid;
 
     /// \brief Compute largest eigen value of delassus.
+    /// Operators caching a spectral estimate across time steps, such as
+    /// DelassusOperatorRigidBodySystemsTpl, refresh it with warm-started power iterations instead
+    /// of computing a new Lanczos decomposition.
     template<typename DelassusDerived>
     static Scalar computeDelassusLargestEigenvalue(
       const DelassusOperatorBase<DelassusDerived> & delassus, ADMMSolverWorkspace & workspace);
@@ -313,6 +326,31 @@ namespace pinocchio
     {
     }
 
+    /// \brief Returns the settings casted to NewScalar.
+    template<typename NewScalar>
+    ADMMSolverSettingsTpl<NewScalar> cast() const
+    {
+      typedef ADMMSolverSettingsTpl<NewScalar> ReturnType;
+      std::optional<NewScalar> rho_init_ = std::nullopt;
+      if (rho_init)
+        rho_init_ = static_cast<NewScalar>(rho_init.value());
+      return ReturnType(
+        max_iterations, static_cast<NewScalar>(absolute_feasibility_tol),
+        static_cast<NewScalar>(relative_feasibility_tol),
+        static_cast<NewScalar>(absolute_complementarity_tol),
+        static_cast<NewScalar>(relative_complementarity_tol), solve_ncp, measure_timings,
+        stat_record, rho_init_, warmstart_rho_with_previous_result, admm_update_rule,
+        admm_proximal_rule, static_cast<NewScalar>(mu_prox), static_cast<NewScalar>(tau_prox),
+        static_cast<NewScalar>(tau), static_cast<NewScalar>(ratio_primal_dual),
+        static_cast<NewScalar>(dual_momentum), static_cast<NewScalar>(rho_update_ratio),
+        rho_min_update_frequency, static_cast<NewScalar>(rho_momentum),
+        static_cast<NewScalar>(rho_min), static_cast<NewScalar>(rho_max),
+        static_cast<NewScalar>(spectral_rho_power_init),
+        static_cast<NewScalar>(spectral_rho_power_factor),
+        static_cast<NewScalar>(linear_update_rule_factor), lanczos_size,
+        max_delassus_decomposition_updates, anderson_capacity);
+    }
+
     void checkValidityImpl() const
     {
       if (rho_init)
@@ -483,6 +521,7 @@ namespace pinocchio
     , rho(std::numeric_limits<Scalar>::quiet_NaN())
     , spectral_rho_power(std::numeric_limits<Scalar>::quiet_NaN())
     , mu_prox(std::numeric_limits<Scalar>::quiet_NaN())
+    , residual(std::numeric_limits<Scalar>::quiet_NaN())
     {
     }
 
@@ -503,6 +542,7 @@ namespace pinocchio
         rho = other.rho;
         spectral_rho_power = other.spectral_rho_power;
         mu_prox = other.mu_prox;
+        residual = other.residual;
 
         // Since some members are maps reference on EigenStorage, we cannot simply copy them.
         // Thus we need to explicitly say we copy the storage, and the maps will automatically point
@@ -550,6 +590,7 @@ namespace pinocchio
       rho = std::numeric_limits<Scalar>::quiet_NaN();
       spectral_rho_power = std::numeric_limits<Scalar>::quiet_NaN();
       mu_prox = std::numeric_limits<Scalar>::quiet_NaN();
+      residual = std::numeric_limits<Scalar>::quiet_NaN();
 
       // set solution to nan - solver has not run
       x.setConstant(std::numeric_limits<Scalar>::quiet_NaN());
@@ -570,6 +611,19 @@ namespace pinocchio
       desaxce_storage.resize(np);
     }
 
+    /// \brief Reserve the vectors of the solution and of the warm starts for problems of size up
+    /// to max_problem_size, so that resizing them afterwards does not allocate any memory.
+    void reserve(std::size_t max_problem_size)
+    {
+      const Eigen::Index np = static_cast<Eigen::Index>(max_problem_size);
+      x_storage.reserve(np);
+      y_storage.reserve(np);
+      z_storage.reserve(np);
+      desaxce_storage.reserve(np);
+      m_impulse_guess_storage.reserve(np);
+      m_velocity_guess_storage.reserve(np);
+    }
+
     /// \brief Retrieve non-projected primal solution.
     template<typename VectorLike>
     void retrieveNonProjectedPrimalSolution(
@@ -693,6 +747,12 @@ namespace pinocchio
     /// \brief Value of ADMM proximal term.
     Scalar mu_prox;
 
+    /// \brief Infinity norm of the optimality residual `Gy + g + desaxce - z` at the solution,
+    /// with `G` the undamped Delassus operator.
+    /// \note Unlike the feasibility criteria, it does not depend on rho or mu_prox and measures
+    /// the accuracy actually achieved in Scalar precision.
+    Scalar residual;
+
     /// \brief Non-projected primal solution.
     /// \note Order of storage/map declaration is important!
     /// First declare the storage, then the map, otherwise map will point to nothing.
@@ -948,7 +1008,37 @@ namespace pinocchio
         anderson_primal_feasibility_vector_storage.resize(np);
         dual_feasibility_vector_storage.resize(np);
 
-        // resize lanczos
+        // The lanczos decomposition is only resized when it is actually used, see
+        // resizeLanczosDecomposition, as it cannot be resized without memory allocations.
+
+        // resize anderson
+        anderson_history.reserve(problem_size, anderson_capacity);
+      }
+
+      /// \brief Reserve the workspace vectors for problems of size up to max_problem_size.
+      /// Resizing the workspace to a smaller problem size then does not allocate any memory.
+      void reserve(std::size_t max_problem_size)
+      {
+        const Eigen::Index np = static_cast<Eigen::Index>(max_problem_size);
+        x_storage.reserve(np);
+        x_anderson_storage.reserve(np);
+        y_storage.reserve(np);
+        x_previous_storage.reserve(np);
+        y_previous_storage.reserve(np);
+        z_storage.reserve(np);
+        z_anderson_storage.reserve(np);
+        z_previous_storage.reserve(np);
+        desaxce_storage.reserve(np);
+        rhs_storage.reserve(np);
+        tmp_storage.reserve(np);
+        primal_feasibility_vector_storage.reserve(np);
+        anderson_primal_feasibility_vector_storage.reserve(np);
+        dual_feasibility_vector_storage.reserve(np);
+      }
+
+      /// \brief Resize the lanczos decomposition to the current problem and lanczos sizes.
+      void resizeLanczosDecomposition()
+      {
         const std::size_t lanczos_problem_size = math::max(std::size_t(2), problem_size);
         if (
           lanczos_decomposition.size() != static_cast<Eigen::Index>(lanczos_problem_size)
@@ -958,9 +1048,6 @@ namespace pinocchio
             static_cast<Eigen::Index>(lanczos_problem_size),
             static_cast<Eigen::Index>(lanczos_size));
         }
-
-        // resize anderson
-        anderson_history.reserve(problem_size, anderson_capacity);
       }
 
       /// \brief Size of problem.
@@ -44,4 +44,17 @@ namespace pinocchio
   struct ADMMSolverStatsTpl;
   typedef ADMMSolverStatsTpl<context::Scalar> ADMMSolverStats;
 
+  template<typename Scalar, int Options>
+  class ADMMConstraintSolverPoolTpl;
+  typedef ADMMConstraintSolverPoolTpl<context::Scalar, context::Options> ADMMConstraintSolverPool;
+
+  template<typename Scalar>
+  struct ADMMBatchSolverStatsTpl;
+  typedef ADMMBatchSolverStatsTpl<context::Scalar> ADMMBatchSolverStats;
+
+  template<typename Scalar, typename LowScalar, int Options>
+  struct ADMMMixedPrecisionConstraintSolverTpl;
+  typedef ADMMMixedPrecisionConstraintSolverTpl<context::Scalar, float, context::Options>
+    ADMMMixedPrecisionConstraintSolver;
+
 } // namespace pinocchio
@@ -43,6 +43,12 @@ namespace pinocchio
     struct PGSSolverWorkspaceTpl;
   }
 
+  namespace details
+  {
+    template<typename Scalar, int Options>
+    struct PGSConstraintSolverInParallelAlgo;
+  }
+
   template<typename _Scalar, int _Options>
   struct traits<PGSConstraintSolverTpl<_Scalar, _Options>>
   {
@@ -98,6 +104,13 @@ namespace pinocchio
       return m_is_valid;
     }
 
+    /// \brief Reserve the workspace of the solver for problems of size up to max_problem_size.
+    /// Once reserved, solving a problem of smaller size does not allocate any memory.
+    void reserve(std::size_t max_problem_size)
+    {
+      m_workspace.reserve(max_problem_size);
+    }
+
     template<
       typename DelassusDerived,
       typename VectorLike,
@@ -124,6 +137,28 @@ namespace pinocchio
     PGSSolverStats stats;
 
   protected:
+    friend struct details::PGSConstraintSolverInParallelAlgo<Scalar, Options>;
+
+    /// \brief Runs the PGS iterations and checks the stopping criteria after each call to
+    /// sweep(G, workspace, result), which performs a projection step on every constraint and
+    /// updates the feasibility values stored in result.
+    template<
+      typename DelassusDerived,
+      typename VectorLike,
+      typename ConstraintModel,
+      typename ConstraintModelAllocator,
+      typename ConstraintData,
+      typename ConstraintDataAllocator,
+      typename SweepFunction>
+    bool solveLoop(
+      DelassusOperatorBase<DelassusDerived> & delassus,
+      const Eigen::MatrixBase<VectorLike> & g,
+      const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+      const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+      const PGSSolverSettings & settings,
+      PGSSolverResult & result,
+      const SweepFunction & sweep);
+
     /// \brief Workspace of the PGS solver.
     /// This is an internal of the solver and is not meant to be accessed by
     /// users.
@@ -309,6 +344,16 @@ namespace pinocchio
       y_storage.resize(np);
     }
 
+    /// \brief Reserve the vectors of the solution and of the warm start for problems of size up
+    /// to max_problem_size, so that resizing them afterwards does not allocate any memory.
+    void reserve(std::size_t max_problem_size)
+    {
+      const Eigen::Index np = static_cast<Eigen::Index>(max_problem_size);
+      x_storage.reserve(np);
+      y_storage.reserve(np);
+      m_impulse_guess_storage.reserve(np);
+    }
+
     /// \brief Retrieve primal solution.
     template<typename VectorLike>
     void retrievePrimalSolution(const Eigen::MatrixBase<VectorLike> & primal_solution_) const
@@ -545,6 +590,19 @@ namespace pinocchio
         rhs_storage.resize(np);
       }
 
+      /// \brief Reserve the workspace for problems of size up to max_problem_size.
+      /// Resizing the workspace to a smaller problem size then does not allocate any memory.
+      void reserve(std::size_t max_problem_size)
+      {
+        const Eigen::Index np = static_cast<Eigen::Index>(max_problem_size);
+        delassus_matrix_storage.reserve(np, np);
+        x_storage.reserve(np);
+        x_previous_storage.reserve(np);
+        y_storage.reserve(np);
+        tmp_storage.reserve(np);
+        rhs_storage.reserve(np);
+      }
+
       /// \brief Size of problem.
       std::size_t problem_size;
 
@@ -0,0 +1,93 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <Eigen/Core>
+
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/multibody.hpp"
+#include "pinocchio/geometry.hpp"
+#include "pinocchio/algorithm/geometry.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include "pinocchio/collision/config.hpp"
+#include "pinocchio/collision/collision.hpp"
+#include "pinocchio/collision/distance.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+  ///
+  /// \brief Settings of computeCollisionPairPruning.
+  ///
+  struct CollisionPairPruningSettings
+  {
+    CollisionPairPruningSettings()
+    : num_samples(1000)
+    , max_num_boxes(1000)
+    , security_margin(0.)
+    {
+    }
+
+    /// \brief Number of random configurations used to discard the collision pairs which can be
+    /// in collision before trying to certify the other ones.
+    std::size_t num_samples;
+
+    /// \brief Maximal number of boxes of joint configurations evaluated to certify a collision
+    /// pair. A pair which cannot be certified within this budget is kept.
+    std::size_t max_num_boxes;
+
+    /// \brief Minimal distance between the geometries of a pruned collision pair, on top of the
+    /// security margin of its collision request.
+    double security_margin;
+  };
+
+  ///
+  /// \brief Compute the collision pairs of the geometry model which can never be in collision
+  /// within the joint limits of the model.
+  ///
+  /// Only the joints on the path of the kinematic tree between the parent joints of the two
+  /// geometries of a pair affect their relative placement. When all these joints have one
+  /// degree of freedom and finite limits, the variation of the distance between the two
+  /// geometries is bounded by the variations of the joint positions, weighted by the velocity of
+  /// the farthest point of the geometries they carry (see computeBodyRadius). The box of the
+  /// joint limits is then recursively bisected until the distance at the center of each box
+  /// exceeds this bound, which proves that the pair is collision free over the whole box. The
+  /// pairs with another kind of joint on their path (e.g. a free flyer) are kept.
+  ///
+  /// \param[in] model Kinematic model of the system.
+  /// \param[in] data Data related to the model, used as workspace.
+  /// \param[in] geom_model Geometry model of the system.
+  /// \param[in] geom_data Geometry data related to the geometry model, used as workspace.
+  /// \param[out] cache Pruned collision pairs, which can be applied with removeCollisionPairs and
+  /// saved for later use.
+  /// \param[in] settings Settings of the analysis.
+  ///
+  /// \returns The number of pruned collision pairs.
+  ///
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  std::size_t computeCollisionPairPruning(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    CollisionPairPruningCache & cache,
+    const CollisionPairPruningSettings & settings = CollisionPairPruningSettings());
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/collision/collision-pair-pruning.hxx"
+// IWYU pragma: end_exports
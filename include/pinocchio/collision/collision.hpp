@@ -27,9 +27,12 @@
 #include "pinocchio/spatial.hpp"
 #include "pinocchio/multibody.hpp"
 #include "pinocchio/algorithm/geometry.hpp"
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
 
 #include "pinocchio/collision/config.hpp"
 #include "pinocchio/collision/coal-pinocchio-conversions.hpp"
+#include "pinocchio/collision/distance.hpp"
 // IWYU pragma: end_keep
 
 namespace pinocchio
@@ -117,6 +120,102 @@ namespace pinocchio
     const Eigen::MatrixBase<ConfigVectorType> & q,
     const bool stopAtFirstCollision = false);
 
+  ///
+  /// Compute the forward kinematics, update the geometry placements and compute the collision
+  /// status of the active collision pairs, skipping the pairs which cannot have come into
+  /// collision since their last narrow phase.
+  ///
+  /// The displacement of any point of the body supported by a joint between two calls is bounded
+  /// by the displacement of the joint origin plus the rotation of the joint frame times the body
+  /// radius (see computeBodyRadius). These bounds are accumulated over the calls, and a collision
+  /// pair is only checked again once the accumulated displacements of its two bodies exceed the
+  /// separation distance computed by its last narrow phase. This is well suited to the checking
+  /// of dense trajectories, where consecutive configurations are close.
+  ///
+  /// The narrow phase of a pair first computes its distance, stored in geom_data.distanceResults,
+  /// and only performs the collision test when the distance is below the security margin.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorType Type of the joint configuration vector.
+  ///
+  /// \param[in] model robot model (const)
+  /// \param[out] data corresponding data (nonconst) where the forward kinematics results are stored
+  /// \param[in] geom_model geometry model (const)
+  /// \param[out] geom_data corresponding geometry data (nonconst) where collisions are computed,
+  /// with body radius computed by computeBodyRadius.
+  /// \param[in] q robot configuration.
+  /// \param[in] stopAtFirstCollision if true, stop the loop over the collision pairs when the first
+  /// collision is detected.
+  ///
+  /// \returns True if one of the collision pairs is in collision.
+  ///
+  /// \remarks The collision results of the skipped pairs are those of their last narrow phase,
+  /// i.e. without collision. Call GeometryData::resetCollisionCoherenceCache after modifying the
+  /// geometries.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  bool computeCollisionsWithTemporalCoherence(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const bool stopAtFirstCollision = false);
+
+  ///
+  /// Continuous collision checking along the segment interpolating q0 and q1 (see interpolate),
+  /// relying on conservative advancement.
+  ///
+  /// Along the segment, the joint velocity is constant and equal to difference(model, q0, q1).
+  /// At a given time t, the speed of any point of the body supported by a joint is bounded over
+  /// [t, 1] from the joint velocities, the lengths of the kinematic chain and the body radius (see
+  /// computeBodyRadius). Each collision pair is then safely advanced up to the time where its
+  /// bodies may have travelled its current distance, and its distance is only computed again at
+  /// that time. Compared to the checking of densely sampled configurations, far fewer narrow
+  /// phase queries are performed and no collision can be missed between the samples.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorType1 Type of the initial joint configuration vector.
+  /// \tparam ConfigVectorType2 Type of the final joint configuration vector.
+  ///
+  /// \param[in] model robot model (const)
+  /// \param[out] data corresponding data (nonconst) where the forward kinematics results are stored
+  /// \param[in] geom_model geometry model (const)
+  /// \param[out] geom_data corresponding geometry data (nonconst) where distances are computed,
+  /// with body radius computed by computeBodyRadius.
+  /// \param[in] q0 configuration at the beginning of the segment.
+  /// \param[in] q1 configuration at the end of the segment.
+  /// \param[out] time_of_contact first time in [0, 1] at which the distance of a collision pair
+  /// falls below its security margin plus the tolerance, or 1 if there is no collision.
+  /// \param[in] tolerance distance below which the geometries are considered in contact. It
+  /// bounds the number of iterations of the conservative advancement.
+  ///
+  /// \returns True if a collision occurs along the segment. The index of the colliding pair is then
+  /// stored in geom_data.collisionPairIndex.
+  ///
+  /// \remarks The speed bounds assume that the norm of the joint velocity expressed in the joint
+  /// frame does not depend on the configuration, which holds for all the usual joints.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType1,
+    typename ConfigVectorType2>
+  bool computeContinuousCollisions(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType1> & q0,
+    const Eigen::MatrixBase<ConfigVectorType2> & q1,
+    Scalar & time_of_contact,
+    const Scalar tolerance = Scalar(1e-4));
+
   ///
   /// \brief Compute the contact patch info associated with the collision pair given by pair_id.
   /// Note that an actual computation will only occur if the collision pair is indeed in collision
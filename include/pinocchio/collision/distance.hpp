@@ -21,9 +21,11 @@
 
 #include "pinocchio/multibody.hpp"
 #include "pinocchio/algorithm/geometry.hpp"
+#include "pinocchio/algorithm/jacobian.hpp"
 
 #include "pinocchio/collision/config.hpp"
 #include "pinocchio/collision/coal-pinocchio-conversions.hpp"
+#include "pinocchio/collision/signed-distance-field.hpp"
 // IWYU pragma: end_keep
 
 namespace pinocchio
@@ -106,6 +108,72 @@ namespace pinocchio
   ///
   std::size_t computeDistances(const GeometryModel & geom_model, GeometryData & geom_data);
 
+  ///
+  /// \brief Compute the derivatives of the distances of all the collision pairs with respect to
+  /// the joint configuration, from the joint Jacobians stored in data.J.
+  ///
+  /// The row cp_index of distance_jacobian is the gradient of
+  /// geom_data.distanceResults[cp_index].min_distance, obtained by projecting the velocities of
+  /// the two nearest points along the normal of the pair. Only the columns of the joints
+  /// supporting one of the two geometries are filled, the rows of the inactive pairs being zero.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam MatrixType Type of the distance Jacobian.
+  ///
+  /// \param[in] model: robot model (const)
+  /// \param[in] data: corresponding data, where the joint Jacobians are stored
+  /// \param[in] geom_model: geometry model (const)
+  /// \param[in] geom_data: corresponding geometry data, where the distances are stored
+  /// \param[out] distance_jacobian: derivatives of the distances (dim num pairs x model.nv)
+  ///
+  /// \note computeJointJacobians, updateGeometryPlacements and computeDistances must have been
+  /// called first.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename MatrixType>
+  void computeDistancesDerivatives(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    const GeometryData & geom_data,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian);
+
+  ///
+  /// \brief Compute the joint Jacobians, update the geometry placements, compute the distances
+  /// of every active pairs and their derivatives with respect to the joint configuration.
+  ///
+  /// The joint Jacobians are computed once and shared by all the collision pairs.
+  ///
+  /// \tparam JointCollection Collection of Joint types.
+  /// \tparam ConfigVectorType Type of the joint configuration vector.
+  /// \tparam MatrixType Type of the distance Jacobian.
+  ///
+  /// \param[in] model: robot model (const)
+  /// \param[in] data: corresponding data (nonconst) where the kinematics and Jacobians are stored
+  /// \param[in] geom_model: geometry model (const)
+  /// \param[out] geom_data: corresponding geometry data (nonconst) where distances are computed
+  /// \param[in] q: robot configuration.
+  /// \param[out] distance_jacobian: derivatives of the distances (dim num pairs x model.nv)
+  ///
+  /// \return Index of the minimal pair distance in geom_data.distanceResults
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivatives(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian);
+
 } // namespace pinocchio
 
 // IWYU pragma: begin_exports
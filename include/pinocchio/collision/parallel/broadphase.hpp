@@ -8,6 +8,7 @@
 #include <Eigen/Core>
 #include <Eigen/Dense>
 
+#include <atomic>
 #include <cstdint>
 #include <cstddef>
 #include <vector>
@@ -20,6 +21,7 @@
 #include "pinocchio/algorithm/geometry.hpp"
 
 #include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
 
 #include "pinocchio/collision/pool/broadphase-manager.hpp"
 #include "pinocchio/collision/broadphase.hpp"
@@ -58,6 +60,112 @@ namespace pinocchio
     std::vector<VectorXb> & res,
     const bool stopAtFirstCollisionInTrajectory = false);
 
+  ///
+  /// \brief Evaluate the collisions over a batch of configurations, using the given executor to
+  /// distribute the configurations over the threads.
+  ///
+  template<
+    typename Executor,
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename CollisionVectorResult>
+  void computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<CollisionVectorResult> & res,
+    const bool stopAtFirstCollisionInConfiguration = false,
+    const bool stopAtFirstCollisionInBatch = false);
+
+  ///
+  /// \brief Evaluate the collision over a set of trajectories and return whether a trajectory
+  /// contains a collision, using the given executor to distribute the trajectories over the
+  /// threads.
+  ///
+  template<
+    typename Executor,
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl>
+  void computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const std::vector<Eigen::MatrixXd> & trajectories,
+    std::vector<VectorXb> & res,
+    const bool stopAtFirstCollisionInTrajectory = false);
+
+  ///
+  /// \brief Evaluate the collisions over a stream of configurations, using the given executor to
+  /// distribute the configurations over the threads.
+  ///
+  /// The configurations are generated on the fly by each thread, in its own buffer, so that the
+  /// batch never has to be stored (e.g. the interpolated configurations along an edge of a
+  /// roadmap). The result of each configuration is streamed to result_callback as soon as it is
+  /// available. The broadphase managers of the pool are reused from one call to the other.
+  ///
+  /// \param[in] executor Executor distributing the configurations over the threads. An executor
+  /// with dynamic scheduling should be preferred, the cost of a configuration being uneven.
+  /// \param[in] pool Pool of broadphase managers, with at least executor.numThreads() elements.
+  /// \param[in] num_configurations Number of configurations of the stream.
+  /// \param[in] configuration_generator Functor with signature
+  /// void(Eigen::Index i, ConfigVectorType & q) writing the i-th configuration in q, q being of
+  /// size model.nq. It is called concurrently by the threads.
+  /// \param[in] result_callback Functor with signature
+  /// void(Eigen::Index i, const ConfigVectorType & q, bool is_colliding), called concurrently by
+  /// the threads in an unspecified order.
+  /// \param[in] stopAtFirstCollisionInConfiguration Stop the evaluation of a configuration at
+  /// its first collision.
+  /// \param[in] stopAtFirstCollisionInBatch Cancel the evaluation of the configurations not yet
+  /// started as soon as one configuration is in collision. The result of the cancelled
+  /// configurations is not streamed.
+  ///
+  /// \returns True if at least one of the evaluated configurations is in collision.
+  ///
+  template<
+    typename Executor,
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigurationGenerator,
+    typename ResultCallback>
+  bool computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::Index num_configurations,
+    ConfigurationGenerator && configuration_generator,
+    ResultCallback && result_callback,
+    const bool stopAtFirstCollisionInConfiguration = true,
+    const bool stopAtFirstCollisionInBatch = true);
+
+  ///
+  /// \brief Evaluate the collisions over a stream of configurations, the configurations being
+  /// dynamically scheduled over num_threads OpenMP threads.
+  ///
+  /// \sa computeCollisionsInParallel(ExecutorBase<Executor> &,
+  /// BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> &,
+  /// const Eigen::Index, ConfigurationGenerator &&, ResultCallback &&, const bool, const bool)
+  ///
+  template<
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigurationGenerator,
+    typename ResultCallback>
+  bool computeCollisionsInParallel(
+    const size_t num_threads,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::Index num_configurations,
+    ConfigurationGenerator && configuration_generator,
+    ResultCallback && result_callback,
+    const bool stopAtFirstCollisionInConfiguration = true,
+    const bool stopAtFirstCollisionInBatch = true);
+
 } // namespace pinocchio
 
 // IWYU pragma: begin_exports
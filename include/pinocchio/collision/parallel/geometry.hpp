@@ -9,7 +9,10 @@
 #include <Eigen/Core>
 
 #include <omp.h>
+#include <algorithm>
+#include <atomic>
 #include <cstddef>
+#include <limits>
 #include <vector>
 
 #include "pinocchio/eigen-common.hpp"
@@ -21,18 +24,52 @@
 #include "pinocchio/algorithm/geometry.hpp"
 
 #include "pinocchio/utils/openmp.hpp"
+#include "pinocchio/algorithm/parallel/executor.hpp"
 
 #include "pinocchio/collision/collision.hpp"
+#include "pinocchio/collision/distance.hpp"
 // IWYU pragma: end_keep
 
 namespace pinocchio
 {
+  ///
+  /// \brief Evaluate the collisions of the collision pairs of a single scene, the pairs being
+  /// distributed over num_threads OpenMP threads with dynamic scheduling.
+  ///
+  /// \sa computeCollisionsInParallel(ExecutorBase<Executor> &, const GeometryModel &,
+  /// GeometryData &, const bool)
+  ///
   inline bool computeCollisionsInParallel(
     const size_t num_threads,
     const GeometryModel & geom_model,
     GeometryData & geom_data,
     const bool stopAtFirstCollision = false);
 
+  ///
+  /// \brief Evaluate the collisions of the collision pairs of a single scene, using the given
+  /// executor to distribute contiguous blocks of collision pairs over the threads.
+  ///
+  /// The narrow phase of each pair is written in its own entry of geom_data.collisionResults, so
+  /// that the threads never share a result. The outcome is then merged deterministically:
+  /// geom_data.collisionPairIndex is the index of the first colliding pair, whatever the number
+  /// of threads and the scheduling, as in computeCollisions.
+  ///
+  /// \param[in] executor Executor distributing the blocks of collision pairs over the threads.
+  /// \param[in] geom_model Geometry model, containing the collision pairs.
+  /// \param[in,out] geom_data Geometry data, containing the placements of the geometries and the
+  /// collision results.
+  /// \param[in] stopAtFirstCollision Skip the pairs located after a colliding pair. The results
+  /// of the pairs located after the first colliding pair are then cleared.
+  ///
+  /// \returns True if at least one collision pair is in collision.
+  ///
+  template<typename Executor>
+  bool computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const bool stopAtFirstCollision = false);
+
   template<
     typename Scalar,
     int Options,
@@ -60,6 +97,91 @@ namespace pinocchio
     const Eigen::MatrixBase<CollisionVectorResult> & res,
     const bool stopAtFirstCollisionInConfiguration = false,
     const bool stopAtFirstCollisionInBatch = false);
+
+  ///
+  /// \brief Evaluate the collisions over a batch of configurations, using the given executor to
+  /// distribute the configurations over the threads.
+  ///
+  /// \param[in] executor Executor distributing the batch over the threads (see ExecutorBase).
+  /// \param[in] pool Pool containing the models, datas, geometry models and geometry datas.
+  /// \param[in] q Batch of joint configurations (dim model.nq x batch_size).
+  /// \param[out] res Whether each configuration of the batch is in collision (dim batch_size).
+  /// \param[in] stopAtFirstCollisionInConfiguration Stop the evaluation of a configuration at
+  /// its first collision.
+  /// \param[in] stopAtFirstCollisionInBatch Skip the remaining configurations of the batch once a
+  /// collision has been detected.
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename CollisionVectorResult>
+  void computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    GeometryPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<CollisionVectorResult> & res,
+    const bool stopAtFirstCollisionInConfiguration = false,
+    const bool stopAtFirstCollisionInBatch = false);
+
+  ///
+  /// \brief Compute the distances of the active collision pairs of a single scene and their
+  /// derivatives with respect to the joint configuration, the pairs being distributed over the
+  /// threads of the given executor.
+  ///
+  /// The forward kinematics and the joint Jacobians are computed once, before the parallel loop.
+  /// Each thread then evaluates the narrow phase of a pair and fills its row of
+  /// distance_jacobian, as computeDistancesDerivatives does.
+  ///
+  /// \param[in] executor Executor distributing the collision pairs over the threads.
+  /// \param[in] model Robot model (const).
+  /// \param[in,out] data Corresponding data, where the kinematics and Jacobians are stored.
+  /// \param[in] geom_model Geometry model, containing the collision pairs.
+  /// \param[in,out] geom_data Geometry data, where the distances are computed.
+  /// \param[in] q Robot configuration.
+  /// \param[out] distance_jacobian Derivatives of the distances (dim num pairs x model.nv).
+  ///
+  /// \returns Index of the minimal pair distance in geom_data.distanceResults.
+  ///
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian);
+
+  ///
+  /// \brief Compute the distances of the active collision pairs of a single scene and their
+  /// derivatives, the pairs being distributed over num_threads OpenMP threads with dynamic
+  /// scheduling.
+  ///
+  /// \sa computeDistancesDerivativesInParallel(ExecutorBase<Executor> &, ...)
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivativesInParallel(
+    const size_t num_threads,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian);
 } // namespace pinocchio
 
 // IWYU pragma: begin_exports
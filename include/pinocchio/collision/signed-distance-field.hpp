@@ -0,0 +1,57 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <coal/collision_data.h>
+#include <coal/distance.h>
+#include <coal/shape/geometric_shapes.h>
+#include <coal/math/transform.h>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/spatial.hpp"
+#include "pinocchio/geometry.hpp"
+
+#include "pinocchio/collision/config.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+
+  ///
+  /// \brief Compute the signed distance field of a geometry on a regular grid covering its
+  /// bounding box.
+  ///
+  /// The value at each node of the grid is the distance computed by coal between the geometry
+  /// and the node. Coal only provides penetration depths for convex geometries: for meshes, which
+  /// are triangle soups, the field is the (unsigned) distance to the surface.
+  ///
+  /// \param[in] geometry Static geometry, expressed in its own frame.
+  /// \param[in] resolution Distance between two consecutive nodes of the grid.
+  /// \param[in] padding Distance by which the bounding box of the geometry is inflated. Outside of
+  /// the grid, the field is extrapolated (see SignedDistanceField::evaluate), so the padding
+  /// should cover the distances of interest.
+  ///
+  /// \returns The signed distance field of the geometry, to be attached to
+  /// GeometryObject::distanceField.
+  ///
+  /// \remarks The number of coal distance queries is the number of nodes of the grid, so that the
+  /// field is meant to be computed once and saved.
+  ///
+  inline SignedDistanceField computeSignedDistanceField(
+    const coal::CollisionGeometry & geometry, const double resolution, const double padding);
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/collision/signed-distance-field.hxx"
+// IWYU pragma: end_exports
@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <Eigen/Core>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include <coal/collision.h>
+#include <coal/collision_data.h>
+#include <coal/shape/geometric_shapes.h>
+#include <coal/math/transform.h>
+
+#include "pinocchio/macros.hpp"
+
+#include "pinocchio/multibody.hpp"
+#include "pinocchio/geometry.hpp"
+#include "pinocchio/algorithm/geometry.hpp"
+
+#include "pinocchio/collision/config.hpp"
+#include "pinocchio/collision/collision.hpp"
+// IWYU pragma: end_keep
+
+namespace pinocchio
+{
+
+  ///
+  /// \brief Multi-level sphere decomposition of a geometry, expressed in the frame of the
+  /// geometry.
+  ///
+  /// The level l is made of the spheres circumscribing the cells of the regular 2^l x 2^l x 2^l
+  /// subdivision of the bounding box of the geometry which intersect the geometry, so that each
+  /// level covers the geometry. The children of a sphere are the spheres of the next level lying
+  /// in its cell. The spheres of a level are stored in flat arrays of centers and radii.
+  ///
+  struct SphereTree
+  {
+    typedef double Scalar;
+    typedef Eigen::Matrix<Scalar, 3, Eigen::Dynamic> Matrix3Xs;
+    typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorXs;
+    typedef Eigen::Matrix<Eigen::Index, Eigen::Dynamic, 1> IndexVector;
+
+    /// \brief Returns the number of levels of the tree, zero if the geometry is not approximated.
+    std::size_t numLevels() const
+    {
+      return centers.size();
+    }
+
+    /// \brief Centers of the spheres of each level.
+    std::vector<Matrix3Xs> centers;
+
+    /// \brief Radii of the spheres of each level.
+    std::vector<VectorXs> radii;
+
+    /// \brief Children of the spheres of each level but the last one: the children of the sphere
+    /// k of level l are the spheres children[l][k] to children[l][k+1] - 1 of level l + 1.
+    std::vector<IndexVector> children;
+  }; // struct SphereTree
+
+  ///
+  /// \brief Sphere trees of the geometry objects of a geometry model.
+  ///
+  struct SphereTreeModel
+  {
+    /// \brief Sphere tree of each geometry object, empty for the geometries which are not
+    /// approximated.
+    std::vector<SphereTree> trees;
+  }; // struct SphereTreeModel
+
+  ///
+  /// \brief Placements of the sphere trees of a SphereTreeModel.
+  ///
+  struct SphereTreeData
+  {
+    typedef SphereTree::Matrix3Xs Matrix3Xs;
+
+    SphereTreeData()
+    {
+    }
+
+    /// \brief Constructor allocating the sphere centers of sphere_tree_model.
+    explicit SphereTreeData(const SphereTreeModel & sphere_tree_model)
+    {
+      oCenters.resize(sphere_tree_model.trees.size());
+      for (std::size_t geom_id = 0; geom_id < oCenters.size(); ++geom_id)
+        oCenters[geom_id] = sphere_tree_model.trees[geom_id].centers;
+    }
+
+    /// \brief Centers of the spheres of each level of each tree, expressed in the world frame.
+    std::vector<std::vector<Matrix3Xs>> oCenters;
+
+    /// \brief Pairs of spheres (level and index in each tree) remaining to be tested.
+    std::vector<std::array<Eigen::Index, 4>> stack;
+  }; // struct SphereTreeData
+
+  ///
+  /// \brief Compute the sphere tree of a geometry.
+  ///
+  /// The cells of each level are tested against the geometry with coal. For meshes, which are
+  /// triangle soups, only their surface is covered.
+  ///
+  /// \param[in] geometry Geometry, expressed in its own frame.
+  /// \param[in] num_levels Number of levels of the tree, the first one being the sphere
+  /// circumscribing the bounding box of the geometry.
+  ///
+  /// \returns The sphere tree of the geometry, empty if the geometry is unbounded.
+  ///
+  inline SphereTree
+  computeSphereTree(const coal::CollisionGeometry & geometry, const std::size_t num_levels);
+
+  ///
+  /// \brief Compute the sphere trees of all the geometry objects of a geometry model.
+  ///
+  /// \param[in] geom_model Geometry model.
+  /// \param[in] num_levels Number of levels of the trees.
+  ///
+  inline SphereTreeModel
+  buildSphereTreeModel(const GeometryModel & geom_model, const std::size_t num_levels = 3);
+
+  ///
+  /// \brief Update the centers of the sphere trees from the geometry placements geom_data.oMg.
+  ///
+  inline void updateSphereTreePlacements(
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const GeometryData & geom_data);
+
+  ///
+  /// \brief Conservative collision test between two geometries from their sphere trees.
+  ///
+  /// The pairs of overlapping spheres are refined level by level, until a pair of spheres of the
+  /// last levels overlaps.
+  ///
+  /// \param[in] sphere_tree_model Sphere trees of the geometries.
+  /// \param[in,out] sphere_tree_data Placements of the sphere trees, updated by
+  /// updateSphereTreePlacements, and workspace.
+  /// \param[in] geom_id1 Index of the first geometry.
+  /// \param[in] geom_id2 Index of the second geometry.
+  /// \param[in] security_margin Distance below which the geometries are considered in collision.
+  ///
+  /// \returns False if the geometries are proven to be separated by more than security_margin.
+  /// True if they may be in collision, which is always the case when one of the geometries is
+  /// not approximated.
+  ///
+  inline bool computeSphereTreeCollision(
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const GeomIndex geom_id1,
+    const GeomIndex geom_id2,
+    const SphereTree::Scalar security_margin);
+
+  ///
+  /// \brief Collision checking of the active collision pairs filtered by their sphere trees.
+  ///
+  /// The sphere trees are placed from geom_data.oMg. The exact narrow phase of coal (see
+  /// computeCollision) is only run for the pairs whose sphere trees overlap, the other ones
+  /// having their collision result cleared.
+  ///
+  /// \param[in] geom_model Geometry model (const).
+  /// \param[out] geom_data Geometry data, with the geometry placements already updated.
+  /// \param[in] sphere_tree_model Sphere trees of the geometries (see buildSphereTreeModel).
+  /// \param[in,out] sphere_tree_data Placements of the sphere trees.
+  /// \param[in] stopAtFirstCollision If true, stop the loop over the collision pairs when the
+  /// first collision is detected.
+  /// \param[in] refineWithNarrowPhase If false, the pairs whose sphere trees overlap are reported
+  /// as colliding without running the narrow phase, which gives a conservative check. Their
+  /// collision results are then cleared as well.
+  ///
+  /// \returns True if one of the collision pairs is (or may be, without refinement) in collision.
+  /// The index of the first colliding pair is stored in geom_data.collisionPairIndex.
+  ///
+  inline bool computeCollisionsWithSphereTrees(
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const bool stopAtFirstCollision = false,
+    const bool refineWithNarrowPhase = true);
+
+  ///
+  /// \brief Update the geometry placements and check the collisions of the active collision pairs
+  /// filtered by their sphere trees (see computeCollisionsWithSphereTrees).
+  ///
+  /// \param[in] model Robot model (const).
+  /// \param[out] data Corresponding data where the forward kinematics results are stored.
+  /// \param[in] geom_model Geometry model (const).
+  /// \param[out] geom_data Geometry data where the collisions are computed.
+  /// \param[in] sphere_tree_model Sphere trees of the geometries (see buildSphereTreeModel).
+  /// \param[in,out] sphere_tree_data Placements of the sphere trees.
+  /// \param[in] q Robot configuration.
+  /// \param[in] stopAtFirstCollision If true, stop the loop over the collision pairs when the
+  /// first collision is detected.
+  /// \param[in] refineWithNarrowPhase If false, the overlapping sphere trees are reported as
+  /// colliding without running the narrow phase.
+  ///
+  /// \returns True if one of the collision pairs is (or may be, without refinement) in collision.
+  ///
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  bool computeCollisionsWithSphereTrees(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const bool stopAtFirstCollision = false,
+    const bool refineWithNarrowPhase = true);
+
+} // namespace pinocchio
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/collision/sphere-tree.hxx"
+// IWYU pragma: end_exports
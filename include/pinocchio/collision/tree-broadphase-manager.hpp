@@ -6,6 +6,7 @@
 // IWYU pragma: begin_keep
 #include <Eigen/Core>
 
+#include <algorithm>
 #include <cstddef>
 #include <vector>
 
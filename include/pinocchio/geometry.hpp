@@ -4,6 +4,8 @@
 #pragma once
 
 // IWYU pragma: begin_keep
+#include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -36,7 +38,10 @@
 #include "pinocchio/src/geometry/coal.hxx"
 #include "pinocchio/src/multibody/model-item.hxx"
 #include "pinocchio/src/geometry/instance-filter.hxx"
+#include "pinocchio/src/geometry/signed-distance-field.hxx"
 #include "pinocchio/src/geometry/geometry-object.hxx"
 #include "pinocchio/src/geometry/geometry.hxx"
+#include "pinocchio/src/geometry/geometry-placements-batch.hxx"
 #include "pinocchio/src/geometry/geometry-object-filter.hxx"
+#include "pinocchio/src/geometry/collision-pair-pruning.hxx"
 // IWYU pragma: end_exports
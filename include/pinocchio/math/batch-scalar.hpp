@@ -0,0 +1,24 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: begin_keep
+#include <cmath>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+#include <Eigen/Core>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/version.hpp>
+
+#include "pinocchio/macros.hpp"
+#include "pinocchio/math.hpp"
+#include "pinocchio/spatial.hpp"
+// IWYU pragma: end_keep
+
+// IWYU pragma: begin_exports
+#include "pinocchio/src/math/batch-scalar.hxx"
+// IWYU pragma: end_exports
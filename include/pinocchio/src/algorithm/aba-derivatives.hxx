@@ -406,6 +406,9 @@ namespace pinocchio
         isZero(model.gravity.angular()),
         "The gravity must be a pure force vector, no angular part");
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
@@ -496,6 +499,9 @@ namespace pinocchio
         isZero(model.gravity.angular()),
         "The gravity must be a pure force vector, no angular part");
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
@@ -734,6 +740,9 @@ namespace pinocchio
         isZero(model.gravity.angular()),
         "The gravity must be a pure force vector, no angular part");
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
@@ -801,6 +810,9 @@ namespace pinocchio
         isZero(model.gravity.angular()),
         "The gravity must be a pure force vector, no angular part");
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
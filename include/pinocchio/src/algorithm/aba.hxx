@@ -844,6 +844,9 @@ namespace pinocchio
       const Eigen::MatrixBase<ConfigVectorType> & q)
     {
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       PINOCCHIO_CHECK_ARGUMENT_SIZE(
@@ -883,6 +886,9 @@ namespace pinocchio
     DataTpl<Scalar, Options, JointCollectionTpl> & data)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_MASS_MATRIX)
+      && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
     typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
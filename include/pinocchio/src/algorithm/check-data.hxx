@@ -43,11 +43,6 @@ namespace pinocchio
     CHECK_DATA((int)data.liMi.size() == model.njoints);
     CHECK_DATA((int)data.Ycrb.size() == model.njoints);
     CHECK_DATA((int)data.Yaba.size() == model.njoints);
-    CHECK_DATA((int)data.Fcrb.size() == model.njoints);
-    for (const typename Data::Matrix6x & F : data.Fcrb)
-    {
-      CHECK_DATA(F.cols() == model.nv);
-    }
     CHECK_DATA((int)data.iMf.size() == model.njoints);
     CHECK_DATA((int)data.iMf.size() == model.njoints);
     CHECK_DATA((int)data.com.size() == model.njoints);
@@ -59,11 +54,7 @@ namespace pinocchio
     CHECK_DATA(data.nle.size() == model.nv);
     CHECK_DATA(data.ddq.size() == model.nv);
     CHECK_DATA(data.u.size() == model.nv);
-    CHECK_DATA(data.M.rows() == model.nv);
-    CHECK_DATA(data.M.cols() == model.nv);
     CHECK_DATA(data.Ag.cols() == model.nv);
-    CHECK_DATA(data.U.cols() == model.nv);
-    CHECK_DATA(data.U.rows() == model.nv);
     CHECK_DATA(data.D.size() == model.nv);
     CHECK_DATA(data.tmp.size() >= model.nv);
     CHECK_DATA(data.J.cols() == model.nvExtended);
@@ -72,9 +63,37 @@ namespace pinocchio
     CHECK_DATA(data.dq_after.size() == model.nv);
     // CHECK_DATA( data.impulse_c.size()== model.nv );
 
-    CHECK_DATA(data.kinematic_hessians.dimension(0) == 6);
-    CHECK_DATA(data.kinematic_hessians.dimension(1) == model.nv);
-    CHECK_DATA(data.kinematic_hessians.dimension(2) == model.nv);
+    // Optional buffers
+    if (data.hasFeatures(DATA_MASS_MATRIX))
+    {
+      CHECK_DATA(data.M.rows() == model.nv);
+      CHECK_DATA(data.M.cols() == model.nv);
+      CHECK_DATA(data.U.cols() == model.nv);
+      CHECK_DATA(data.U.rows() == model.nv);
+      CHECK_DATA((int)data.Fcrb.size() == model.njoints);
+      for (const typename Data::Matrix6x & F : data.Fcrb)
+      {
+        CHECK_DATA(F.cols() == model.nv);
+      }
+    }
+    if (data.hasFeatures(DATA_DERIVATIVES))
+    {
+      CHECK_DATA(data.dtau_dq.rows() == model.nv);
+      CHECK_DATA(data.dtau_dq.cols() == model.nv);
+      CHECK_DATA(data.ddq_dq.rows() == model.nv);
+      CHECK_DATA(data.ddq_dq.cols() == model.nv);
+    }
+    if (data.hasFeatures(DATA_SECOND_ORDER_DERIVATIVES))
+    {
+      CHECK_DATA(data.kinematic_hessians.dimension(0) == 6);
+      CHECK_DATA(data.kinematic_hessians.dimension(1) == model.nv);
+      CHECK_DATA(data.kinematic_hessians.dimension(2) == model.nv);
+    }
+    if (data.hasFeatures(DATA_REGRESSORS))
+    {
+      CHECK_DATA(data.jointTorqueRegressor.rows() == model.nv);
+      CHECK_DATA(data.jointTorqueRegressor.cols() == 10 * (model.njoints - 1));
+    }
 
     CHECK_DATA((int)data.oMf.size() == model.nframes);
 
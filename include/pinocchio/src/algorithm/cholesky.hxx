@@ -36,6 +36,9 @@ namespace pinocchio
        */
       PINOCCHIO_UNUSED_VARIABLE(model);
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
@@ -585,6 +588,9 @@ namespace pinocchio
       PINOCCHIO_CHECK_ARGUMENT_SIZE(Minv.cols(), model.nv);
 
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       Mat & Minv_ = PINOCCHIO_EIGEN_CONST_CAST(Mat, Minv);
@@ -0,0 +1,307 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/compiled-model.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/compiled-model.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  namespace details
+  {
+    /// \brief Index of JointModel in JointModelTypes, the last index (generic joint) if absent.
+    template<typename JointModel, typename JointModelTypes, std::size_t... I>
+    constexpr std::size_t compiledJointType(std::index_sequence<I...>)
+    {
+      constexpr bool is_same[] = {
+        std::is_same<JointModel, typename std::tuple_element<I, JointModelTypes>::type>::value...};
+      for (std::size_t k = 0; k + 1 < sizeof...(I); ++k)
+        if (is_same[k])
+          return k;
+      return sizeof...(I) - 1;
+    }
+
+    ///
+    /// \brief Append a joint to the array of its type, returning the joint type and the index of
+    /// the joint in the array.
+    ///
+    template<typename CompiledModel>
+    struct CompileJointVisitor : boost::static_visitor<std::pair<std::size_t, std::size_t>>
+    {
+      typedef typename CompiledModel::JointModel JointModel;
+      typedef typename CompiledModel::JointModelTypes JointModelTypes;
+
+      CompileJointVisitor(CompiledModel & compiled_model, const JointModel & generic_joint)
+      : compiled_model(compiled_model)
+      , generic_joint(generic_joint)
+      {
+      }
+
+      template<typename JointModelDerived>
+      std::pair<std::size_t, std::size_t> operator()(const JointModelDerived & jmodel) const
+      {
+        constexpr std::size_t joint_type = compiledJointType<JointModelDerived, JointModelTypes>(
+          std::make_index_sequence<CompiledModel::num_joint_types>());
+        auto & joints = std::get<joint_type>(compiled_model.joints);
+        if constexpr (joint_type + 1 == CompiledModel::num_joint_types)
+          joints.push_back(generic_joint);
+        else
+          joints.push_back(jmodel);
+        return std::make_pair(joint_type, joints.size() - 1);
+      }
+
+      CompiledModel & compiled_model;
+      const JointModel & generic_joint;
+    };
+
+    template<typename JointArray, typename Kernel>
+    void runCompiledJoints(
+      const JointArray & joints,
+      const std::size_t begin,
+      const std::size_t end,
+      const bool backward,
+      const Kernel & kernel)
+    {
+      if (backward)
+      {
+        for (std::size_t k = end; k-- > begin;)
+          kernel(joints[k]);
+      }
+      else
+      {
+        for (std::size_t k = begin; k < end; ++k)
+          kernel(joints[k]);
+      }
+    }
+
+    template<typename CompiledModel, typename Kernel, std::size_t... I>
+    void runCompiledSegment(
+      const CompiledModel & compiled_model,
+      const typename CompiledModel::Segment & segment,
+      const bool backward,
+      const Kernel & kernel,
+      std::index_sequence<I...>)
+    {
+      // Single dispatch on the joint type for the whole segment
+      ((segment.joint_type == I ? runCompiledJoints(
+                                    std::get<I>(compiled_model.joints), segment.begin,
+                                    segment.end, backward, kernel)
+                                : void()),
+       ...);
+    }
+
+    ///
+    /// \brief Call kernel on every joint of compiled_model, in the topological order (forward
+    /// pass) or in the reverse order (backward pass).
+    ///
+    template<typename CompiledModel, typename Kernel>
+    void runCompiledPass(
+      const CompiledModel & compiled_model, const bool backward, const Kernel & kernel)
+    {
+      typedef std::make_index_sequence<CompiledModel::num_joint_types> JointTypes;
+      const std::size_t num_segments = compiled_model.program.size();
+      for (std::size_t s = 0; s < num_segments; ++s)
+      {
+        const std::size_t segment_id = backward ? num_segments - 1 - s : s;
+        runCompiledSegment(
+          compiled_model, compiled_model.program[segment_id], backward, kernel, JointTypes());
+      }
+    }
+
+    ///
+    /// \brief Run the step of an algorithm on a joint of a compiled model, the generic joints
+    /// going through the joint visitor of the step.
+    ///
+    template<
+      typename Step,
+      typename JointModel,
+      typename Scalar,
+      int Options,
+      template<typename, int> class JointCollectionTpl,
+      typename... Args>
+    void runCompiledStep(
+      const JointModel & jmodel,
+      const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+      DataTpl<Scalar, Options, JointCollectionTpl> & data,
+      const Args &... args)
+    {
+      typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+      typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
+
+      typename Data::JointData & jdata = data.joints[jmodel.id()];
+      if constexpr (std::is_same<JointModel, typename Model::JointModel>::value)
+        Step::run(jmodel, jdata, typename Step::ArgsType(model, data, args...));
+      else
+        Step::algo(
+          jmodel, boost::get<typename JointModel::JointDataDerived>(jdata.toVariant()), model,
+          data, args...);
+    }
+  } // namespace details
+
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  CompiledModelTpl<Scalar, Options, JointCollectionTpl>::CompiledModelTpl(const Model & model)
+  : njoints(JointIndex(model.njoints))
+  {
+    typedef details::CompileJointVisitor<CompiledModelTpl> Visitor;
+
+    for (JointIndex i = 1; i < njoints; ++i)
+    {
+      const std::pair<std::size_t, std::size_t> joint =
+        boost::apply_visitor(Visitor(*this, model.joints[i]), model.joints[i].toVariant());
+      if (!program.empty() && program.back().joint_type == joint.first)
+      {
+        assert(program.back().end == joint.second);
+        ++program.back().end;
+      }
+      else
+      {
+        const Segment segment = {joint.first, joint.second, joint.second + 1};
+        program.push_back(segment);
+      }
+    }
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  void forwardKinematics(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      compiled_model.njoints == JointIndex(model.njoints),
+      "The compiled model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The configuration vector is not equal to model.nq.");
+
+    typedef impl::ForwardKinematicZeroStep<Scalar, Options, JointCollectionTpl, ConfigVectorType>
+      Pass;
+    details::runCompiledPass(compiled_model, false, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass>(jmodel, model, data, q.derived());
+    });
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & rnea(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & a)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      compiled_model.njoints == JointIndex(model.njoints),
+      "The compiled model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The configuration vector is not equal to model.nq.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.size(), model.nv, "The velocity vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      a.size(), model.nv, "The acceleration vector is not of right size");
+
+    // Set to zero, the mimic joints adding their contribution to the torque of their mimicked
+    data.tau.setZero();
+    data.v[0].setZero();
+    data.a_gf[0] = -model.gravity;
+
+    typedef impl::RneaForwardStep<
+      Scalar, Options, JointCollectionTpl, ConfigVectorType, TangentVectorType1, TangentVectorType2>
+      Pass1;
+    details::runCompiledPass(compiled_model, false, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass1>(jmodel, model, data, q.derived(), v.derived(), a.derived());
+    });
+
+    typedef impl::RneaBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+    details::runCompiledPass(compiled_model, true, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass2>(jmodel, model, data);
+    });
+
+    // Add rotorinertia contribution
+    data.tau.array() += model.armature.array() * a.array();
+
+    return data.tau;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & aba(
+    const CompiledModelTpl<Scalar, Options, JointCollectionTpl> & compiled_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & tau)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    assert(model.check(MimicChecker()) && "Function does not support mimic joints");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      compiled_model.njoints == JointIndex(model.njoints),
+      "The compiled model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The joint configuration vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      v.size(), model.nv, "The joint velocity vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      tau.size(), model.nv, "The joint torque vector is not of right size");
+
+    data.v[0].setZero();
+    data.a_gf[0] = -model.gravity;
+    data.f[0].setZero();
+    data.u = tau;
+
+    typedef impl::AbaLocalConventionForwardStep1<
+      Scalar, Options, JointCollectionTpl, ConfigVectorType, TangentVectorType1>
+      Pass1;
+    details::runCompiledPass(compiled_model, false, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass1>(jmodel, model, data, q.derived(), v.derived());
+    });
+
+    typedef impl::AbaLocalConventionBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+    details::runCompiledPass(compiled_model, true, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass2>(jmodel, model, data);
+    });
+
+    typedef impl::AbaLocalConventionForwardStep2<Scalar, Options, JointCollectionTpl> Pass3;
+    details::runCompiledPass(compiled_model, false, [&](const auto & jmodel) {
+      details::runCompiledStep<Pass3>(jmodel, model, data);
+    });
+
+    for (JointIndex i = (JointIndex)model.njoints - 1; i > 0; --i)
+    {
+      const JointIndex parent = model.parents[i];
+      data.f[parent] += data.liMi[i].act(data.f[i]);
+    }
+
+    return data.ddq;
+  }
+
+} // namespace pinocchio
@@ -34,6 +34,9 @@ namespace pinocchio
       const ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
       const Eigen::Index col,
       const Eigen::MatrixBase<VectorLike> & vec);
+
+    template<typename Scalar, int Options>
+    struct ConstraintCholeskyComputeInParallelAlgo;
   } // namespace details
 
   ///
@@ -72,6 +75,7 @@ namespace pinocchio
     typedef BlockDiagonalMatrix DampingType;
 
     typedef Eigen::Matrix<Eigen::Index, Eigen::Dynamic, 1, Options> EigenIndexVector;
+    typedef internal::EigenStorageTpl<EigenIndexVector> EigenStorageIndexVector;
     typedef typename std::vector<EigenIndexVector> VectorOfEigenIndexVector;
     typedef Eigen::Matrix<bool, Eigen::Dynamic, 1, Options> BooleanVector;
 
@@ -106,6 +110,8 @@ namespace pinocchio
     : D(D_storage.map())
     , Dinv(Dinv_storage.map())
     , U(U_storage.map())
+    , parents_fromRow(parents_fromRow_storage.map())
+    , nv_subtree_fromRow(nv_subtree_fromRow_storage.map())
     , compliance(compliance_storage.map())
     , delassus_block(delassus_block_storage.map())
     , decomposition_dirty(true)
@@ -168,8 +174,8 @@ namespace pinocchio
     ConstraintCholeskyDecompositionTpl & operator=(const ConstraintCholeskyDecompositionTpl & other)
 
     {
-      parents_fromRow = other.parents_fromRow;
-      nv_subtree_fromRow = other.nv_subtree_fromRow;
+      parents_fromRow_storage = other.parents_fromRow_storage;
+      nv_subtree_fromRow_storage = other.nv_subtree_fromRow_storage;
       nv = other.nv;
 
       rowise_sparsity_pattern = other.rowise_sparsity_pattern;
@@ -232,6 +238,18 @@ namespace pinocchio
       const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
       const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas);
 
+    ///
+    /// \brief Reserves the memory needed to handle constraints of total dimension up to
+    /// max_constraint_size.
+    ///
+    /// \param[in] max_constraint_size Maximal total dimension of the constraints.
+    ///
+    /// \note Once reserved, rebuilding the decomposition with fewer constraints, inserting or
+    /// removing constraints, computing the decomposition and updating a scalar or diagonal damping
+    /// do not allocate any memory. The current decomposition is kept.
+    ///
+    void reserve(const Eigen::Index max_constraint_size);
+
     ///
     /// \brief Returns the Inverse of the Operational Space Inertia Matrix resulting from the
     /// decomposition.
@@ -436,6 +454,80 @@ namespace pinocchio
     void updateDamping(
       internal::BlockDiagonalMatrixTpl<Scalar, OtherOptions, OtherAlignment> && block_damping);
 
+    ///
+    /// \brief Update the damping terms and the Cholesky decomposition of the Delassus part at once.
+    /// Only the rows whose damping has changed are accounted for, through rank-one updates of the
+    /// current decomposition.
+    ///
+    /// \param[in] mus Vector of positive regularization factor allowing to enforce the definite
+    /// property of the KKT matrix.
+    ///
+    /// \remarks A rank-one update on the row i costs O(i^2). The method falls back to
+    /// updateDamping() followed by computeDelassusCholeskyDecomposition() when the decomposition is
+    /// dirty, when the current damping is not diagonal or when too many rows have changed.
+    ///
+    template<typename VectorLike>
+    void rankUpdateDamping(const Eigen::MatrixBase<VectorLike> & mus);
+
+    ///
+    /// \brief Updates the decomposition after the insertion of a constraint, without performing a
+    /// new factorization of the whole KKT matrix.
+    ///
+    /// \param[in] model Model of the dynamical system
+    /// \param[in] data Data related to model, unchanged since the last call to compute().
+    /// \param[in] constraint_models Vector of constraint models, already containing the inserted
+    /// constraint.
+    /// \param[in] constraint_datas Vector of constraint datas, already containing the data of the
+    /// inserted constraint.
+    /// \param[in] constraint_id Index of the inserted constraint in constraint_models.
+    ///
+    /// \remarks The cost scales with the number of inserted rows: the rows of the mass matrix part
+    /// and the rows of the other constraints are kept, and each inserted row is added to the
+    /// Cholesky decomposition of the Delassus part with a rank-one downdate.
+    /// The inserted rows are damped with the minimal damping value. This method assumes that the
+    /// decomposition is not dirty and that the damping is diagonal.
+    ///
+    template<
+      typename S1,
+      int O1,
+      template<typename, int> class JointCollectionTpl,
+      class ConstraintModel,
+      class ConstraintModelAllocator,
+      class ConstraintData,
+      class ConstraintDataAllocator>
+    void insertConstraint(
+      const ModelTpl<S1, O1, JointCollectionTpl> & model,
+      const DataTpl<S1, O1, JointCollectionTpl> & data,
+      const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+      const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+      const std::size_t constraint_id);
+
+    ///
+    /// \brief Updates the decomposition before the removal of a constraint, without performing a
+    /// new factorization of the whole KKT matrix.
+    ///
+    /// \param[in] model Model of the dynamical system
+    /// \param[in] data Data related to model, unchanged since the last call to compute().
+    /// \param[in] constraint_models Vector of constraint models, still containing the removed
+    /// constraint.
+    /// \param[in] constraint_id Index of the removed constraint in constraint_models.
+    ///
+    /// \remarks The cost scales with the number of removed rows, each of them being removed from
+    /// the Cholesky decomposition of the Delassus part with a rank-one update. This method assumes
+    /// that the decomposition is not dirty and that the damping is diagonal.
+    ///
+    template<
+      typename S1,
+      int O1,
+      template<typename, int> class JointCollectionTpl,
+      class ConstraintModel,
+      class ConstraintModelAllocator>
+    void removeConstraint(
+      const ModelTpl<S1, O1, JointCollectionTpl> & model,
+      const DataTpl<S1, O1, JointCollectionTpl> & data,
+      const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+      const std::size_t constraint_id);
+
     ///
     /// \brief Returns the current damping as a block diagonal matrix.
     ///
@@ -515,7 +607,9 @@ namespace pinocchio
 
     // data
   protected:
-    // temporary containing the results of D * U^t
+    // temporary containing the results of D * U^t.
+    // The temporaries below only grow and are accessed through blocks of the current size, so
+    // that removing constraints or rebuilding with fewer constraints does not allocate memory.
     Vector DUt_storage;
     EigenStorageVector D_storage;
     EigenStorageVector Dinv_storage;
@@ -526,6 +620,8 @@ namespace pinocchio
     /// \brief Inverse of the bottom right block of U
     mutable Matrix U4inv_storage;
     mutable RowMatrix OSIMinv_storage, Minv_storage;
+    /// \brief Product of the constraint rows of U with the mass matrix part of D
+    RowMatrix UD_storage;
 
   public:
     typename EigenStorageVector::RefMapType D;
@@ -551,6 +647,8 @@ namespace pinocchio
       const ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
       const Eigen::Index col,
       const Eigen::MatrixBase<VectorLike> & vec);
+
+    friend struct details::ConstraintCholeskyComputeInParallelAlgo<Scalar, Options>;
     ///@}
 
     template<typename S1, int O1>
@@ -606,8 +704,27 @@ namespace pinocchio
 
     void updateSumComplianceDamping();
 
-    EigenIndexVector parents_fromRow;
-    EigenIndexVector nv_subtree_fromRow;
+    /// \brief Fill the sparsity pattern of the mass matrix part, shifted by the constraint
+    /// dimension.
+    template<typename S1, int O1, template<typename, int> class JointCollectionTpl>
+    void computeMassMatrixSparsityPattern(
+      const DataTpl<S1, O1, JointCollectionTpl> & data, const Eigen::Index total_constraint_size);
+
+    /// \brief Inserts or removes constraint rows and columns in the internal storages.
+    void resizeConstraintRows(const Eigen::Index row_id, const Eigen::Index row_shift);
+
+    /// \brief Adds the row row_id to the Cholesky decomposition of the Delassus part, the rows in
+    /// [leading_size, row_id) being not part of the decomposition yet.
+    void insertDelassusRow(const Eigen::Index row_id, const Eigen::Index leading_size);
+
+    /// \brief Rank-one update alpha * z * z^T of the leading block of size dim of the Cholesky
+    /// decomposition of the Delassus part. The vector z is stored in DUt_storage.head(dim).
+    void rankOneUpdateDelassusDecomposition(const Eigen::Index dim, Scalar alpha);
+
+    EigenStorageIndexVector parents_fromRow_storage;
+    typename EigenStorageIndexVector::RefMapType parents_fromRow;
+    EigenStorageIndexVector nv_subtree_fromRow_storage;
+    typename EigenStorageIndexVector::RefMapType nv_subtree_fromRow;
 
     /// \brief Dimension of the tangent of the configuration space of the model
     Eigen::Index nv;
@@ -13,6 +13,19 @@
 
 namespace pinocchio
 {
+  namespace details
+  {
+    ///
+    /// \brief Grows a temporary so that it holds at least rows x cols coefficients. The temporaries
+    /// are only accessed through blocks of the current size, so that they never need to shrink.
+    ///
+    template<typename MatrixLike>
+    void growTemporary(MatrixLike & mat, const Eigen::Index rows, const Eigen::Index cols)
+    {
+      if (mat.rows() < rows || mat.cols() < cols)
+        mat.resize(math::max(mat.rows(), rows), math::max(mat.cols(), cols));
+    }
+  } // namespace details
 
   template<typename Scalar, int Options>
   template<typename S1, int O1, template<typename, int> class JointCollectionTpl>
@@ -94,24 +107,10 @@ namespace pinocchio
 
     const Eigen::Index total_size = nv + total_constraint_size;
 
-    // Compute first parents_fromRow for all the joints.
-    // This code is very similar to the code of Data::computeParents_fromRow,
-    // but shifted with a value corresponding to the number of constraints.
-    parents_fromRow.resize(total_size);
-    parents_fromRow.fill(-1);
-
-    nv_subtree_fromRow.resize(total_size);
+    nv_subtree_fromRow_storage.resize(total_size);
     //      nv_subtree_fromRow.fill(0);
 
-    // Fill nv_subtree_fromRow for model
-    for (int i = 0; i < model.nv; ++i)
-    {
-      if (data.parents_fromRow[size_t(i)] >= 0)
-        parents_fromRow[i + total_constraint_size] =
-          data.parents_fromRow[size_t(i)] + total_constraint_size;
-
-      nv_subtree_fromRow[i + total_constraint_size] = data.nvSubtree_fromRow[size_t(i)];
-    }
+    computeMassMatrixSparsityPattern(data, total_constraint_size);
 
     Eigen::Index row_id = 0;
     for (std::size_t i = 0; i < constraint_models.size(); i++)
@@ -179,9 +178,10 @@ namespace pinocchio
     D_storage.resize(total_size);
     Dinv_storage.resize(total_size);
     U_storage.resize(total_size, total_size);
-    DUt_storage.resize(total_size);
-    U1inv_storage.resize(total_constraint_size, total_constraint_size);
-    OSIMinv_storage.resize(total_constraint_size, total_constraint_size);
+    details::growTemporary(DUt_storage, total_size, 1);
+    details::growTemporary(U1inv_storage, total_constraint_size, total_constraint_size);
+    details::growTemporary(OSIMinv_storage, total_constraint_size, total_constraint_size);
+    details::growTemporary(UD_storage, total_constraint_size, nv);
     U4inv_storage.resize(nv, nv);
     Minv_storage.resize(nv, nv);
 
@@ -195,6 +195,59 @@ namespace pinocchio
     decomposition_dirty = true;
   }
 
+  template<typename Scalar, int Options>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::reserve(
+    const Eigen::Index max_constraint_size)
+  {
+    const Eigen::Index max_size = nv + max_constraint_size;
+
+    D_storage.reserve(max_size);
+    Dinv_storage.reserve(max_size);
+    U_storage.reserve(max_size, max_size);
+    parents_fromRow_storage.reserve(max_size);
+    nv_subtree_fromRow_storage.reserve(max_size);
+    compliance_storage.reserve(max_constraint_size);
+    delassus_block_storage.reserve(max_constraint_size, max_constraint_size);
+
+    details::growTemporary(DUt_storage, max_size, 1);
+    details::growTemporary(U1inv_storage, max_constraint_size, max_constraint_size);
+    details::growTemporary(OSIMinv_storage, max_constraint_size, max_constraint_size);
+    details::growTemporary(UD_storage, max_constraint_size, nv);
+
+    // Warm up the memory of the block diagonal matrices with diagonal blocks of maximal size.
+    const BlockDiagonalMatrix damping(m_damping);
+    const BlockDiagonalMatrix sum_compliance_damping(m_sum_compliance_damping);
+    m_damping = Vector::Zero(max_constraint_size).asDiagonal();
+    m_sum_compliance_damping = m_damping;
+    m_damping = damping;
+    m_sum_compliance_damping = sum_compliance_damping;
+  }
+
+  template<typename Scalar, int Options>
+  template<typename S1, int O1, template<typename, int> class JointCollectionTpl>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::computeMassMatrixSparsityPattern(
+    const DataTpl<S1, O1, JointCollectionTpl> & data, const Eigen::Index total_constraint_size)
+  {
+    const Eigen::Index total_size = nv + total_constraint_size;
+    assert(nv_subtree_fromRow.size() == total_size);
+
+    // Compute first parents_fromRow for all the joints.
+    // This code is very similar to the code of Data::computeParents_fromRow,
+    // but shifted with a value corresponding to the number of constraints.
+    parents_fromRow_storage.resize(total_size);
+    parents_fromRow.fill(-1);
+
+    // Fill nv_subtree_fromRow for model
+    for (Eigen::Index i = 0; i < nv; ++i)
+    {
+      if (data.parents_fromRow[size_t(i)] >= 0)
+        parents_fromRow[i + total_constraint_size] =
+          data.parents_fromRow[size_t(i)] + total_constraint_size;
+
+      nv_subtree_fromRow[i + total_constraint_size] = data.nvSubtree_fromRow[size_t(i)];
+    }
+  }
+
   template<typename Scalar, int Options>
   template<
     typename S1,
@@ -354,7 +407,10 @@ namespace pinocchio
     // delassus_block.noalias() = OSIMinv
     // * UtopRight.transpose();
 
-    delassus_block.noalias() = (UtopRight * Dtail.asDiagonal()) * UtopRight.transpose();
+    // The product U * D is stored in a temporary, as Eigen would otherwise allocate it on the heap.
+    auto UD = UD_storage.topLeftCorner(total_constraint_size, nv);
+    UD.noalias() = UtopRight * Dtail.asDiagonal();
+    delassus_block.noalias() = UD * UtopRight.transpose();
   }
 
   template<typename Scalar, int Options>
@@ -419,7 +475,7 @@ namespace pinocchio
   {
     //      PINOCCHIO_CHECK_INPUT_ARGUMENT(check_expression_if_real<Scalar>(mu >= 0), "mu should be
     //      positive.");
-    m_damping = BlockDiagonalMatrix::ScalarIdentity(constraintDim(), mu);
+    m_damping.rebuildScalarIdentity(constraintDim(), mu);
     updateSumComplianceDamping();
   }
 
@@ -445,6 +501,440 @@ namespace pinocchio
     updateSumComplianceDamping();
   }
 
+  namespace details
+  {
+    /// \brief Whether a block of a block diagonal matrix has only diagonal coefficients.
+    template<typename MatrixBlockElement>
+    bool isDiagonalBlock(const MatrixBlockElement & block)
+    {
+      typedef internal::MatrixBlockType MatrixBlockType;
+      if (block.type() == MatrixBlockType::NestedBlockDiagonal)
+      {
+        for (const auto & nested_block : block.nested_blocks())
+          if (!isDiagonalBlock(nested_block))
+            return false;
+        return true;
+      }
+      return block.type() != MatrixBlockType::Plain && block.type() != MatrixBlockType::Undefined;
+    }
+
+    template<typename BlockDiagonalMatrix>
+    bool isDiagonal(const BlockDiagonalMatrix & mat)
+    {
+      for (const auto & block : mat.blocks())
+        if (!isDiagonalBlock(block))
+          return false;
+      return true;
+    }
+
+    ///
+    /// \brief Inserts (row_shift > 0) or removes (row_shift < 0) |row_shift| rows and columns at
+    /// index row_id of a square row-major storage. The other coefficients are kept, the inserted
+    /// ones are set to zero.
+    ///
+    template<typename MatrixLike>
+    void shiftSquareStorage(
+      internal::EigenStorageTpl<MatrixLike> & storage,
+      const Eigen::Index row_id,
+      const Eigen::Index row_shift)
+    {
+      typedef internal::EigenStorageTpl<MatrixLike> EigenStorage;
+      typedef typename EigenStorage::PlainMatrixType PlainMatrixType;
+      typedef typename EigenStorage::Scalar Scalar;
+      static_assert(PlainMatrixType::IsRowMajor, "The storage should be row major.");
+
+      assert(storage.rows() == storage.cols());
+      const Eigen::Index old_dim = storage.rows();
+      const Eigen::Index new_dim = old_dim + row_shift;
+      assert(row_id >= 0 && row_id <= old_dim && new_dim >= 0);
+
+      if (row_shift > 0)
+      {
+        // The coefficients are moved towards the end of the storage: iterate backward.
+        PlainMatrixType copy;
+        const Scalar * src = storage.map().data();
+        if (new_dim * new_dim > storage.capacity())
+        {
+          copy = storage.map();
+          src = copy.data();
+        }
+        storage.resize(new_dim, new_dim);
+        Scalar * dst = storage.map().data();
+        for (Eigen::Index i = old_dim - 1; i >= 0; --i)
+        {
+          const Eigen::Index new_i = i < row_id ? i : i + row_shift;
+          for (Eigen::Index j = old_dim - 1; j >= 0; --j)
+          {
+            const Eigen::Index new_j = j < row_id ? j : j + row_shift;
+            dst[new_i * new_dim + new_j] = src[i * old_dim + j];
+          }
+        }
+        storage.map().middleRows(row_id, row_shift).setZero();
+        storage.map().middleCols(row_id, row_shift).setZero();
+      }
+      else if (row_shift < 0)
+      {
+        // The coefficients are moved towards the beginning of the storage: iterate forward.
+        Scalar * data = storage.map().data();
+        for (Eigen::Index new_i = 0; new_i < new_dim; ++new_i)
+        {
+          const Eigen::Index i = new_i < row_id ? new_i : new_i - row_shift;
+          for (Eigen::Index new_j = 0; new_j < new_dim; ++new_j)
+          {
+            const Eigen::Index j = new_j < row_id ? new_j : new_j - row_shift;
+            data[new_i * new_dim + new_j] = data[i * old_dim + j];
+          }
+        }
+        storage.resize(new_dim, new_dim);
+      }
+    }
+
+    ///
+    /// \brief Inserts (row_shift > 0) or removes (row_shift < 0) |row_shift| coefficients at index
+    /// row_id of a vector storage. The other coefficients are kept, the inserted ones are set to
+    /// zero.
+    ///
+    template<typename VectorLike>
+    void shiftVectorStorage(
+      internal::EigenStorageTpl<VectorLike> & storage,
+      const Eigen::Index row_id,
+      const Eigen::Index row_shift)
+    {
+      const Eigen::Index old_size = storage.size();
+      const Eigen::Index new_size = old_size + row_shift;
+      assert(row_id >= 0 && row_id <= old_size && new_size >= 0);
+
+      if (row_shift > 0)
+      {
+        if (new_size > storage.capacity())
+          storage.conservativeResize(new_size);
+        else
+          storage.resize(new_size);
+        auto & vec = storage.map();
+        std::copy_backward(vec.data() + row_id, vec.data() + old_size, vec.data() + new_size);
+        vec.segment(row_id, row_shift).setZero();
+      }
+      else if (row_shift < 0)
+      {
+        auto & vec = storage.map();
+        std::copy(vec.data() + row_id - row_shift, vec.data() + old_size, vec.data() + row_id);
+        storage.resize(new_size);
+      }
+    }
+  } // namespace details
+
+  template<typename Scalar, int Options>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::resizeConstraintRows(
+    const Eigen::Index row_id, const Eigen::Index row_shift)
+  {
+    const Eigen::Index old_total_constraint_size = constraintDim();
+    const Eigen::Index total_constraint_size = old_total_constraint_size + row_shift;
+    const Eigen::Index total_size = nv + total_constraint_size;
+
+    details::shiftSquareStorage(U_storage, row_id, row_shift);
+    details::shiftSquareStorage(delassus_block_storage, row_id, row_shift);
+    details::shiftVectorStorage(D_storage, row_id, row_shift);
+    details::shiftVectorStorage(Dinv_storage, row_id, row_shift);
+    details::shiftVectorStorage(compliance_storage, row_id, row_shift);
+
+    // The constraint rows located before row_id see the constraint dimension change, while the
+    // following rows are only shifted.
+    nv_subtree_fromRow.head(row_id).array() += row_shift;
+    details::shiftVectorStorage(nv_subtree_fromRow_storage, row_id, row_shift);
+    assert(nv_subtree_fromRow.size() == total_size);
+
+    details::growTemporary(DUt_storage, total_size, 1);
+    details::growTemporary(U1inv_storage, total_constraint_size, total_constraint_size);
+    details::growTemporary(OSIMinv_storage, total_constraint_size, total_constraint_size);
+    details::growTemporary(UD_storage, total_constraint_size, nv);
+  }
+
+  template<typename Scalar, int Options>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::rankOneUpdateDelassusDecomposition(
+    const Eigen::Index dim, Scalar alpha)
+  {
+    // Rank-one update of the U * D * U^T decomposition, adapted from the method C1 of Gill et al.,
+    // "Methods for modifying matrix factorizations" (1974).
+    auto z = DUt_storage.head(dim);
+    for (Eigen::Index j = dim - 1; j >= 0; --j)
+    {
+      const Scalar p = z[j];
+      const Scalar d = D[j] + alpha * p * p;
+      assert(
+        check_expression_if_real<Scalar>(d != Scalar(0))
+        && "The diagonal element is equal to zero.");
+      const Scalar beta = p * alpha / d;
+      alpha *= D[j] / d;
+      D[j] = d;
+      Dinv[j] = Scalar(1) / d;
+
+      auto U_col = U.col(j).head(j);
+      z.head(j) -= p * U_col;
+      U_col += beta * z.head(j);
+    }
+  }
+
+  template<typename Scalar, int Options>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::insertDelassusRow(
+    const Eigen::Index row_id, const Eigen::Index leading_size)
+  {
+    const Eigen::Index trailing_size = constraintDim() - row_id - 1;
+
+    // Solve U_T * DUt = A_T with U_T the trailing part of the decomposition and A_T the trailing
+    // part of the inserted column.
+    auto DUt_partial = DUt_storage.head(trailing_size);
+    DUt_partial = -delassus_block.row(row_id).segment(row_id + 1, trailing_size).transpose();
+    U.block(row_id + 1, row_id + 1, trailing_size, trailing_size)
+      .template triangularView<Eigen::UnitUpper>()
+      .solveInPlace(DUt_partial);
+
+    U(row_id, row_id) = Scalar(1);
+    U.row(row_id).segment(row_id + 1, trailing_size) =
+      DUt_partial.cwiseProduct(Dinv.segment(row_id + 1, trailing_size)).transpose();
+    D[row_id] = -delassus_block(row_id, row_id)
+                - U.row(row_id).segment(row_id + 1, trailing_size).dot(DUt_partial);
+    assert(
+      check_expression_if_real<Scalar>(D[row_id] != Scalar(0))
+      && "The diagonal element is equal to zero.");
+    Dinv[row_id] = Scalar(1) / D[row_id];
+
+    for (Eigen::Index _i = 0; _i < leading_size; ++_i)
+    {
+      U(_i, row_id) =
+        -delassus_block(_i, row_id) - U.row(_i).segment(row_id + 1, trailing_size).dot(DUt_partial);
+      U(_i, row_id) *= Dinv[row_id];
+    }
+
+    // The leading part of the decomposition no longer accounts for the inserted row.
+    DUt_storage.head(leading_size) = U.col(row_id).head(leading_size);
+    rankOneUpdateDelassusDecomposition(leading_size, -D[row_id]);
+  }
+
+  template<typename Scalar, int Options>
+  template<typename VectorLike>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::rankUpdateDamping(
+    const Eigen::MatrixBase<VectorLike> & mus)
+  {
+    EIGEN_STATIC_ASSERT_VECTOR_ONLY(VectorLike)
+    const Eigen::Index total_constraint_size = constraintDim();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(mus.size(), total_constraint_size);
+
+    if (decomposition_dirty || !details::isDiagonal(m_damping))
+    {
+      updateDamping(mus);
+      computeDelassusCholeskyDecomposition();
+      return;
+    }
+
+    const Vector damping = m_damping.diagonal();
+
+    // A rank-one update on the row i costs about 2 i^2 operations, while the full decomposition
+    // costs about n^3 / 3 operations.
+    Eigen::Index update_cost = 0;
+    for (Eigen::Index i = 0; i < total_constraint_size; ++i)
+    {
+      if (check_expression_if_real<Scalar, true>(mus[i] != damping[i]))
+        update_cost += 2 * (i + 1) * (i + 1);
+    }
+
+    if (3 * update_cost > total_constraint_size * total_constraint_size * total_constraint_size)
+    {
+      updateDamping(mus);
+      computeDelassusCholeskyDecomposition();
+      return;
+    }
+
+    for (Eigen::Index i = total_constraint_size - 1; i >= 0; --i)
+    {
+      if (!check_expression_if_real<Scalar, true>(mus[i] != damping[i]))
+        continue;
+
+      // The Delassus part is factorized as -(G + R): increasing the damping decreases the
+      // diagonal coefficient of the factorized matrix.
+      DUt_storage.head(i + 1).setZero();
+      DUt_storage[i] = Scalar(1);
+      rankOneUpdateDelassusDecomposition(i + 1, damping[i] - mus[i]);
+    }
+
+    m_damping = mus.asDiagonal();
+    m_sum_compliance_damping = m_damping + compliance.asDiagonal();
+  }
+
+  template<typename Scalar, int Options>
+  template<
+    typename S1,
+    int O1,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::insertConstraint(
+    const ModelTpl<S1, O1, JointCollectionTpl> & model,
+    const DataTpl<S1, O1, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const std::size_t constraint_id)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+    assert(model.check(MimicChecker()) && "Function does not support mimic joints");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      constraint_models.size() == constraint_datas.size(),
+      "The number of constraints between constraint_models and constraint_datas vectors is "
+      "different.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      constraint_id < constraint_models.size(), "constraint_id is out of range.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(model.nv == nv, "The model has changed since the last rebuild.");
+    PINOCCHIO_THROW_IF(
+      decomposition_dirty, std::logic_error,
+      "The ConstraintCholeskyDecompositionTpl has dirty quantities. Please call the compute() "
+      "method first.");
+    PINOCCHIO_THROW_IF(
+      !details::isDiagonal(m_damping), std::invalid_argument,
+      "insertConstraint only supports a diagonal damping.");
+
+    const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+    const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
+
+    Eigen::Index row_id = 0;
+    for (std::size_t i = 0; i < constraint_id; ++i)
+      row_id += internal::helper::get_ref(constraint_models[i]).residualSize();
+
+    const Eigen::Index constraint_size = cmodel.residualSize();
+    const Eigen::Index old_total_constraint_size = constraintDim();
+    const Eigen::Index total_constraint_size = old_total_constraint_size + constraint_size;
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      residualSize(constraint_models) == total_constraint_size,
+      "constraint_models should only differ from the current constraints by the inserted one.");
+
+    const Vector old_damping = m_damping.diagonal();
+    Vector damping(total_constraint_size);
+    damping.head(row_id) = old_damping.head(row_id);
+    damping.segment(row_id, constraint_size).fill(min_damping_value);
+    damping.tail(old_total_constraint_size - row_id) =
+      old_damping.tail(old_total_constraint_size - row_id);
+
+    resizeConstraintRows(row_id, constraint_size);
+    computeMassMatrixSparsityPattern(data, total_constraint_size);
+
+    for (Eigen::Index k = 0; k < constraint_size; ++k)
+    {
+      const Eigen::Index current_row = row_id + k;
+      cmodel.getRowIndexes(model, data, cdata, k, m_scratch_row_indexes);
+      nv_subtree_fromRow[current_row] =
+        total_constraint_size - current_row + 1
+        + (m_scratch_row_indexes.size() > 0 ? m_scratch_row_indexes.back() : 0);
+    }
+
+    cmodel.retrieveCompliance(compliance.segment(row_id, constraint_size));
+    m_damping = damping.asDiagonal();
+    m_sum_compliance_damping = m_damping + compliance.asDiagonal();
+
+    // Constraint filling, reusing the decomposition of the mass matrix part
+    auto U_block = U.block(row_id, total_constraint_size, constraint_size, nv);
+    cmodel.jacobian(model, data, cdata, U_block);
+
+    for (Eigen::Index j = nv - 1; j >= 0; --j)
+    {
+      const Eigen::Index jj = total_constraint_size + j; // shifted index
+      const Eigen::Index NVT = nv_subtree_fromRow[jj] - 1;
+
+      auto DUt_partial = DUt_storage.head(NVT);
+      if (NVT)
+        DUt_partial.noalias() =
+          U.row(jj).segment(jj + 1, NVT).transpose().cwiseProduct(D.segment(jj + 1, NVT));
+
+      for (Eigen::Index k = 0; k < constraint_size; ++k)
+      {
+        cmodel.getRowSparsityPattern(model, data, cdata, k, m_scratch_colwise_sparsity);
+        if (m_scratch_colwise_sparsity[j])
+        {
+          const Eigen::Index current_row = row_id + k;
+          U(current_row, jj) -= U.row(current_row).segment(jj + 1, NVT).dot(DUt_partial);
+          U(current_row, jj) *= Dinv[jj];
+        }
+      }
+    }
+
+    // Rows and columns of the Delassus matrix related to the inserted constraint
+    {
+      const auto UtopRight = U.topRightCorner(total_constraint_size, nv);
+      const auto Dtail = D.tail(nv);
+      delassus_block.middleRows(row_id, constraint_size).noalias() =
+        (UtopRight.middleRows(row_id, constraint_size) * Dtail.asDiagonal())
+        * UtopRight.transpose();
+      for (Eigen::Index k = row_id; k < row_id + constraint_size; ++k)
+        for (Eigen::Index i = 0; i < total_constraint_size; ++i)
+          delassus_block(i, k) = delassus_block(k, i);
+    }
+
+    // Insert the new rows in the decomposition of the Delassus part, starting from the last one.
+    m_sum_compliance_damping.addTo(delassus_block);
+    for (Eigen::Index k = row_id + constraint_size - 1; k >= row_id; --k)
+      insertDelassusRow(k, row_id);
+    m_sum_compliance_damping.subTo(delassus_block);
+
+    decomposition_dirty = false;
+  }
+
+  template<typename Scalar, int Options>
+  template<
+    typename S1,
+    int O1,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator>
+  void ConstraintCholeskyDecompositionTpl<Scalar, Options>::removeConstraint(
+    const ModelTpl<S1, O1, JointCollectionTpl> & model,
+    const DataTpl<S1, O1, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::size_t constraint_id)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      constraint_id < constraint_models.size(), "constraint_id is out of range.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(model.nv == nv, "The model has changed since the last rebuild.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      residualSize(constraint_models) == constraintDim(),
+      "constraint_models should correspond to the current constraints.");
+    PINOCCHIO_THROW_IF(
+      decomposition_dirty, std::logic_error,
+      "The ConstraintCholeskyDecompositionTpl has dirty quantities. Please call the compute() "
+      "method first.");
+    PINOCCHIO_THROW_IF(
+      !details::isDiagonal(m_damping), std::invalid_argument,
+      "removeConstraint only supports a diagonal damping.");
+
+    Eigen::Index row_id = 0;
+    for (std::size_t i = 0; i < constraint_id; ++i)
+      row_id += internal::helper::get_ref(constraint_models[i]).residualSize();
+
+    const Eigen::Index constraint_size =
+      internal::helper::get_ref(constraint_models[constraint_id]).residualSize();
+    const Eigen::Index old_total_constraint_size = constraintDim();
+    const Eigen::Index total_constraint_size = old_total_constraint_size - constraint_size;
+
+    // The leading part of the decomposition takes back the contribution of the removed rows.
+    // The trailing part of the decomposition is left unchanged.
+    for (Eigen::Index k = row_id; k < row_id + constraint_size; ++k)
+    {
+      DUt_storage.head(row_id) = U.col(k).head(row_id);
+      rankOneUpdateDelassusDecomposition(row_id, D[k]);
+    }
+
+    const Vector old_damping = m_damping.diagonal();
+    Vector damping(total_constraint_size);
+    damping.head(row_id) = old_damping.head(row_id);
+    damping.tail(total_constraint_size - row_id) = old_damping.tail(total_constraint_size - row_id);
+
+    resizeConstraintRows(row_id, -constraint_size);
+    computeMassMatrixSparsityPattern(data, total_constraint_size);
+
+    m_damping = damping.asDiagonal();
+    m_sum_compliance_damping = m_damping + compliance.asDiagonal();
+    decomposition_dirty = false;
+  }
+
   template<typename Scalar, int Options>
   template<typename MatrixLike>
   void ConstraintCholeskyDecompositionTpl<Scalar, Options>::solveInPlace(
@@ -890,8 +1380,9 @@ namespace pinocchio
     const auto dim = constraintDim();
 
     MatrixType & res_ = res.const_cast_derived();
-    OSIMinv_storage.noalias() = D.head(dim).asDiagonal() * U1.adjoint();
-    res_.noalias() = -U1 * OSIMinv_storage;
+    auto OSIMinv = OSIMinv_storage.topLeftCorner(dim, dim);
+    OSIMinv.noalias() = D.head(dim).asDiagonal() * U1.adjoint();
+    res_.noalias() = -U1 * OSIMinv;
     if (enforce_symmetry)
       enforceSymmetry(res_);
   }
@@ -925,10 +1416,12 @@ namespace pinocchio
 
     const auto dim = constraintDim();
 
-    U1inv_storage.setIdentity();
-    U1.solveInPlace(U1inv_storage); // TODO: implement Sparse Inverse
-    OSIMinv_storage.noalias() = -U1inv_storage.adjoint() * Dinv.head(dim).asDiagonal();
-    res.noalias() = OSIMinv_storage * U1inv_storage;
+    auto U1inv = U1inv_storage.topLeftCorner(dim, dim);
+    auto OSIMinv = OSIMinv_storage.topLeftCorner(dim, dim);
+    U1inv.setIdentity();
+    U1.solveInPlace(U1inv); // TODO: implement Sparse Inverse
+    OSIMinv.noalias() = -U1inv.adjoint() * Dinv.head(dim).asDiagonal();
+    res.noalias() = OSIMinv * U1inv;
   }
 
   template<typename Scalar, int Options>
@@ -1016,8 +1509,7 @@ namespace pinocchio
     return U_storage.sizeInBytes() + D_storage.sizeInBytes() + Dinv_storage.sizeInBytes()
            + compliance_storage.sizeInBytes() + m_damping.sizeInBytes()
            + m_sum_compliance_damping.sizeInBytes() + delassus_block_storage.sizeInBytes()
-           + pinocchio::internal::sizeInBytes(parents_fromRow)
-           + pinocchio::internal::sizeInBytes(nv_subtree_fromRow)
+           + parents_fromRow_storage.sizeInBytes() + nv_subtree_fromRow_storage.sizeInBytes()
       // + pinocchio::sizeInBytes(rowise_sparsity_pattern)
       ;
   }
@@ -463,6 +463,9 @@ namespace pinocchio
       const Eigen::MatrixBase<ConfigVectorType> & q)
     {
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       PINOCCHIO_CHECK_ARGUMENT_SIZE(
         q.size(), model.nq, "The configuration vector is not equal to model.nq.");
 
@@ -507,6 +510,9 @@ namespace pinocchio
       const Eigen::MatrixBase<ConfigVectorType> & q)
     {
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       PINOCCHIO_CHECK_ARGUMENT_SIZE(
         q.size(), model.nq, "The configuration vector is not equal to model.nq.");
 
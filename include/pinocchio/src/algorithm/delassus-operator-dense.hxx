@@ -187,7 +187,7 @@ namespace pinocchio
       m_cholesky_decomposition_data.setZero();
 
       // resize/reset damping and compliance
-      m_damping = DampingType::Zero(mat.rows());
+      m_damping.rebuildZero(mat.rows());
       m_compliance_storage.resize(mat.rows());
       m_compliance.setZero();
 
@@ -260,6 +260,27 @@ namespace pinocchio
       m_cholesky_decomposition_dirty = true;
     }
 
+    /// \brief Reserves the memory needed to handle Delassus matrices of size up to max_size.
+    /// Rebuilding the operator with a smaller matrix or updating its diagonal damping then does
+    /// not allocate any memory.
+    /// \note The current content of the operator is kept.
+    void reserve(const Eigen::Index max_size)
+    {
+      m_delassus_matrix_storage.reserve(max_size, max_size);
+      m_cholesky_decomposition_data_storage.reserve(max_size, max_size);
+      m_compliance_storage.reserve(max_size);
+
+      // the decomposition must point to the possibly reallocated data.
+      m_cholesky_decomposition.~CholeskyDecomposition();
+      new (&m_cholesky_decomposition) CholeskyDecomposition(m_cholesky_decomposition_data);
+      m_cholesky_decomposition_dirty = true;
+
+      // warm up the memory of the damping with a diagonal damping of maximal size.
+      const DampingType damping(m_damping);
+      m_damping = VectorXs::Zero(max_size).asDiagonal();
+      m_damping = damping;
+    }
+
     /// \brief Comparison operator.
     bool operator==(const Self & other) const
     {
@@ -144,6 +144,7 @@ namespace pinocchio
     typedef typename traits<Self>::BlockDiagonalMatrix BlockDiagonalMatrix;
     typedef typename traits<Self>::getDampingReturnType getDampingReturnType;
     typedef typename traits<Self>::getComplianceReturnType getComplianceReturnType;
+    typedef PowerIterationAlgoTpl<VectorXs> PowerIterationAlgo;
 
     typedef typename traits<Self>::Model Model;
     typedef StorageHolder<const Model> ModelHolder;
@@ -186,6 +187,7 @@ namespace pinocchio
     , m_compliance(m_compliance_storage.map())
     , m_sum_compliance_damping(VectorXs::Constant(m_size, min_damping_value).asDiagonal())
     , m_sum_compliance_damping_inverse(VectorXs::Constant(m_size, min_damping_value).asDiagonal())
+    , m_power_iteration(m_size)
     {
       assert(model().check(data()) && "data is not consistent with model.");
       PINOCCHIO_CHECK_ARGUMENT_SIZE(
@@ -211,6 +213,8 @@ namespace pinocchio
       m_compliance_storage = other.m_compliance_storage;
       m_sum_compliance_damping = other.m_sum_compliance_damping;
       m_sum_compliance_damping_inverse = other.m_sum_compliance_damping_inverse;
+      m_power_iteration = other.m_power_iteration;
+      m_largest_eigenvalue_estimate = other.m_largest_eigenvalue_estimate;
     }
 
     DelassusOperatorRigidBodySystemsTpl &
@@ -258,7 +262,52 @@ namespace pinocchio
     {
       return m_damping.sizeInBytes() + m_compliance_storage.sizeInBytes()
              + m_sum_compliance_damping.sizeInBytes()
-             + m_sum_compliance_damping_inverse.sizeInBytes() + m_internal_data.sizeInBytes();
+             + m_sum_compliance_damping_inverse.sizeInBytes() + m_internal_data.sizeInBytes()
+             + 3 * pinocchio::internal::sizeInBytes(m_power_iteration.principal_eigen_vector);
+    }
+
+    /// \brief Estimates the largest eigenvalue of the Delassus operator (damping included) with
+    /// power iterations, warm-started from the principal eigenvector of the previous call.
+    ///
+    /// \param[in] max_it Maximum number of power iterations.
+    /// \param[in] rel_tol Relative tolerance on the variation of the eigenvalue estimate.
+    ///
+    /// \returns The estimate of the largest eigenvalue, which is also cached in the operator.
+    ///
+    /// \remarks The principal eigenvector is kept between two calls. As the Delassus operator
+    /// varies slowly between two consecutive time steps, only a few iterations are then needed to
+    /// refresh the estimate, instead of building a new Krylov basis from scratch.
+    /// The cached eigenvector is discarded when the size of the operator changes.
+    /// This method assumes that compute() has been called beforehand.
+    ///
+    Scalar computeLargestEigenvalueEstimate(
+      const int max_it = 100, const Scalar rel_tol = Scalar(1e-6)) const
+    {
+      m_power_iteration.max_it = max_it;
+      m_power_iteration.rel_tol = rel_tol;
+      m_power_iteration.run(*this);
+      m_largest_eigenvalue_estimate = m_power_iteration.largest_eigen_value;
+      return m_largest_eigenvalue_estimate.value();
+    }
+
+    /// \brief Returns the last estimate of the largest eigenvalue, if any.
+    const std::optional<Scalar> & getLargestEigenvalueEstimate() const
+    {
+      return m_largest_eigenvalue_estimate;
+    }
+
+    /// \brief Returns the number of power iterations performed during the last estimate of the
+    /// largest eigenvalue.
+    int getLargestEigenvalueEstimateIterations() const
+    {
+      return math::min(m_power_iteration.it + 1, m_power_iteration.max_it);
+    }
+
+    /// \brief Discards the cached estimate of the largest eigenvalue and its eigenvector.
+    void resetLargestEigenvalueEstimate()
+    {
+      m_power_iteration.reset();
+      m_largest_eigenvalue_estimate.reset();
     }
 
     /// \brief Const getter for model.
@@ -547,6 +596,10 @@ namespace pinocchio
     typename EigenStorageVector::RefMapType m_compliance;
     BlockDiagonalMatrix m_sum_compliance_damping;
     BlockDiagonalMatrix m_sum_compliance_damping_inverse;
+
+    // Spectral estimate cached across the calls
+    mutable PowerIterationAlgo m_power_iteration;
+    mutable std::optional<Scalar> m_largest_eigenvalue_estimate;
   };
 
 } // namespace pinocchio
@@ -596,6 +649,12 @@ namespace pinocchio
     assert(m_sum_compliance_damping.rows() == m_size);
     assert(m_sum_compliance_damping_inverse.rows() == m_size);
 
+    if (m_power_iteration.principal_eigen_vector.size() != m_size)
+    {
+      m_power_iteration = PowerIterationAlgo(m_size);
+      m_largest_eigenvalue_estimate.reset();
+    }
+
     retrieveConstraintCompliance(internal::helper::get_ref(constraint_models_ref), m_compliance);
 
     computeJointMinimalOrdering(model(), data(), internal::helper::get_ref(constraint_models_ref));
@@ -108,6 +108,130 @@ namespace pinocchio
     }
   };
 
+  namespace details
+  {
+    ///
+    /// \brief Computes the extended motion propagators and the lambdas of each contact, from
+    /// which the blocks of the Delassus matrix are obtained.
+    ///
+    template<
+      typename Scalar,
+      int Options,
+      template<typename, int> class JointCollectionTpl,
+      typename ConfigVectorType,
+      class ModelAllocator,
+      class DataAllocator>
+    void computeDelassusPropagators(
+      const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+      DataTpl<Scalar, Options, JointCollectionTpl> & data,
+      const Eigen::MatrixBase<ConfigVectorType> & q,
+      const std::vector<RigidConstraintModelTpl<Scalar, Options>, ModelAllocator> & contact_models,
+      std::vector<RigidConstraintDataTpl<Scalar, Options>, DataAllocator> & contact_data,
+      const Scalar mu)
+    {
+      typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+      typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
+
+      typedef typename Model::JointIndex JointIndex;
+      typedef typename Model::SE3 SE3;
+      typedef typename Model::IndexVector IndexVector;
+      typedef RigidConstraintModelTpl<Scalar, Options> RigidConstraintModel;
+      typedef RigidConstraintDataTpl<Scalar, Options> RigidConstraintData;
+
+      typedef ComputeOSIMForwardStep<Scalar, Options, JointCollectionTpl, ConfigVectorType> Pass1;
+      for (JointIndex i = 1; i < (JointIndex)model.njoints; ++i)
+      {
+        Pass1::run(
+          model.joints[i], data.joints[i], typename Pass1::ArgsType(model, data, q.derived()));
+      }
+
+      for (size_t k = 0; k < contact_models.size(); ++k)
+      {
+        const RigidConstraintModel & cmodel = contact_models[k];
+        RigidConstraintData & cdata = contact_data[k];
+
+        const JointIndex joint1_id = cmodel.joint1_id;
+
+        // Compute relative placement between the joint and the contact frame
+        SE3 & oMc = cdata.oMc1;
+        oMc = data.oMi[joint1_id] * cmodel.joint1_placement; // contact placement
+
+        typedef typename Data::Inertia Inertia;
+        typedef typename Inertia::Symmetric3 Symmetric3;
+
+        // Add contact inertia to the joint articulated inertia
+        Symmetric3 S(Symmetric3::Zero());
+        if (cmodel.type == CONTACT_6D)
+          S.setDiagonal(Symmetric3::Vector3::Constant(mu));
+
+        const Inertia contact_inertia(mu, oMc.translation(), S);
+        data.oYaba[joint1_id] += contact_inertia.matrix();
+      }
+
+      typedef ComputeOSIMBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+      for (JointIndex i = (JointIndex)model.njoints - 1; i > 0; --i)
+      {
+        Pass2::run(model.joints[i], data.joints[i], typename Pass2::ArgsType(model, data));
+      }
+
+      for (size_t k = 0; k < contact_models.size(); ++k)
+      {
+        typedef typename RigidConstraintData::VectorOfMatrix6 VectorOfMatrix6;
+        const RigidConstraintModel & cmodel = contact_models[k];
+        RigidConstraintData & cdata = contact_data[k];
+
+        const JointIndex joint1_id = cmodel.joint1_id;
+        const SE3 & oMc1 = cdata.oMc1;
+        const IndexVector & support1 = model.supports[joint1_id];
+
+        {
+          VectorOfMatrix6 & propagators = cdata.extended_motion_propagators_joint1;
+          VectorOfMatrix6 & lambdas = cdata.lambdas_joint1;
+          switch (cmodel.type)
+          {
+          case CONTACT_3D: {
+            oMc1.toActionMatrixInverse(propagators.back());
+            propagators.back().template bottomRows<3>().setZero();
+            for (size_t j = support1.size() - 1; j > 1; --j)
+            {
+              lambdas[j].template leftCols<3>().noalias() =
+                data.oK[(size_t)support1[j]] * propagators[j].template topRows<3>().transpose();
+              propagators[j - 1].template topRows<3>().noalias() =
+                propagators[j].template topRows<3>() * data.oL[(size_t)support1[j]];
+            }
+            lambdas[1].template leftCols<3>().noalias() =
+              data.oK[(size_t)support1[1]] * propagators[1].template topRows<3>().transpose();
+
+            for (size_t j = 2; j < support1.size(); ++j)
+            {
+              lambdas[j].template leftCols<3>().noalias() +=
+                data.oL[(size_t)support1[j]] * lambdas[j - 1].template leftCols<3>();
+            }
+            break;
+          }
+          case CONTACT_6D: {
+            oMc1.toActionMatrixInverse(propagators.back());
+            for (size_t j = support1.size() - 1; j > 1; --j)
+            {
+              lambdas[j].noalias() = data.oK[(size_t)support1[j]] * propagators[j].transpose();
+              propagators[j - 1].noalias() = propagators[j] * data.oL[(size_t)support1[j]];
+            }
+            lambdas[1].noalias() = data.oK[(size_t)support1[1]] * propagators[1].transpose();
+
+            for (size_t j = 2; j < support1.size(); ++j)
+            {
+              lambdas[j].noalias() += data.oL[(size_t)support1[j]] * lambdas[j - 1];
+            }
+            break;
+          }
+          default:
+            PINOCCHIO_UNREACHABLE();
+          }
+        }
+      }
+    }
+  } // namespace details
+
   template<
     typename Scalar,
     int Options,
@@ -141,105 +265,19 @@ namespace pinocchio
     PINOCCHIO_CHECK_ARGUMENT_SIZE(delassus_.cols(), constraint_total_size);
 
     typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
-    typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
-
     typedef typename Model::JointIndex JointIndex;
-    typedef typename Model::SE3 SE3;
-    typedef typename Model::IndexVector IndexVector;
     typedef RigidConstraintModelTpl<Scalar, Options> RigidConstraintModel;
     typedef RigidConstraintDataTpl<Scalar, Options> RigidConstraintData;
+    typedef typename RigidConstraintData::VectorOfMatrix6 VectorOfMatrix6;
 
-    typedef ComputeOSIMForwardStep<Scalar, Options, JointCollectionTpl, ConfigVectorType> Pass1;
-    for (JointIndex i = 1; i < (JointIndex)model.njoints; ++i)
-    {
-      Pass1::run(
-        model.joints[i], data.joints[i], typename Pass1::ArgsType(model, data, q.derived()));
-    }
-
-    for (size_t k = 0; k < contact_models.size(); ++k)
-    {
-      const RigidConstraintModel & cmodel = contact_models[k];
-      RigidConstraintData & cdata = contact_data[k];
-
-      const JointIndex joint1_id = cmodel.joint1_id;
-
-      // Compute relative placement between the joint and the contact frame
-      SE3 & oMc = cdata.oMc1;
-      oMc = data.oMi[joint1_id] * cmodel.joint1_placement; // contact placement
-
-      typedef typename Data::Inertia Inertia;
-      typedef typename Inertia::Symmetric3 Symmetric3;
-
-      // Add contact inertia to the joint articulated inertia
-      Symmetric3 S(Symmetric3::Zero());
-      if (cmodel.type == CONTACT_6D)
-        S.setDiagonal(Symmetric3::Vector3::Constant(mu));
-
-      const Inertia contact_inertia(mu, oMc.translation(), S);
-      data.oYaba[joint1_id] += contact_inertia.matrix();
-    }
-
-    typedef ComputeOSIMBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
-    for (JointIndex i = (JointIndex)model.njoints - 1; i > 0; --i)
-    {
-      Pass2::run(model.joints[i], data.joints[i], typename Pass2::ArgsType(model, data));
-    }
+    details::computeDelassusPropagators(model, data, q, contact_models, contact_data, mu);
 
     Eigen::Index current_row_id = 0;
     for (size_t k = 0; k < contact_models.size(); ++k)
     {
-      typedef typename RigidConstraintData::VectorOfMatrix6 VectorOfMatrix6;
       const RigidConstraintModel & cmodel = contact_models[k];
-      RigidConstraintData & cdata = contact_data[k];
-
+      const RigidConstraintData & cdata = contact_data[k];
       const JointIndex joint1_id = cmodel.joint1_id;
-      const SE3 & oMc1 = cdata.oMc1;
-      const IndexVector & support1 = model.supports[joint1_id];
-
-      {
-        VectorOfMatrix6 & propagators = cdata.extended_motion_propagators_joint1;
-        VectorOfMatrix6 & lambdas = cdata.lambdas_joint1;
-        switch (cmodel.type)
-        {
-        case CONTACT_3D: {
-          oMc1.toActionMatrixInverse(propagators.back());
-          propagators.back().template bottomRows<3>().setZero();
-          for (size_t j = support1.size() - 1; j > 1; --j)
-          {
-            lambdas[j].template leftCols<3>().noalias() =
-              data.oK[(size_t)support1[j]] * propagators[j].template topRows<3>().transpose();
-            propagators[j - 1].template topRows<3>().noalias() =
-              propagators[j].template topRows<3>() * data.oL[(size_t)support1[j]];
-          }
-          lambdas[1].template leftCols<3>().noalias() =
-            data.oK[(size_t)support1[1]] * propagators[1].template topRows<3>().transpose();
-
-          for (size_t j = 2; j < support1.size(); ++j)
-          {
-            lambdas[j].template leftCols<3>().noalias() +=
-              data.oL[(size_t)support1[j]] * lambdas[j - 1].template leftCols<3>();
-          }
-          break;
-        }
-        case CONTACT_6D: {
-          oMc1.toActionMatrixInverse(propagators.back());
-          for (size_t j = support1.size() - 1; j > 1; --j)
-          {
-            lambdas[j].noalias() = data.oK[(size_t)support1[j]] * propagators[j].transpose();
-            propagators[j - 1].noalias() = propagators[j] * data.oL[(size_t)support1[j]];
-          }
-          lambdas[1].noalias() = data.oK[(size_t)support1[1]] * propagators[1].transpose();
-
-          for (size_t j = 2; j < support1.size(); ++j)
-          {
-            lambdas[j].noalias() += data.oL[(size_t)support1[j]] * lambdas[j - 1];
-          }
-          break;
-        }
-        default:
-          PINOCCHIO_UNREACHABLE();
-        }
-      }
 
       // Fill the delassus matrix block-wise
       {
@@ -280,6 +318,114 @@ namespace pinocchio
       && "current row indexes do not the number of rows in the Delassus matrix.");
   }
 
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    class ModelAllocator,
+    class DataAllocator,
+    int SparseOptions,
+    typename StorageIndex>
+  void computeSparseDelassusMatrix(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ModelAllocator> & contact_models,
+    std::vector<RigidConstraintDataTpl<Scalar, Options>, DataAllocator> & contact_data,
+    Eigen::SparseMatrix<Scalar, SparseOptions, StorageIndex> & delassus,
+    const Scalar mu)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+    assert(model.check(MimicChecker()) && "Function does not support mimic joints");
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The joint configuration vector is not of right size");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      check_expression_if_real<Scalar>(mu >= Scalar(0)), "mu has to be positive");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      contact_models.size(), contact_data.size(), "contact models and data size are not the same");
+
+    typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+    typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
+    typedef typename Model::JointIndex JointIndex;
+    typedef typename Data::Matrix6 Matrix6;
+    typedef RigidConstraintModelTpl<Scalar, Options> RigidConstraintModel;
+    typedef RigidConstraintDataTpl<Scalar, Options> RigidConstraintData;
+    typedef typename RigidConstraintData::VectorOfMatrix6 VectorOfMatrix6;
+    typedef Eigen::Matrix<StorageIndex, Eigen::Dynamic, 1> StorageIndexVector;
+
+    details::computeDelassusPropagators(model, data, q, contact_models, contact_data, mu);
+
+    const size_t num_contacts = contact_models.size();
+    std::vector<Eigen::Index> row_ids(num_contacts + 1, 0);
+    for (size_t k = 0; k < num_contacts; ++k)
+      row_ids[k + 1] = row_ids[k] + contact_models[k].residualSize();
+    const Eigen::Index constraint_total_size = row_ids.back();
+
+    // Index of the common ancestor of each pair of contacts within the support of the first one.
+    // The universe is at index 0 of every support: the block of two contacts located on
+    // different subtrees of the universe is structurally zero and thus not stored.
+    std::vector<size_t> ancestor_ids(num_contacts * num_contacts, 0);
+    StorageIndexVector nnz_per_col = StorageIndexVector::Zero(constraint_total_size);
+    for (size_t k = 0; k < num_contacts; ++k)
+    {
+      const JointIndex joint1_id = contact_models[k].joint1_id;
+      for (size_t i = 0; i <= k; ++i)
+      {
+        size_t id_in_support_k, id_in_support_i;
+        findCommonAncestor(
+          model, joint1_id, contact_models[i].joint1_id, id_in_support_k, id_in_support_i);
+        if (id_in_support_k == 0)
+          continue;
+
+        ancestor_ids[i * num_contacts + k] = id_in_support_i;
+        ancestor_ids[k * num_contacts + i] = id_in_support_k;
+
+        const Eigen::Index size_k = row_ids[k + 1] - row_ids[k];
+        const Eigen::Index size_i = row_ids[i + 1] - row_ids[i];
+        nnz_per_col.segment(row_ids[k], size_k).array() += StorageIndex(size_i);
+        if (i != k)
+          nnz_per_col.segment(row_ids[i], size_i).array() += StorageIndex(size_k);
+      }
+    }
+
+    delassus.resize(constraint_total_size, constraint_total_size);
+    delassus.reserve(nnz_per_col);
+
+    // Fill the delassus matrix block-wise, both triangular parts being stored
+    Matrix6 block;
+    for (size_t k = 0; k < num_contacts; ++k)
+    {
+      const RigidConstraintModel & cmodel = contact_models[k];
+      const RigidConstraintData & cdata = contact_data[k];
+      const Eigen::Index size = cmodel.residualSize();
+      const VectorOfMatrix6 & lambdas = cdata.lambdas_joint1;
+
+      for (size_t i = 0; i < num_contacts; ++i)
+      {
+        const size_t id_in_support_other = ancestor_ids[i * num_contacts + k];
+        if (id_in_support_other == 0)
+          continue;
+
+        const RigidConstraintModel & cmodel_other = contact_models[i];
+        const RigidConstraintData & cdata_other = contact_data[i];
+        const Eigen::Index size_other = cmodel_other.residualSize();
+        const VectorOfMatrix6 & propagators_other = cdata_other.extended_motion_propagators_joint1;
+        const size_t id_in_support = ancestor_ids[k * num_contacts + i];
+
+        block.topLeftCorner(size_other, size).noalias() =
+          propagators_other[id_in_support_other].topRows(size_other)
+          * lambdas[id_in_support].leftCols(size);
+
+        for (Eigen::Index col = 0; col < size; ++col)
+          for (Eigen::Index row = 0; row < size_other; ++row)
+            delassus.insert(row_ids[i] + row, row_ids[k] + col) = block(row, col);
+      }
+    }
+    delassus.makeCompressed();
+  }
+
   template<
     typename Scalar,
     int Options,
@@ -0,0 +1,276 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/fixed-model.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/fixed-model.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  namespace details
+  {
+    /// \brief Call kernel on every joint of the tuple, in the topological order.
+    template<typename JointModelTuple, typename Kernel, std::size_t... I>
+    void runFixedForwardPass(
+      const JointModelTuple & joints, const Kernel & kernel, std::index_sequence<I...>)
+    {
+      (kernel(std::get<I>(joints)), ...);
+    }
+
+    /// \brief Call kernel on every joint of the tuple, in the reverse topological order.
+    template<typename JointModelTuple, typename Kernel, std::size_t... I>
+    void runFixedBackwardPass(
+      const JointModelTuple & joints, const Kernel & kernel, std::index_sequence<I...>)
+    {
+      (kernel(std::get<sizeof...(I) - 1 - I>(joints)), ...);
+    }
+
+    ///
+    /// \brief Name of the type of a joint supported by fixedModelTypedef.
+    ///
+    struct FixedJointTypeNameVisitor : boost::static_visitor<std::string>
+    {
+      template<typename JointModel>
+      std::string operator()(const JointModel & jmodel) const
+      {
+        typedef CompiledModel::JointModelTypes JointModelTypes;
+        constexpr std::size_t joint_type = compiledJointType<JointModel, JointModelTypes>(
+          std::make_index_sequence<CompiledModel::num_joint_types>());
+        PINOCCHIO_CHECK_INPUT_ARGUMENT(
+          joint_type + 1 < CompiledModel::num_joint_types,
+          "The joint " + jmodel.shortname() + " is not supported by fixed models.");
+        return "::pinocchio::" + jmodel.shortname();
+      }
+    };
+  } // namespace details
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels>
+  FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...>::FixedModelTpl(
+    const Model & model)
+  {
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      JointIndex(model.njoints) == njoints,
+      "The number of joints of the model does not match the fixed model.");
+    setJoints(model, std::index_sequence_for<JointModels...>());
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels>
+  template<std::size_t... I>
+  void FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...>::setJoints(
+    const Model & model, std::index_sequence<I...>)
+  {
+    const auto set_joint = [&](auto & jmodel, const JointIndex joint_id) {
+      typedef typename std::remove_reference<decltype(jmodel)>::type JointModel;
+      const JointModel * model_joint = boost::get<JointModel>(&model.joints[joint_id].toVariant());
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        model_joint != NULL, "The type of the joint " + model.names[joint_id]
+                               + " does not match the fixed model.");
+      jmodel = *model_joint;
+    };
+    (set_joint(std::get<I>(joints), JointIndex(I + 1)), ...);
+  }
+
+  inline std::string fixedModelTypedef(const Model & model, const std::string & type_name)
+  {
+    std::ostringstream oss;
+    oss << "typedef ::pinocchio::FixedModel<";
+    for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+    {
+      oss << (joint_id > 1 ? ",\n  " : "\n  ")
+          << boost::apply_visitor(
+               details::FixedJointTypeNameVisitor(), model.joints[joint_id].toVariant());
+    }
+    oss << ">\n  " << type_name << ";\n";
+    return oss.str();
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & rnea(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & a)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+    typedef std::index_sequence_for<JointModels...> JointIndexes;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      JointIndex(model.njoints) == fixed_model.njoints,
+      "The fixed model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The configuration vector is not equal to model.nq.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.size(), model.nv, "The velocity vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      a.size(), model.nv, "The acceleration vector is not of right size");
+
+    // Set to zero, the mimic joints adding their contribution to the torque of their mimicked
+    data.tau.setZero();
+    data.v[0].setZero();
+    data.a_gf[0] = -model.gravity;
+
+    typedef impl::RneaForwardStep<
+      Scalar, Options, JointCollectionTpl, ConfigVectorType, TangentVectorType1, TangentVectorType2>
+      Pass1;
+    details::runFixedForwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) {
+        details::runCompiledStep<Pass1>(jmodel, model, data, q.derived(), v.derived(), a.derived());
+      },
+      JointIndexes());
+
+    typedef impl::RneaBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+    details::runFixedBackwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) { details::runCompiledStep<Pass2>(jmodel, model, data); },
+      JointIndexes());
+
+    // Add rotorinertia contribution
+    data.tau.array() += model.armature.array() * a.array();
+
+    return data.tau;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType,
+    typename TangentVectorType1,
+    typename TangentVectorType2>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::TangentVectorType & aba(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<TangentVectorType1> & v,
+    const Eigen::MatrixBase<TangentVectorType2> & tau)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+    typedef std::index_sequence_for<JointModels...> JointIndexes;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    assert(model.check(MimicChecker()) && "Function does not support mimic joints");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      JointIndex(model.njoints) == fixed_model.njoints,
+      "The fixed model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The joint configuration vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      v.size(), model.nv, "The joint velocity vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      tau.size(), model.nv, "The joint torque vector is not of right size");
+
+    data.v[0].setZero();
+    data.a_gf[0] = -model.gravity;
+    data.f[0].setZero();
+    data.u = tau;
+
+    typedef impl::AbaLocalConventionForwardStep1<
+      Scalar, Options, JointCollectionTpl, ConfigVectorType, TangentVectorType1>
+      Pass1;
+    details::runFixedForwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) {
+        details::runCompiledStep<Pass1>(jmodel, model, data, q.derived(), v.derived());
+      },
+      JointIndexes());
+
+    typedef impl::AbaLocalConventionBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+    details::runFixedBackwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) { details::runCompiledStep<Pass2>(jmodel, model, data); },
+      JointIndexes());
+
+    typedef impl::AbaLocalConventionForwardStep2<Scalar, Options, JointCollectionTpl> Pass3;
+    details::runFixedForwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) { details::runCompiledStep<Pass3>(jmodel, model, data); },
+      JointIndexes());
+
+    for (JointIndex i = (JointIndex)model.njoints - 1; i > 0; --i)
+    {
+      const JointIndex parent = model.parents[i];
+      data.f[parent] += data.liMi[i].act(data.f[i]);
+    }
+
+    return data.ddq;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename... JointModels,
+    typename ConfigVectorType>
+  const typename DataTpl<Scalar, Options, JointCollectionTpl>::MatrixXs & crba(
+    const FixedModelTpl<Scalar, Options, JointCollectionTpl, JointModels...> & fixed_model,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const Eigen::MatrixBase<ConfigVectorType> & q)
+  {
+    typedef typename ModelTpl<Scalar, Options, JointCollectionTpl>::JointIndex JointIndex;
+    typedef std::index_sequence_for<JointModels...> JointIndexes;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      JointIndex(model.njoints) == fixed_model.njoints,
+      "The fixed model is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The configuration vector is not equal to model.nq.");
+
+    typedef impl::CrbaLocalConventionForwardStep<
+      Scalar, Options, JointCollectionTpl, ConfigVectorType>
+      Pass1;
+    details::runFixedForwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) {
+        details::runCompiledStep<Pass1>(jmodel, model, data, q.derived());
+      },
+      JointIndexes());
+
+    typedef impl::CrbaLocalConventionBackwardStep<Scalar, Options, JointCollectionTpl> Pass2;
+    details::runFixedBackwardPass(
+      fixed_model.joints,
+      [&](const auto & jmodel) { details::runCompiledStep<Pass2>(jmodel, model, data); },
+      JointIndexes());
+
+    typedef impl::CrbaLocalConventionMimicStep<Scalar, Options, JointCollectionTpl> Pass3;
+    for (size_t i = 0; i < model.mimicking_joints.size(); i++)
+    {
+      Pass3::run(
+        model.joints[model.mimicking_joints[i]], data.joints[model.mimicking_joints[i]],
+        typename Pass3::ArgsType(model, data, i));
+    }
+
+    // Add the armature contribution
+    data.M.diagonal() += model.armature;
+
+    return data.M;
+  }
+
+} // namespace pinocchio
@@ -54,6 +54,68 @@ namespace pinocchio
     }
   }
 
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  void updateGeometryPlacements(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    GeometryPlacementsBatch & batch)
+  {
+    typedef GeometryPlacementsBatch::Matrix3Xs Matrix3Xs;
+
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      batch.geometry_ids.size(), geom_model.ngeoms,
+      "The batch is not consistent with the geometry model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      batch.joint_offsets.size() <= size_t(model.njoints) + 1,
+      "The batch is not consistent with the model.");
+
+    // The geometries attached to the universe keep their placement
+    for (JointIndex joint_id = 1; joint_id + 1 < batch.joint_offsets.size(); ++joint_id)
+    {
+      const Eigen::Index begin = batch.joint_offsets[joint_id];
+      const Eigen::Index size = batch.joint_offsets[joint_id + 1] - begin;
+      if (size == 0)
+        continue;
+
+      const typename DataTpl<Scalar, Options, JointCollectionTpl>::SE3 & oMi = data.oMi[joint_id];
+      batch.oRotations.middleCols(3 * begin, 3 * size).noalias() =
+        oMi.rotation() * batch.rotations.middleCols(3 * begin, 3 * size);
+      typename Matrix3Xs::ColsBlockXpr oTranslations =
+        batch.oTranslations.middleCols(begin, size);
+      oTranslations.noalias() = oMi.rotation() * batch.translations.middleCols(begin, size);
+      oTranslations.colwise() += oMi.translation();
+    }
+
+    for (Eigen::Index k = 0; k < batch.size(); ++k)
+    {
+      GeometryData::SE3 & oMg = geom_data.oMg[batch.geometry_ids[size_t(k)]];
+      oMg.rotation() = batch.oRotations.middleCols<3>(3 * k);
+      oMg.translation() = batch.oTranslations.col(k);
+    }
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  void updateGeometryPlacements(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    GeometryPlacementsBatch & batch,
+    const Eigen::MatrixBase<ConfigVectorType> & q)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+
+    forwardKinematics(model, data, q);
+    updateGeometryPlacements(model, data, geom_model, geom_data, batch);
+  }
+
   /* --- APPEND GEOMETRY MODEL ----------------------------------------------------------- */
 
   inline void appendGeometryModel(GeometryModel & geom_model1, const GeometryModel & geom_model2)
@@ -113,6 +175,22 @@ namespace pinocchio
   updateGeometryPlacements<context::Scalar, context::Options, JointCollectionDefaultTpl>(
     const Model &, const Data &, const GeometryModel &, GeometryData &);
 
+  extern template PINOCCHIO_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI void
+  updateGeometryPlacements<context::Scalar, context::Options, JointCollectionDefaultTpl>(
+    const Model &, const Data &, const GeometryModel &, GeometryData &, GeometryPlacementsBatch &);
+
+  extern template PINOCCHIO_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI void updateGeometryPlacements<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    GeometryPlacementsBatch &,
+    const Eigen::MatrixBase<context::VectorXs> &);
+
 } // namespace pinocchio
   #endif // ifdef PINOCCHIO_SKIP_ALGORITHM_GEOMETRY
 #endif   // ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
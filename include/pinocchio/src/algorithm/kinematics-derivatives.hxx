@@ -1078,6 +1078,9 @@ namespace pinocchio
     DataTpl<Scalar, Options, JointCollectionTpl> & data)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_SECOND_ORDER_DERIVATIVES)
+      && "data does not have the second order derivative buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
     typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
@@ -1198,6 +1201,9 @@ namespace pinocchio
     Tensor<Scalar, 3, Options> & kinematic_hessian)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_SECOND_ORDER_DERIVATIVES)
+      && "data does not have the second order derivative buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
     assert(
       joint_id < model.joints.size()
@@ -0,0 +1,102 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/aba-derivatives.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/aba-derivatives.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeABADerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const Eigen::MatrixBase<MatrixPool1> & aba_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & aba_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & aba_partial_dtau)
+  {
+    typedef ModelPoolTpl<Scalar, Options, JointCollectionTpl> Pool;
+    typedef typename Pool::Model Model;
+    typedef typename Pool::Data Data;
+    typedef typename Pool::ModelVector ModelVector;
+    typedef typename Pool::DataVector DataVector;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(executor.numThreads() <= pool.size(), "The pool is too small");
+
+    const ModelVector & models = pool.getModels();
+    const Model & model_check = models[0];
+    DataVector & datas = pool.getDatas();
+    MatrixPool1 & res_dq = aba_partial_dq.const_cast_derived();
+    MatrixPool2 & res_dv = aba_partial_dv.const_cast_derived();
+    MatrixPool3 & res_dtau = aba_partial_dtau.const_cast_derived();
+
+    const Eigen::Index batch_size = q.cols();
+    const Eigen::Index nv = model_check.nv;
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(q.rows(), model_check.nq);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(tau.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dq.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dv.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dtau.rows(), nv);
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(tau.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dq.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dv.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dtau.cols(), nv * batch_size);
+
+    executor.parallelFor(batch_size, [&](const size_t thread_id, const Eigen::Index i) {
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      computeABADerivatives(
+        model, data, q.col(i), v.col(i), tau.col(i), res_dq.middleCols(i * nv, nv),
+        res_dv.middleCols(i * nv, nv), res_dtau.middleCols(i * nv, nv));
+    });
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeABADerivativesInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const Eigen::MatrixBase<MatrixPool1> & aba_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & aba_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & aba_partial_dtau)
+  {
+    OpenMPExecutor executor(num_threads);
+    computeABADerivativesInParallel(
+      executor, pool, q, v, tau, aba_partial_dq, aba_partial_dv, aba_partial_dtau);
+  }
+} // namespace pinocchio
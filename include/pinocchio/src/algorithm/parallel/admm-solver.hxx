@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/admm-solver.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/admm-solver.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    typename DelassusOperator,
+    typename DelassusOperatorAllocator,
+    typename VectorLike,
+    typename VectorLikeAllocator,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintModelVectorAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator,
+    typename ConstraintDataVectorAllocator,
+    typename ResultAllocator>
+  ADMMBatchSolverStatsTpl<Scalar> solveConstraintProblemsInParallel(
+    ExecutorBase<Executor> & executor,
+    ADMMConstraintSolverPoolTpl<Scalar, Options> & pool,
+    std::vector<DelassusOperator, DelassusOperatorAllocator> & delassus_operators,
+    const std::vector<VectorLike, VectorLikeAllocator> & gs,
+    const std::vector<
+      std::vector<ConstraintModel, ConstraintModelAllocator>,
+      ConstraintModelVectorAllocator> & constraint_models,
+    const std::vector<
+      std::vector<ConstraintData, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & constraint_datas,
+    const ADMMSolverSettingsTpl<Scalar> & settings,
+    std::vector<ADMMSolverResultTpl<Scalar, Options>, ResultAllocator> & results,
+    const bool warmstart_with_previous_result)
+  {
+    typedef ADMMConstraintSolverPoolTpl<Scalar, Options> Pool;
+    typedef typename Pool::ADMMConstraintSolver ADMMConstraintSolver;
+    typedef typename Pool::ADMMConstraintSolverVector ADMMConstraintSolverVector;
+    typedef ADMMSolverResultTpl<Scalar, Options> ADMMSolverResult;
+    typedef ADMMBatchSolverStatsTpl<Scalar> ADMMBatchSolverStats;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(executor.numThreads() <= pool.size(), "The pool is too small");
+
+    const size_t batch_size = delassus_operators.size();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(gs.size(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(constraint_models.size(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(constraint_datas.size(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(results.size(), batch_size);
+
+    settings.checkValidity();
+
+    ADMMConstraintSolverVector & solvers = pool.getSolvers();
+    std::vector<double> elapsed_times(executor.numThreads(), 0.);
+    std::vector<char> warmstarted(batch_size, false);
+
+    executor.parallelFor(
+      Eigen::Index(batch_size), [&](const size_t thread_id, const Eigen::Index i) {
+        const size_t k = size_t(i);
+        ADMMConstraintSolver & solver = solvers[thread_id];
+        ADMMSolverResult & result = results[k];
+
+        if (
+          warmstart_with_previous_result && result.isValid()
+          && result.problem_size == size_t(gs[k].size()) && !result.impulse_guess.has_value()
+          && !result.velocity_guess.has_value())
+        {
+          result.setConstraintImpulseGuess(result.y);
+          result.setConstraintVelocityGuess(result.z - result.desaxce);
+          warmstarted[k] = true;
+        }
+
+        solver.solve(
+          delassus_operators[k], gs[k], constraint_models[k], constraint_datas[k], settings, result);
+
+        if (settings.measure_timings)
+          elapsed_times[thread_id] += solver.getElapsedTime();
+      });
+
+    // The statistics are gathered once all the problems are solved, in the order of the batch.
+    ADMMBatchSolverStats stats;
+    stats.num_problems = batch_size;
+    for (size_t k = 0; k < batch_size; ++k)
+    {
+      const ADMMSolverResult & result = results[k];
+      if (result.converged)
+        stats.num_converged++;
+      if (warmstarted[k])
+        stats.num_warmstarted++;
+      stats.total_iterations += result.iterations;
+      stats.max_iterations = std::max(stats.max_iterations, result.iterations);
+      stats.max_primal_feasibility =
+        std::max(stats.max_primal_feasibility, result.primal_feasibility);
+      stats.max_dual_feasibility = std::max(stats.max_dual_feasibility, result.dual_feasibility);
+      stats.max_complementarity = std::max(stats.max_complementarity, result.complementarity);
+    }
+    for (const double elapsed_time : elapsed_times)
+      stats.total_elapsed_time += elapsed_time;
+
+    return stats;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    typename DelassusOperator,
+    typename DelassusOperatorAllocator,
+    typename VectorLike,
+    typename VectorLikeAllocator,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintModelVectorAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator,
+    typename ConstraintDataVectorAllocator,
+    typename ResultAllocator>
+  ADMMBatchSolverStatsTpl<Scalar> solveConstraintProblemsInParallel(
+    const size_t num_threads,
+    ADMMConstraintSolverPoolTpl<Scalar, Options> & pool,
+    std::vector<DelassusOperator, DelassusOperatorAllocator> & delassus_operators,
+    const std::vector<VectorLike, VectorLikeAllocator> & gs,
+    const std::vector<
+      std::vector<ConstraintModel, ConstraintModelAllocator>,
+      ConstraintModelVectorAllocator> & constraint_models,
+    const std::vector<
+      std::vector<ConstraintData, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & constraint_datas,
+    const ADMMSolverSettingsTpl<Scalar> & settings,
+    std::vector<ADMMSolverResultTpl<Scalar, Options>, ResultAllocator> & results,
+    const bool warmstart_with_previous_result)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    return solveConstraintProblemsInParallel(
+      executor, pool, delassus_operators, gs, constraint_models, constraint_datas, settings,
+      results, warmstart_with_previous_result);
+  }
+
+} // namespace pinocchio
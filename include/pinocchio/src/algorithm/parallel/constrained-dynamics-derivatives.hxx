@@ -0,0 +1,171 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/constrained-dynamics-derivatives.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/constrained-dynamics-derivatives.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    class ConstraintModelAllocator,
+    class ConstraintDataAllocator,
+    class ConstraintDataVectorAllocator,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3,
+    typename MatrixPool4,
+    typename MatrixPool5,
+    typename MatrixPool6>
+  void computeConstraintDynamicsDerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ConstraintModelAllocator> &
+      contact_models,
+    std::vector<
+      std::vector<RigidConstraintDataTpl<Scalar, Options>, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & contact_datas,
+    const ProximalSettingsTpl<Scalar> & settings,
+    const Eigen::MatrixBase<MatrixPool1> & ddq_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & ddq_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & ddq_partial_dtau,
+    const Eigen::MatrixBase<MatrixPool4> & lambda_partial_dq,
+    const Eigen::MatrixBase<MatrixPool5> & lambda_partial_dv,
+    const Eigen::MatrixBase<MatrixPool6> & lambda_partial_dtau)
+  {
+    typedef ModelPoolTpl<Scalar, Options, JointCollectionTpl> Pool;
+    typedef typename Pool::Model Model;
+    typedef typename Pool::Data Data;
+    typedef typename Pool::ModelVector ModelVector;
+    typedef typename Pool::DataVector DataVector;
+
+    const size_t num_threads = executor.numThreads();
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads <= pool.size(), "The pool is too small");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      num_threads <= contact_datas.size(), "There should be one vector of contact data per thread");
+
+    const ModelVector & models = pool.getModels();
+    const Model & model_check = models[0];
+    DataVector & datas = pool.getDatas();
+    MatrixPool1 & res_ddq_dq = ddq_partial_dq.const_cast_derived();
+    MatrixPool2 & res_ddq_dv = ddq_partial_dv.const_cast_derived();
+    MatrixPool3 & res_ddq_dtau = ddq_partial_dtau.const_cast_derived();
+    MatrixPool4 & res_lambda_dq = lambda_partial_dq.const_cast_derived();
+    MatrixPool5 & res_lambda_dv = lambda_partial_dv.const_cast_derived();
+    MatrixPool6 & res_lambda_dtau = lambda_partial_dtau.const_cast_derived();
+
+    const Eigen::Index batch_size = q.cols();
+    const Eigen::Index nv = model_check.nv;
+    Eigen::Index nc = 0;
+    for (const auto & cmodel : contact_models)
+      nc += cmodel.residualSize();
+
+    for (size_t k = 0; k < num_threads; ++k)
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        contact_datas[k].size() == contact_models.size(),
+        "contact_datas and contact_models do not have the same size");
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        datas[k].constraint_chol.constraintDim() == nc,
+        "initConstraintDynamics has not been called on the data of the pool");
+    }
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(q.rows(), model_check.nq);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(tau.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dq.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dv.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dtau.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dq.rows(), nc);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dv.rows(), nc);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dtau.rows(), nc);
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(tau.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dq.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dv.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_ddq_dtau.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dq.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dv.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_lambda_dtau.cols(), nv * batch_size);
+
+    executor.parallelFor(batch_size, [&](const size_t thread_id, const Eigen::Index i) {
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      // constraintDynamics stores the solver statistics in the settings.
+      ProximalSettingsTpl<Scalar> thread_settings(settings);
+
+      constraintDynamics(
+        model, data, q.col(i), v.col(i), tau.col(i), contact_models, contact_datas[thread_id],
+        thread_settings);
+      // The derivatives are computed in the buffers of data, whose types are expected by the
+      // internals of computeConstraintDynamicsDerivatives, and then copied in the outputs.
+      computeConstraintDynamicsDerivatives(
+        model, data, contact_models, contact_datas[thread_id], thread_settings);
+      res_ddq_dq.middleCols(i * nv, nv) = data.ddq_dq;
+      res_ddq_dv.middleCols(i * nv, nv) = data.ddq_dv;
+      res_ddq_dtau.middleCols(i * nv, nv) = data.ddq_dtau;
+      res_lambda_dq.middleCols(i * nv, nv) = data.dlambda_dq;
+      res_lambda_dv.middleCols(i * nv, nv) = data.dlambda_dv;
+      res_lambda_dtau.middleCols(i * nv, nv) = data.dlambda_dtau;
+    });
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    class ConstraintModelAllocator,
+    class ConstraintDataAllocator,
+    class ConstraintDataVectorAllocator,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3,
+    typename MatrixPool4,
+    typename MatrixPool5,
+    typename MatrixPool6>
+  void computeConstraintDynamicsDerivativesInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & tau,
+    const std::vector<RigidConstraintModelTpl<Scalar, Options>, ConstraintModelAllocator> &
+      contact_models,
+    std::vector<
+      std::vector<RigidConstraintDataTpl<Scalar, Options>, ConstraintDataAllocator>,
+      ConstraintDataVectorAllocator> & contact_datas,
+    const ProximalSettingsTpl<Scalar> & settings,
+    const Eigen::MatrixBase<MatrixPool1> & ddq_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & ddq_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & ddq_partial_dtau,
+    const Eigen::MatrixBase<MatrixPool4> & lambda_partial_dq,
+    const Eigen::MatrixBase<MatrixPool5> & lambda_partial_dv,
+    const Eigen::MatrixBase<MatrixPool6> & lambda_partial_dtau)
+  {
+    OpenMPExecutor executor(num_threads);
+    computeConstraintDynamicsDerivativesInParallel(
+      executor, pool, q, v, tau, contact_models, contact_datas, settings, ddq_partial_dq,
+      ddq_partial_dv, ddq_partial_dtau, lambda_partial_dq, lambda_partial_dv, lambda_partial_dtau);
+  }
+} // namespace pinocchio
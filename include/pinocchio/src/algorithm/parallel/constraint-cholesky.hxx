@@ -0,0 +1,276 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/constraint-cholesky.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/constraint-cholesky.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  namespace details
+  {
+    template<typename _Scalar, int _Options>
+    struct ConstraintCholeskyComputeInParallelAlgo
+    {
+      typedef _Scalar Scalar;
+      static constexpr int Options = _Options;
+
+      typedef ConstraintCholeskyDecompositionTpl<Scalar, Options> ConstraintCholeskyDecomposition;
+      typedef typename ConstraintCholeskyDecomposition::RowMatrix RowMatrix;
+      typedef typename ConstraintCholeskyDecomposition::BooleanVector BooleanVector;
+      typedef Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> BooleanMatrix;
+
+      template<
+        typename Executor,
+        template<typename, int> class JointCollectionTpl,
+        class ConstraintModel,
+        class ConstraintModelAllocator,
+        class ConstraintData,
+        class ConstraintDataAllocator>
+      static void run(
+        ExecutorBase<Executor> & executor,
+        const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+        DataTpl<Scalar, Options, JointCollectionTpl> & data,
+        const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+        const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+        ConstraintCholeskyDecomposition & chol,
+        const bool apply_on_the_right,
+        const bool solve_in_place)
+      {
+        assert(model.check(data) && "data is not consistent with model.");
+        assert(model.check(MimicChecker()) && "Function does not support mimic joints");
+
+        PINOCCHIO_CHECK_INPUT_ARGUMENT(
+          constraint_models.size() == constraint_datas.size(),
+          "The number of constraints between constraint_models and constraint_datas vectors is "
+          "different.");
+        PINOCCHIO_CHECK_ARGUMENT_SIZE(model.nv, chol.nv);
+
+        const Eigen::Index nv = chol.nv;
+        const Eigen::Index total_constraint_size = chol.constraintDim();
+        const size_t num_constraints = constraint_models.size();
+
+        std::vector<Eigen::Index> row_offsets(num_constraints + 1, 0);
+        for (size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
+        {
+          const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+          row_offsets[constraint_id + 1] = row_offsets[constraint_id] + cmodel.residualSize();
+        }
+        PINOCCHIO_CHECK_INPUT_ARGUMENT(
+          row_offsets.back() == total_constraint_size,
+          "The decomposition has not been built with the given constraint models.");
+
+        auto & U = chol.U;
+        auto & D = chol.D;
+        auto & Dinv = chol.Dinv;
+
+        // Fill the mass matrix part
+        const auto & M = data.M;
+        D.tail(nv) = M.diagonal();
+        U.bottomRightCorner(nv, nv).template triangularView<Eigen::StrictlyUpper>() =
+          M.template triangularView<Eigen::StrictlyUpper>();
+
+        // Fill the constraint Jacobians and gather the union of the row sparsity patterns of each
+        // constraint.
+        BooleanMatrix constraint_sparsity(Eigen::Index(num_constraints), nv);
+        std::vector<BooleanVector> row_sparsity(executor.numThreads());
+        executor.parallelFor(
+          Eigen::Index(num_constraints), [&](const size_t thread_id, const Eigen::Index k) {
+            const size_t constraint_id = size_t(k);
+            const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+            const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
+            const Eigen::Index row_begin = row_offsets[constraint_id];
+            const Eigen::Index constraint_size = cmodel.residualSize();
+
+            auto U_block = U.block(row_begin, total_constraint_size, constraint_size, nv);
+            U_block.setZero();
+            cmodel.jacobian(model, data, cdata, U_block);
+
+            BooleanVector & row_sparsity_pattern = row_sparsity[thread_id];
+            auto sparsity = constraint_sparsity.row(k);
+            sparsity.fill(false);
+            for (Eigen::Index row_id = 0; row_id < constraint_size; ++row_id)
+            {
+              cmodel.getRowSparsityPattern(model, data, cdata, row_id, row_sparsity_pattern);
+              for (Eigen::Index j = 0; j < nv; ++j)
+                sparsity[j] = sparsity[j] || row_sparsity_pattern[j];
+            }
+          });
+
+        // Level scheduling of the elimination tree: the level of a column is the height of its
+        // subtree. Two columns of the same level cannot be ancestor of each other.
+        std::vector<Eigen::Index> levels(size_t(nv), 0);
+        Eigen::Index num_levels = nv > 0 ? 1 : 0;
+        for (Eigen::Index j = nv - 1; j >= 0; --j)
+        {
+          const Eigen::Index parent = chol.parents_fromRow[total_constraint_size + j];
+          if (parent >= total_constraint_size)
+          {
+            Eigen::Index & parent_level = levels[size_t(parent - total_constraint_size)];
+            parent_level = std::max(parent_level, levels[size_t(j)] + 1);
+            num_levels = std::max(num_levels, parent_level + 1);
+          }
+        }
+
+        std::vector<Eigen::Index> level_offsets(size_t(num_levels + 1), 0);
+        for (Eigen::Index j = 0; j < nv; ++j)
+          ++level_offsets[size_t(levels[size_t(j)] + 1)];
+        for (size_t l = 0; l < size_t(num_levels); ++l)
+          level_offsets[l + 1] += level_offsets[l];
+
+        std::vector<Eigen::Index> level_columns(size_t(nv));
+        {
+          std::vector<Eigen::Index> cursor(level_offsets.begin(), level_offsets.end() - 1);
+          for (Eigen::Index j = 0; j < nv; ++j)
+            level_columns[size_t(cursor[size_t(levels[size_t(j)])]++)] = j;
+        }
+
+        // Row j of DU stores the product D * U^t restricted to the subtree of the column j.
+        RowMatrix DU(nv, nv);
+
+        // Classic Cholesky decomposition related to the mass matrix
+        const auto factorize_mass_column = [&](const Eigen::Index j) {
+          const Eigen::Index jj = total_constraint_size + j; // shifted index
+          const Eigen::Index NVT = chol.nv_subtree_fromRow[jj] - 1;
+
+          auto DUt_partial = DU.row(j).segment(j + 1, NVT);
+          if (NVT)
+            DUt_partial.noalias() =
+              U.row(jj).segment(jj + 1, NVT).cwiseProduct(D.segment(jj + 1, NVT).transpose());
+
+          D[jj] -= U.row(jj).segment(jj + 1, NVT).dot(DUt_partial);
+          assert(
+            check_expression_if_real<Scalar>(D[jj] != Scalar(0))
+            && "The diagonal element is equal to zero.");
+          Dinv[jj] = Scalar(1) / D[jj];
+
+          for (Eigen::Index _ii = chol.parents_fromRow[jj]; _ii >= total_constraint_size;
+               _ii = chol.parents_fromRow[_ii])
+          {
+            U(_ii, jj) -= U.row(_ii).segment(jj + 1, NVT).dot(DUt_partial);
+            U(_ii, jj) *= Dinv[jj];
+          }
+        };
+
+        for (size_t l = 0; l < size_t(num_levels); ++l)
+        {
+          const Eigen::Index level_begin = level_offsets[l];
+          const Eigen::Index level_size = level_offsets[l + 1] - level_begin;
+          if (level_size == 1)
+          {
+            factorize_mass_column(level_columns[size_t(level_begin)]);
+            continue;
+          }
+
+          executor.parallelFor(level_size, [&](const size_t, const Eigen::Index k) {
+            factorize_mass_column(level_columns[size_t(level_begin + k)]);
+          });
+        }
+
+        // Constraint part: each constraint is a dense block of rows depending only on the mass
+        // matrix part. Columns outside of the sparsity pattern of the whole block are skipped. For
+        // the remaining ones, the rows of the block which are not supported by the column are
+        // zero and remain zero.
+        executor.parallelFor(
+          Eigen::Index(num_constraints), [&](const size_t, const Eigen::Index k) {
+            const size_t constraint_id = size_t(k);
+            const Eigen::Index row_begin = row_offsets[constraint_id];
+            const Eigen::Index constraint_size = row_offsets[constraint_id + 1] - row_begin;
+            const auto sparsity = constraint_sparsity.row(k);
+
+            for (Eigen::Index j = nv - 1; j >= 0; --j)
+            {
+              if (!sparsity[j])
+                continue;
+
+              const Eigen::Index jj = total_constraint_size + j;
+              const Eigen::Index NVT = chol.nv_subtree_fromRow[jj] - 1;
+
+              auto U_col = U.col(jj).segment(row_begin, constraint_size);
+              if (NVT)
+                U_col.noalias() -= U.block(row_begin, jj + 1, constraint_size, NVT)
+                                   * DU.row(j).segment(j + 1, NVT).transpose();
+              U_col *= Dinv[jj];
+            }
+          });
+
+        if (apply_on_the_right)
+        {
+          // Compute the Delassus matrix from the current decomposition, by blocks of rows
+          const auto UtopRight = U.topRightCorner(total_constraint_size, nv);
+          const auto Dtail = D.tail(nv);
+          executor.parallelFor(
+            Eigen::Index(num_constraints), [&](const size_t, const Eigen::Index k) {
+              const size_t constraint_id = size_t(k);
+              const Eigen::Index row_begin = row_offsets[constraint_id];
+              const Eigen::Index constraint_size = row_offsets[constraint_id + 1] - row_begin;
+
+              chol.delassus_block.middleRows(row_begin, constraint_size).noalias() =
+                (UtopRight.middleRows(row_begin, constraint_size) * Dtail.asDiagonal())
+                * UtopRight.transpose();
+            });
+        }
+
+        if (solve_in_place)
+        {
+          // Compute the Cholesky decomposition of the Delassus block
+          chol.computeDelassusCholeskyDecomposition();
+        }
+      }
+    };
+  } // namespace details
+
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  void computeConstraintCholeskyInParallel(
+    ExecutorBase<Executor> & executor,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
+    const bool apply_on_the_right,
+    const bool solve_in_place)
+  {
+    details::ConstraintCholeskyComputeInParallelAlgo<Scalar, Options>::run(
+      executor, model, data, constraint_models, constraint_datas, chol, apply_on_the_right,
+      solve_in_place);
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  void computeConstraintCholeskyInParallel(
+    const size_t num_threads,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    ConstraintCholeskyDecompositionTpl<Scalar, Options> & chol,
+    const bool apply_on_the_right,
+    const bool solve_in_place)
+  {
+    OpenMPExecutor executor(num_threads);
+    computeConstraintCholeskyInParallel(
+      executor, model, data, constraint_models, constraint_datas, chol, apply_on_the_right,
+      solve_in_place);
+  }
+} // namespace pinocchio
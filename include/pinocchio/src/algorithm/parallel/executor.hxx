@@ -0,0 +1,370 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/executor.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/executor.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  ///
+  /// \brief Base class of the executors used by the *InParallel algorithms to distribute the
+  /// elements of a batch over several threads.
+  ///
+  /// An executor provides the maximal number of threads it relies on through numThreads() and a
+  /// parallelFor(size, f) method which calls f(thread_id, index) for every index in [0, size),
+  /// with thread_id in [0, numThreads()). Two calls sharing the same thread_id are never run
+  /// concurrently, which allows the algorithms to use one element of a pool per thread.
+  /// Exceptions raised by f are forwarded to the caller of parallelFor.
+  ///
+  /// Custom executors (e.g. forwarding the work to the thread pool of an application) are
+  /// obtained by deriving from this class and implementing these two methods.
+  ///
+  template<typename Derived>
+  struct ExecutorBase
+  {
+    Derived & derived()
+    {
+      return static_cast<Derived &>(*this);
+    }
+    const Derived & derived() const
+    {
+      return static_cast<const Derived &>(*this);
+    }
+
+    /// \brief Returns the maximal number of threads used by the executor.
+    size_t numThreads() const
+    {
+      return derived().numThreads();
+    }
+
+    /// \brief Calls f(thread_id, index) for all index in [0, size).
+    template<typename Function>
+    void parallelFor(const Eigen::Index size, Function && f)
+    {
+      derived().parallelFor(size, std::forward<Function>(f));
+    }
+  }; // struct ExecutorBase
+
+  ///
+  /// \brief Executor running all the elements of the batch on the calling thread.
+  ///
+  struct SerialExecutor : ExecutorBase<SerialExecutor>
+  {
+    size_t numThreads() const
+    {
+      return 1;
+    }
+
+    template<typename Function>
+    void parallelFor(const Eigen::Index size, Function && f)
+    {
+      for (Eigen::Index i = 0; i < size; ++i)
+        f(size_t(0), i);
+    }
+  }; // struct SerialExecutor
+
+  ///
+  /// \brief Executor relying on an OpenMP parallel loop.
+  ///
+  /// Contrary to setDefaultOpenMPSettings, the number of threads is only applied to the parallel
+  /// regions spawned by this executor and the global OpenMP settings are left untouched.
+  ///
+  struct OpenMPExecutor : ExecutorBase<OpenMPExecutor>
+  {
+    ///
+    /// \param[in] num_threads Number of threads of the OpenMP parallel regions.
+    /// \param[in] dynamic_scheduling Use schedule(dynamic) instead of schedule(static). Dynamic
+    /// scheduling should be preferred when the costs of the elements of the batch are uneven.
+    ///
+    explicit OpenMPExecutor(
+      const size_t num_threads = (size_t)omp_get_max_threads(),
+      const bool dynamic_scheduling = false)
+    : m_num_threads(num_threads)
+    , m_dynamic_scheduling(dynamic_scheduling)
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads > 0, "The number of threads should be positive.");
+    }
+
+    size_t numThreads() const
+    {
+      return m_num_threads;
+    }
+
+    bool dynamicScheduling() const
+    {
+      return m_dynamic_scheduling;
+    }
+
+    template<typename Function>
+    void parallelFor(const Eigen::Index size, Function && f)
+    {
+      OpenMPException openmp_exception;
+      const int num_threads = (int)m_num_threads;
+      Eigen::Index i = 0;
+
+      if (m_dynamic_scheduling)
+      {
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+        for (i = 0; i < size; i++)
+        {
+          if (openmp_exception.hasThrown())
+            continue;
+          const size_t thread_id = (size_t)omp_get_thread_num();
+          openmp_exception.run([&f, thread_id, i] { f(thread_id, i); });
+        }
+      }
+      else
+      {
+#pragma omp parallel for schedule(static) num_threads(num_threads)
+        for (i = 0; i < size; i++)
+        {
+          if (openmp_exception.hasThrown())
+            continue;
+          const size_t thread_id = (size_t)omp_get_thread_num();
+          openmp_exception.run([&f, thread_id, i] { f(thread_id, i); });
+        }
+      }
+
+      openmp_exception.rethrowException();
+    }
+
+  protected:
+    size_t m_num_threads;
+    bool m_dynamic_scheduling;
+  }; // struct OpenMPExecutor
+
+  ///
+  /// \brief Persistent pool of threads balancing the work by work stealing.
+  ///
+  /// The threads are created once at construction and wait for work between two calls to
+  /// parallelFor. The calling thread takes part to the computations as thread 0. Each thread
+  /// starts with a contiguous share of the batch, processes it by chunks of grain_size elements
+  /// and, once done, steals half of the remaining work of the other threads. This keeps all the
+  /// threads busy when the elements of the batch have uneven costs.
+  ///
+  /// \note Calls to parallelFor from several threads are serialized. Calling parallelFor from
+  /// the function executed by the same executor leads to a deadlock.
+  ///
+  class ThreadPoolExecutor : public ExecutorBase<ThreadPoolExecutor>
+  {
+  public:
+    typedef std::function<void(const size_t, const Eigen::Index, const Eigen::Index)>
+      RangeFunction;
+
+    ///
+    /// \param[in] num_threads Number of threads of the pool, including the calling thread.
+    /// \param[in] grain_size Number of consecutive elements processed at once by a thread.
+    ///
+    explicit ThreadPoolExecutor(
+      const size_t num_threads = (size_t)omp_get_max_threads(), const Eigen::Index grain_size = 1)
+    : m_grain_size(grain_size)
+    , m_ranges(num_threads)
+    , m_remaining(0)
+    , m_job(nullptr)
+    , m_generation(0)
+    , m_active_workers(0)
+    , m_stop(false)
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads > 0, "The number of threads should be positive.");
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(grain_size > 0, "The grain size should be positive.");
+
+      m_workers.reserve(num_threads - 1);
+      for (size_t thread_id = 1; thread_id < num_threads; ++thread_id)
+        m_workers.emplace_back(&ThreadPoolExecutor::workerLoop, this, thread_id);
+    }
+
+    ThreadPoolExecutor(const ThreadPoolExecutor &) = delete;
+    ThreadPoolExecutor & operator=(const ThreadPoolExecutor &) = delete;
+
+    ~ThreadPoolExecutor()
+    {
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+      }
+      m_wake_up.notify_all();
+      for (std::thread & worker : m_workers)
+        worker.join();
+    }
+
+    size_t numThreads() const
+    {
+      return m_ranges.size();
+    }
+
+    Eigen::Index grainSize() const
+    {
+      return m_grain_size;
+    }
+
+    template<typename Function>
+    void parallelFor(const Eigen::Index size, Function && f)
+    {
+      if (size <= 0)
+        return;
+
+      std::lock_guard<std::mutex> submit_lock(m_submit_mutex);
+
+      OpenMPException exception;
+      const RangeFunction job = [&f, &exception](
+                                  const size_t thread_id, const Eigen::Index begin,
+                                  const Eigen::Index end) {
+        for (Eigen::Index i = begin; i < end; ++i)
+        {
+          if (exception.hasThrown())
+            return;
+          exception.run([&f, thread_id, i] { f(thread_id, i); });
+        }
+      };
+
+      const size_t num_threads = numThreads();
+      for (size_t k = 0; k < num_threads; ++k)
+      {
+        std::lock_guard<std::mutex> lock(m_ranges[k].mutex);
+        m_ranges[k].begin = (size * Eigen::Index(k)) / Eigen::Index(num_threads);
+        m_ranges[k].end = (size * Eigen::Index(k + 1)) / Eigen::Index(num_threads);
+      }
+      m_remaining.store(size);
+
+      {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        m_active_workers = m_workers.size();
+        ++m_generation;
+      }
+      m_wake_up.notify_all();
+
+      work(0, job);
+
+      {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_work_done.wait(lock, [this] { return m_active_workers == 0; });
+        m_job = nullptr;
+      }
+
+      exception.rethrowException();
+    }
+
+  protected:
+    struct WorkRange
+    {
+      WorkRange()
+      : begin(0)
+      , end(0)
+      {
+      }
+
+      std::mutex mutex;
+      Eigen::Index begin;
+      Eigen::Index end;
+    };
+
+    /// \brief Pops the next chunk of the range owned by thread_id.
+    bool popChunk(const size_t thread_id, Eigen::Index & begin, Eigen::Index & end)
+    {
+      WorkRange & range = m_ranges[thread_id];
+      std::lock_guard<std::mutex> lock(range.mutex);
+      if (range.begin >= range.end)
+        return false;
+
+      begin = range.begin;
+      end = std::min(range.begin + m_grain_size, range.end);
+      range.begin = end;
+      return true;
+    }
+
+    /// \brief Steals the upper half of the range of another thread, keeps its first chunk and
+    /// stores the rest in the range owned by thread_id.
+    bool stealChunk(const size_t thread_id, Eigen::Index & begin, Eigen::Index & end)
+    {
+      const size_t num_threads = numThreads();
+      for (size_t offset = 1; offset < num_threads; ++offset)
+      {
+        WorkRange & victim = m_ranges[(thread_id + offset) % num_threads];
+        Eigen::Index stolen_begin, stolen_end;
+        {
+          std::lock_guard<std::mutex> lock(victim.mutex);
+          const Eigen::Index count = victim.end - victim.begin;
+          if (count <= 0)
+            continue;
+
+          stolen_begin = victim.begin + count / 2;
+          stolen_end = victim.end;
+          victim.end = stolen_begin;
+        }
+
+        begin = stolen_begin;
+        end = std::min(stolen_begin + m_grain_size, stolen_end);
+
+        WorkRange & range = m_ranges[thread_id];
+        std::lock_guard<std::mutex> lock(range.mutex);
+        range.begin = end;
+        range.end = stolen_end;
+        return true;
+      }
+      return false;
+    }
+
+    void work(const size_t thread_id, const RangeFunction & job)
+    {
+      Eigen::Index begin, end;
+      while (m_remaining.load() > 0)
+      {
+        if (popChunk(thread_id, begin, end) || stealChunk(thread_id, begin, end))
+        {
+          job(thread_id, begin, end);
+          m_remaining.fetch_sub(end - begin);
+        }
+        else
+          std::this_thread::yield();
+      }
+    }
+
+    void workerLoop(const size_t thread_id)
+    {
+      size_t generation = 0;
+      while (true)
+      {
+        const RangeFunction * job;
+        {
+          std::unique_lock<std::mutex> lock(m_mutex);
+          m_wake_up.wait(lock, [this, generation] { return m_stop || m_generation != generation; });
+          if (m_stop)
+            return;
+          generation = m_generation;
+          job = m_job;
+        }
+
+        work(thread_id, *job);
+
+        {
+          std::lock_guard<std::mutex> lock(m_mutex);
+          --m_active_workers;
+        }
+        m_work_done.notify_one();
+      }
+    }
+
+    Eigen::Index m_grain_size;
+    std::vector<WorkRange> m_ranges;
+    std::vector<std::thread> m_workers;
+    std::atomic<Eigen::Index> m_remaining;
+
+    std::mutex m_submit_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wake_up;
+    std::condition_variable m_work_done;
+    const RangeFunction * m_job;
+    size_t m_generation;
+    size_t m_active_workers;
+    bool m_stop;
+  }; // class ThreadPoolExecutor
+
+} // namespace pinocchio
@@ -0,0 +1,265 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/pgs-solver.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/pgs-solver.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  std::size_t computeConstraintGraphColoring(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    std::vector<std::size_t> & constraint_colors)
+  {
+    typedef Eigen::Matrix<bool, Eigen::Dynamic, 1, Options> BooleanVector;
+    typedef Eigen::Matrix<bool, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> BooleanMatrix;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      constraint_models.size() == constraint_datas.size(),
+      "The number of constraints between constraint_models and constraint_datas vectors is "
+      "different.");
+
+    const std::size_t num_constraints = constraint_models.size();
+
+    // Supporting joints of each constraint, gathered from the sparsity pattern of its rows.
+    BooleanMatrix supports(Eigen::Index(num_constraints), model.nv);
+    BooleanVector row_sparsity;
+    for (std::size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
+    {
+      const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+      const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
+
+      auto support = supports.row(Eigen::Index(constraint_id));
+      support.fill(false);
+      for (Eigen::Index row_id = 0; row_id < cmodel.residualSize(); ++row_id)
+      {
+        cmodel.getRowSparsityPattern(model, data, cdata, row_id, row_sparsity);
+        for (Eigen::Index k = 0; k < model.nv; ++k)
+          support[k] = support[k] || row_sparsity[k];
+      }
+    }
+
+    // Greedy coloring: each constraint gets the smallest color not used by the previous
+    // constraints it is coupled with.
+    constraint_colors.assign(num_constraints, 0);
+    std::vector<bool> forbidden_colors;
+    std::size_t num_colors = 0;
+    for (std::size_t i = 0; i < num_constraints; ++i)
+    {
+      forbidden_colors.assign(num_colors + 1, false);
+      const auto support_i = supports.row(Eigen::Index(i));
+      for (std::size_t j = 0; j < i; ++j)
+      {
+        const auto support_j = supports.row(Eigen::Index(j));
+        for (Eigen::Index k = 0; k < model.nv; ++k)
+        {
+          if (support_i[k] && support_j[k])
+          {
+            forbidden_colors[constraint_colors[j]] = true;
+            break;
+          }
+        }
+      }
+
+      std::size_t color = 0;
+      while (forbidden_colors[color])
+        ++color;
+      constraint_colors[i] = color;
+      num_colors = std::max(num_colors, color + 1);
+    }
+
+    return num_colors;
+  }
+
+  namespace details
+  {
+    template<typename _Scalar, int _Options>
+    struct PGSConstraintSolverInParallelAlgo
+    {
+      typedef _Scalar Scalar;
+      static constexpr int Options = _Options;
+
+      typedef PGSConstraintSolverTpl<Scalar, Options> PGSConstraintSolver;
+      typedef typename PGSConstraintSolver::PGSSolverWorkspace PGSSolverWorkspace;
+      typedef typename PGSConstraintSolver::PGSSolverSettings PGSSolverSettings;
+      typedef typename PGSConstraintSolver::PGSSolverResult PGSSolverResult;
+      typedef Eigen::Matrix<Scalar, 3, Eigen::Dynamic, Options> Matrix3x;
+
+      template<
+        typename Executor,
+        typename DelassusDerived,
+        typename VectorLike,
+        class ConstraintModel,
+        class ConstraintModelAllocator,
+        class ConstraintData,
+        class ConstraintDataAllocator>
+      static bool run(
+        ExecutorBase<Executor> & executor,
+        PGSConstraintSolver & solver,
+        DelassusOperatorBase<DelassusDerived> & delassus,
+        const Eigen::MatrixBase<VectorLike> & g,
+        const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+        const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+        const std::vector<std::size_t> & constraint_colors,
+        const PGSSolverSettings & settings,
+        PGSSolverResult & result)
+      {
+        const std::size_t num_constraints = constraint_models.size();
+        PINOCCHIO_CHECK_ARGUMENT_SIZE(constraint_datas.size(), num_constraints);
+        PINOCCHIO_CHECK_ARGUMENT_SIZE(constraint_colors.size(), num_constraints);
+
+        // First row of each constraint
+        std::vector<Eigen::Index> row_ids(num_constraints + 1, 0);
+        for (std::size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
+        {
+          const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+          row_ids[constraint_id + 1] = row_ids[constraint_id] + cmodel.residualSize();
+        }
+
+        // Group the constraints by color, keeping their relative order
+        const std::size_t num_colors =
+          num_constraints > 0
+            ? *std::max_element(constraint_colors.begin(), constraint_colors.end()) + 1
+            : 0;
+        std::vector<std::size_t> color_offsets(num_colors + 1, 0);
+        for (const std::size_t color : constraint_colors)
+          ++color_offsets[color + 1];
+        for (std::size_t color = 0; color < num_colors; ++color)
+          color_offsets[color + 1] += color_offsets[color];
+
+        std::vector<std::size_t> colored_constraints(num_constraints);
+        {
+          std::vector<std::size_t> cursor(color_offsets.begin(), color_offsets.end() - 1);
+          for (std::size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
+            colored_constraints[cursor[constraint_colors[constraint_id]]++] = constraint_id;
+        }
+
+        // Complementarity, dual and primal feasibilities of each constraint
+        Matrix3x feasibilities(3, Eigen::Index(num_constraints));
+
+        const auto sweep = [&](const auto & G, PGSSolverWorkspace & ws, PGSSolverResult & res) {
+          for (std::size_t color = 0; color < num_colors; ++color)
+          {
+            const std::size_t color_begin = color_offsets[color];
+            const Eigen::Index color_size = Eigen::Index(color_offsets[color + 1] - color_begin);
+
+            // Update dual variables from the impulses of the previous colors
+            executor.parallelFor(color_size, [&](const size_t, const Eigen::Index k) {
+              const std::size_t constraint_id = colored_constraints[color_begin + size_t(k)];
+              const Eigen::Index row_id = row_ids[constraint_id];
+              const Eigen::Index constraint_size = row_ids[constraint_id + 1] - row_id;
+
+              auto velocity = ws.y.segment(row_id, constraint_size);
+              velocity.noalias() = G.middleRows(row_id, constraint_size) * ws.x;
+              velocity += g.segment(row_id, constraint_size);
+            });
+
+            // PGS step for each constraint of the color
+            executor.parallelFor(color_size, [&](const size_t, const Eigen::Index k) {
+              const std::size_t constraint_id = colored_constraints[color_begin + size_t(k)];
+              const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+              const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
+              const Eigen::Index row_id = row_ids[constraint_id];
+              const Eigen::Index constraint_size = row_ids[constraint_id + 1] - row_id;
+
+              auto G_block = G.block(row_id, row_id, constraint_size, constraint_size);
+              auto impulse = ws.x.segment(row_id, constraint_size);
+              auto velocity = ws.y.segment(row_id, constraint_size);
+
+              typedef PGSConstraintProjectionStepVisitor<
+                Scalar, decltype(G_block), decltype(impulse), decltype(velocity)>
+                Step;
+              Step step(settings.over_relaxation);
+              step.run(cmodel, cdata, G_block, impulse, velocity);
+
+              feasibilities.col(Eigen::Index(constraint_id))
+                << step.complementarity,
+                step.dual_feasibility, step.primal_feasibility;
+            });
+          }
+
+          for (Eigen::Index constraint_id = 0; constraint_id < Eigen::Index(num_constraints);
+               ++constraint_id)
+          {
+            res.complementarity = math::max(res.complementarity, feasibilities(0, constraint_id));
+            res.dual_feasibility = math::max(res.dual_feasibility, feasibilities(1, constraint_id));
+            res.primal_feasibility =
+              math::max(res.primal_feasibility, feasibilities(2, constraint_id));
+          }
+        };
+
+        return solver.solveLoop(
+          delassus, g, constraint_models, constraint_datas, settings, result, sweep);
+      }
+    };
+  } // namespace details
+
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    typename DelassusDerived,
+    typename VectorLike,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  bool solveConstraintProblemInParallel(
+    ExecutorBase<Executor> & executor,
+    PGSConstraintSolverTpl<Scalar, Options> & solver,
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const std::vector<std::size_t> & constraint_colors,
+    const PGSSolverSettingsTpl<Scalar> & settings,
+    PGSSolverResultTpl<Scalar, Options> & result)
+  {
+    return details::PGSConstraintSolverInParallelAlgo<Scalar, Options>::run(
+      executor, solver, delassus, g, constraint_models, constraint_datas, constraint_colors,
+      settings, result);
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    typename DelassusDerived,
+    typename VectorLike,
+    class ConstraintModel,
+    class ConstraintModelAllocator,
+    class ConstraintData,
+    class ConstraintDataAllocator>
+  bool solveConstraintProblemInParallel(
+    const size_t num_threads,
+    PGSConstraintSolverTpl<Scalar, Options> & solver,
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const std::vector<std::size_t> & constraint_colors,
+    const PGSSolverSettingsTpl<Scalar> & settings,
+    PGSSolverResultTpl<Scalar, Options> & result)
+  {
+    OpenMPExecutor executor(num_threads);
+    return solveConstraintProblemInParallel(
+      executor, solver, delassus, g, constraint_models, constraint_datas, constraint_colors,
+      settings, result);
+  }
+} // namespace pinocchio
@@ -0,0 +1,105 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/parallel/rnea-derivatives.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/parallel/rnea-derivatives.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeRNEADerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<MatrixPool1> & rnea_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & rnea_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & rnea_partial_da)
+  {
+    typedef ModelPoolTpl<Scalar, Options, JointCollectionTpl> Pool;
+    typedef typename Pool::Model Model;
+    typedef typename Pool::Data Data;
+    typedef typename Pool::ModelVector ModelVector;
+    typedef typename Pool::DataVector DataVector;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(executor.numThreads() <= pool.size(), "The pool is too small");
+
+    const ModelVector & models = pool.getModels();
+    const Model & model_check = models[0];
+    DataVector & datas = pool.getDatas();
+    MatrixPool1 & res_dq = rnea_partial_dq.const_cast_derived();
+    MatrixPool2 & res_dv = rnea_partial_dv.const_cast_derived();
+    MatrixPool3 & res_da = rnea_partial_da.const_cast_derived();
+
+    const Eigen::Index batch_size = q.cols();
+    const Eigen::Index nv = model_check.nv;
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(q.rows(), model_check.nq);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(a.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dq.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dv.rows(), nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_da.rows(), nv);
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(v.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(a.cols(), batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dq.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_dv.cols(), nv * batch_size);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(res_da.cols(), nv * batch_size);
+
+    executor.parallelFor(batch_size, [&](const size_t thread_id, const Eigen::Index i) {
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      res_dq.middleCols(i * nv, nv).setZero();
+      res_dv.middleCols(i * nv, nv).setZero();
+      res_da.middleCols(i * nv, nv).setZero();
+      computeRNEADerivatives(
+        model, data, q.col(i), v.col(i), a.col(i), res_dq.middleCols(i * nv, nv),
+        res_dv.middleCols(i * nv, nv), res_da.middleCols(i * nv, nv));
+    });
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename MatrixPool1,
+    typename MatrixPool2,
+    typename MatrixPool3>
+  void computeRNEADerivativesInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<MatrixPool1> & rnea_partial_dq,
+    const Eigen::MatrixBase<MatrixPool2> & rnea_partial_dv,
+    const Eigen::MatrixBase<MatrixPool3> & rnea_partial_da)
+  {
+    OpenMPExecutor executor(num_threads);
+    computeRNEADerivativesInParallel(
+      executor, pool, q, v, a, rnea_partial_dq, rnea_partial_dv, rnea_partial_da);
+  }
+} // namespace pinocchio
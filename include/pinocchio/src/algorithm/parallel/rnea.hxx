@@ -14,6 +14,7 @@
 namespace pinocchio
 {
   template<
+    typename Executor,
     typename Scalar,
     int Options,
     template<typename, int> class JointCollectionTpl,
@@ -22,7 +23,7 @@ namespace pinocchio
     typename TangentVectorPool2,
     typename TangentVectorPool3>
   void rneaInParallel(
-    const size_t num_threads,
+    ExecutorBase<Executor> & executor,
     ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
     const Eigen::MatrixBase<ConfigVectorPool> & q,
     const Eigen::MatrixBase<TangentVectorPool1> & v,
@@ -36,7 +37,7 @@ namespace pinocchio
     typedef typename Pool::DataVector DataVector;
 
     PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
-    PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads <= pool.size(), "The pool is too small");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(executor.numThreads() <= pool.size(), "The pool is too small");
 
     const ModelVector & models = pool.getModels();
     const Model & model_check = models[0];
@@ -52,18 +53,30 @@ namespace pinocchio
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.cols(), a.cols());
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.cols(), res.cols());
 
-    setDefaultOpenMPSettings(num_threads);
-    const Eigen::Index batch_size = res.cols();
-    Eigen::Index i = 0;
-
-#pragma omp parallel for schedule(                                                                 \
-    static) // we use static here as this is the same computationnal cost for all threads
-    for (i = 0; i < batch_size; i++)
-    {
-      const int thread_id = omp_get_thread_num();
-      const Model & model = models[(size_t)thread_id];
-      Data & data = datas[(size_t)thread_id];
+    executor.parallelFor(res.cols(), [&](const size_t thread_id, const Eigen::Index i) {
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
       res.col(i) = rnea(model, data, q.col(i), v.col(i), a.col(i));
-    }
+    });
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename TangentVectorPool1,
+    typename TangentVectorPool2,
+    typename TangentVectorPool3>
+  void rneaInParallel(
+    const size_t num_threads,
+    ModelPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<TangentVectorPool1> & v,
+    const Eigen::MatrixBase<TangentVectorPool2> & a,
+    const Eigen::MatrixBase<TangentVectorPool3> & tau)
+  {
+    OpenMPExecutor executor(num_threads);
+    rneaInParallel(executor, pool, q, v, a, tau);
   }
 } // namespace pinocchio
@@ -146,6 +146,9 @@ namespace pinocchio
     const Eigen::MatrixBase<ConfigVectorType> & q)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_REGRESSORS)
+      && "data does not have the regressor buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
 
@@ -432,6 +435,9 @@ namespace pinocchio
     const Eigen::MatrixBase<TangentVectorType2> & a)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_REGRESSORS)
+      && "data does not have the regressor buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
     PINOCCHIO_CHECK_ARGUMENT_SIZE(v.size(), model.nv);
@@ -479,6 +485,9 @@ namespace pinocchio
     const Eigen::MatrixBase<TangentVectorType> & v)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_REGRESSORS)
+      && "data does not have the regressor buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
     PINOCCHIO_CHECK_ARGUMENT_SIZE(v.size(), model.nv);
@@ -526,6 +535,9 @@ namespace pinocchio
     const Eigen::MatrixBase<ConfigVectorType> & q)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_REGRESSORS)
+      && "data does not have the regressor buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
     typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
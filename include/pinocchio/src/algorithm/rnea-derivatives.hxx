@@ -498,6 +498,9 @@ namespace pinocchio
         isZero(model.gravity.angular()),
         "The gravity must be a pure force vector, no angular part");
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
@@ -579,6 +582,9 @@ namespace pinocchio
       PINOCCHIO_CHECK_ARGUMENT_SIZE(rnea_partial_da.cols(), model.nv);
       PINOCCHIO_CHECK_ARGUMENT_SIZE(rnea_partial_da.rows(), model.nv);
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES)
+        && "data does not have the derivative buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
       typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
@@ -642,6 +642,9 @@ namespace pinocchio
       const Eigen::MatrixBase<TangentVectorType> & v)
     {
       assert(model.check(data) && "data is not consistent with model.");
+      assert(
+        data.hasFeatures(DATA_MASS_MATRIX)
+        && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
       assert(model.check(MimicChecker()) && "Function does not support mimic joints");
       PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
       PINOCCHIO_CHECK_ARGUMENT_SIZE(v.size(), model.nv);
@@ -729,6 +732,9 @@ namespace pinocchio
     DataTpl<Scalar, Options, JointCollectionTpl> & data)
   {
     assert(model.check(data) && "data is not consistent with model.");
+    assert(
+      data.hasFeatures(DATA_MASS_MATRIX)
+      && "data does not have the mass matrix buffers (see DataTpl::allocateFeatures).");
     assert(model.check(MimicChecker()) && "Function does not support mimic joints");
 
     typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
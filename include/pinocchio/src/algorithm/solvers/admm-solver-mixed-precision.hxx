@@ -0,0 +1,103 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/algorithm/solvers/admm-solver-mixed-precision.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/algorithm/solvers/admm-solver-mixed-precision.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  template<typename _Scalar, typename _LowScalar, int _Options>
+  template<
+    typename LowPrecisionDelassusDerived,
+    typename LowPrecisionConstraintModel,
+    typename LowPrecisionConstraintModelAllocator,
+    typename LowPrecisionConstraintData,
+    typename LowPrecisionConstraintDataAllocator,
+    typename DelassusDerived,
+    typename VectorLike,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator>
+  bool ADMMMixedPrecisionConstraintSolverTpl<_Scalar, _LowScalar, _Options>::solve(
+    DelassusOperatorBase<LowPrecisionDelassusDerived> & low_precision_delassus,
+    const std::vector<LowPrecisionConstraintModel, LowPrecisionConstraintModelAllocator> &
+      low_precision_constraint_models,
+    const std::vector<LowPrecisionConstraintData, LowPrecisionConstraintDataAllocator> &
+      low_precision_constraint_datas,
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const ADMMSolverSettings & settings,
+    ADMMSolverResult & result)
+  {
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      low_precision_delassus.rows(), delassus.rows(),
+      "The low precision Delassus operator is not of right size.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      low_precision_constraint_models.size(), constraint_models.size(),
+      "The number of low precision constraint models is not the same.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      low_precision_constraint_datas.size(), constraint_datas.size(),
+      "The number of low precision constraint datas is not the same.");
+
+    // -- low precision settings, the tolerances being bounded by what LowScalar can reach
+    LowPrecisionADMMSolverSettings low_precision_settings = settings.template cast<LowScalar>();
+    low_precision_settings.absolute_feasibility_tol =
+      LowScalar(math::max(settings.absolute_feasibility_tol, low_precision_tolerance));
+    low_precision_settings.relative_feasibility_tol =
+      LowScalar(math::max(settings.relative_feasibility_tol, low_precision_tolerance));
+    low_precision_settings.absolute_complementarity_tol =
+      LowScalar(math::max(settings.absolute_complementarity_tol, low_precision_tolerance));
+    low_precision_settings.relative_complementarity_tol =
+      LowScalar(math::max(settings.relative_complementarity_tol, low_precision_tolerance));
+
+    // -- forward the user warm start to the low precision solve
+    if (result.impulse_guess)
+    {
+      m_low_precision_guess = result.impulse_guess.value().template cast<LowScalar>();
+      low_precision_result.setConstraintImpulseGuess(m_low_precision_guess);
+    }
+    else
+    {
+      low_precision_result.clearConstraintImpulseGuess();
+    }
+    if (result.velocity_guess)
+    {
+      m_low_precision_guess = result.velocity_guess.value().template cast<LowScalar>();
+      low_precision_result.setConstraintVelocityGuess(m_low_precision_guess);
+    }
+    else
+    {
+      low_precision_result.clearConstraintVelocityGuess();
+    }
+
+    // -- bulk of the iterations in low precision
+    m_low_precision_g = g.template cast<LowScalar>();
+    low_precision_solver.solve(
+      low_precision_delassus, m_low_precision_g, low_precision_constraint_models,
+      low_precision_constraint_datas, low_precision_settings, low_precision_result);
+
+    // -- refinement in high precision, warm-started with the low precision solution and rho
+    ADMMSolverSettings refinement_settings = settings;
+    refinement_settings.rho_init = Scalar(low_precision_result.rho);
+    refinement_settings.spectral_rho_power_init = Scalar(low_precision_result.spectral_rho_power);
+    refinement_settings.warmstart_rho_with_previous_result = false;
+
+    m_guess = low_precision_result.y.template cast<Scalar>();
+    result.setConstraintImpulseGuess(m_guess);
+    m_guess = (low_precision_result.z - low_precision_result.desaxce).template cast<Scalar>();
+    result.setConstraintVelocityGuess(m_guess);
+
+    return solver.solve(
+      delassus, g, constraint_models, constraint_datas, refinement_settings, result);
+  }
+} // namespace pinocchio
@@ -490,6 +490,12 @@ namespace pinocchio
       stats.delassus_decomposition_update_count = ws.delassus_decomposition_update_count;
     }
 
+    // Optimality residual, evaluated with the undamped Delassus
+    G.applyOnTheRight(ws.y, ws.tmp, false /* without damping */);
+    ws.tmp += g;
+    ws.tmp += ws.desaxce - ws.z;
+    res.residual = ws.tmp.template lpNorm<Eigen::Infinity>();
+
     res.x = ws.x;
     res.y = ws.y;
     res.z = ws.z;
@@ -507,6 +513,55 @@ namespace pinocchio
     return res.converged;
   }
 
+  namespace internal
+  {
+    /// \brief Estimates the largest eigenvalue of a Delassus operator by building a Lanczos
+    /// decomposition from scratch.
+    template<typename DelassusDerived>
+    struct DelassusLargestEigenvalueEstimator
+    {
+      template<typename Workspace>
+      static typename DelassusDerived::Scalar run(const DelassusDerived & G, Workspace & workspace)
+      {
+        typedef typename DelassusDerived::Scalar Scalar;
+        workspace.resizeLanczosDecomposition();
+        workspace.lanczos_decomposition.compute(G);
+        return ::pinocchio::computeLargestEigenvalue(
+          workspace.lanczos_decomposition.Ts(), Scalar(1e-8));
+      }
+    };
+
+    /// \brief Matrix-free operators of rigid body systems keep a spectral estimate across the
+    /// time steps, which is refreshed with a few warm-started power iterations.
+    template<
+      typename Scalar,
+      int Options,
+      template<typename, int> class JointCollectionTpl,
+      class ConstraintModel,
+      template<typename T> class StorageHolder>
+    struct DelassusLargestEigenvalueEstimator<DelassusOperatorRigidBodySystemsTpl<
+      Scalar,
+      Options,
+      JointCollectionTpl,
+      ConstraintModel,
+      StorageHolder>>
+    {
+      typedef DelassusOperatorRigidBodySystemsTpl<
+        Scalar,
+        Options,
+        JointCollectionTpl,
+        ConstraintModel,
+        StorageHolder>
+        DelassusOperator;
+
+      template<typename Workspace>
+      static Scalar run(const DelassusOperator & G, Workspace &)
+      {
+        return G.computeLargestEigenvalueEstimate();
+      }
+    };
+  } // namespace internal
+
   template<typename Scalar, int Options>
   template<typename DelassusDerived>
   Scalar ADMMConstraintSolverTpl<Scalar, Options>::computeDelassusLargestEigenvalue(
@@ -517,8 +572,7 @@ namespace pinocchio
     if (workspace.problem_size > 1)
     {
       PINOCCHIO_TRACY_ZONE_SCOPED_N("ADMMConstraintSolverTpl::solve - lanczos");
-      workspace.lanczos_decomposition.compute(G);
-      L = ::pinocchio::computeLargestEigenvalue(workspace.lanczos_decomposition.Ts(), 1e-8);
+      L = internal::DelassusLargestEigenvalueEstimator<DelassusDerived>::run(G, workspace);
 #ifndef NDEBUG
       const bool enforce_symmetry = true;
       MatrixXs delassus = G.matrix(enforce_symmetry);
@@ -30,9 +30,16 @@ namespace pinocchio
     {
       this->details.problem_size = new_problem_size;
       this->details.capacity = new_capacity;
-      this->details.xs.resize(this->capacity(), VectorXs::Zero(this->problem_size()));
-      this->details.zs.resize(this->capacity(), VectorXs::Zero(this->problem_size()));
-      this->details.zdiffs.resize(this->capacity(), VectorXs::Zero(this->problem_size()));
+      // No temporary vector is created, so that a history without capacity never allocates.
+      this->details.xs.resize(this->capacity());
+      this->details.zs.resize(this->capacity());
+      this->details.zdiffs.resize(this->capacity());
+      for (std::size_t k = 0; k < this->capacity(); ++k)
+      {
+        this->details.xs[k].setZero(this->problem_size());
+        this->details.zs[k].setZero(this->problem_size());
+        this->details.zdiffs[k].setZero(this->problem_size());
+      }
       this->details.weights.resize(math::max(0, int(this->capacity() - 1)));
       this->details.M.resize(this->problem_size(), math::max(0, int(this->capacity() - 1)));
       this->clear();
@@ -592,6 +592,60 @@ namespace pinocchio
     const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
     const PGSSolverSettings & settings,
     PGSSolverResult & result)
+  {
+    const std::size_t num_constraints = constraint_models.size();
+
+    // Sequential sweep over the constraints, following their order in constraint_models.
+    const auto sweep = [&](const auto & G, PGSSolverWorkspace & ws, PGSSolverResult & res) {
+      Eigen::Index row_id = 0;
+      for (size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
+      {
+        const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
+        const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
+        const Eigen::Index constraint_size = cmodel.residualSize();
+
+        auto G_block = G.block(row_id, row_id, constraint_size, constraint_size);
+        auto impulse = ws.x.segment(row_id, constraint_size);
+        auto velocity = ws.y.segment(row_id, constraint_size);
+
+        // Update dual variable
+        velocity.noalias() = G.middleRows(row_id, constraint_size) * ws.x;
+        velocity += g.segment(row_id, constraint_size);
+
+        typedef PGSConstraintProjectionStepVisitor<
+          Scalar, decltype(G_block), decltype(impulse), decltype(velocity)>
+          Step;
+        Step step(settings.over_relaxation);
+        step.run(cmodel, cdata, G_block, impulse, velocity);
+
+        res.complementarity = math::max(res.complementarity, step.complementarity);
+        res.dual_feasibility = math::max(res.dual_feasibility, step.dual_feasibility);
+        res.primal_feasibility = math::max(res.primal_feasibility, step.primal_feasibility);
+
+        row_id += constraint_size;
+      }
+    };
+
+    return solveLoop(delassus, g, constraint_models, constraint_datas, settings, result, sweep);
+  }
+
+  template<typename _Scalar, int _Options>
+  template<
+    typename DelassusDerived,
+    typename VectorLike,
+    typename ConstraintModel,
+    typename ConstraintModelAllocator,
+    typename ConstraintData,
+    typename ConstraintDataAllocator,
+    typename SweepFunction>
+  bool PGSConstraintSolverTpl<_Scalar, _Options>::solveLoop(
+    DelassusOperatorBase<DelassusDerived> & delassus,
+    const Eigen::MatrixBase<VectorLike> & g,
+    const std::vector<ConstraintModel, ConstraintModelAllocator> & constraint_models,
+    const std::vector<ConstraintData, ConstraintDataAllocator> & constraint_datas,
+    const PGSSolverSettings & settings,
+    PGSSolverResult & result,
+    const SweepFunction & sweep)
   {
     // for easier access
     PGSSolverResult & res = result;
@@ -666,7 +720,6 @@ namespace pinocchio
     bool abs_prec_reached = false;
     bool rel_prec_reached = false;
     Scalar x_previous_norm_inf = ws.x.template lpNorm<Eigen::Infinity>();
-    const std::size_t num_constraints = constraint_models.size();
 
     res.iterations = 0;
     for (; res.iterations <= settings.max_iterations; ++res.iterations)
@@ -678,33 +731,7 @@ namespace pinocchio
       res.primal_feasibility = Scalar(0);
 
       // PGS step for each constraint
-      Eigen::Index row_id = 0;
-      for (size_t constraint_id = 0; constraint_id < num_constraints; ++constraint_id)
-      {
-        const auto & cmodel = internal::helper::get_ref(constraint_models[constraint_id]);
-        const auto & cdata = internal::helper::get_ref(constraint_datas[constraint_id]);
-        const Eigen::Index constraint_size = cmodel.residualSize();
-
-        auto G_block = G.block(row_id, row_id, constraint_size, constraint_size);
-        auto impulse = ws.x.segment(row_id, constraint_size);
-        auto velocity = ws.y.segment(row_id, constraint_size);
-
-        // Update dual variable
-        velocity.noalias() = G.middleRows(row_id, constraint_size) * ws.x;
-        velocity += g.segment(row_id, constraint_size);
-
-        typedef PGSConstraintProjectionStepVisitor<
-          Scalar, decltype(G_block), decltype(impulse), decltype(velocity)>
-          Step;
-        Step step(settings.over_relaxation);
-        step.run(cmodel, cdata, G_block, impulse, velocity);
-
-        res.complementarity = math::max(res.complementarity, step.complementarity);
-        res.dual_feasibility = math::max(res.dual_feasibility, step.dual_feasibility);
-        res.primal_feasibility = math::max(res.primal_feasibility, step.primal_feasibility);
-
-        row_id += constraint_size;
-      }
+      sweep(G, ws, res);
 
       // Checking stopping criterion
       // -- absolute
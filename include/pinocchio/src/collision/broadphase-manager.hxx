@@ -200,6 +200,13 @@ namespace pinocchio
     /// @brief Disable status related to each collision objects.
     std::vector<bool> collision_object_is_active;
 
+    /// @brief Collision objects activated or deactivated since the last update.
+    /// Their capacity is reserved in init() so that update does not allocate.
+    std::vector<size_t> new_active_collision_objects, new_inactive_collision_objects;
+
+    /// @brief Buffer of the objects registered in the manager, used by check().
+    mutable std::vector<coal::CollisionObject *> registered_collision_objects;
+
     /// @brief Initialialisation of BroadPhaseManagerTpl
     void init();
 
@@ -223,7 +230,10 @@ namespace pinocchio
     GeometryData & geom_data = getGeometryData();
 
     // Pass 1: check the new active geometries and list the new deactive geometries
-    std::vector<size_t> new_active, new_inactive;
+    std::vector<size_t> & new_active = new_active_collision_objects;
+    std::vector<size_t> & new_inactive = new_inactive_collision_objects;
+    new_active.clear();
+    new_inactive.clear();
     for (size_t k = 0; k < selected_geometry_objects.size(); ++k)
     {
       const size_t geometry_object_id = selected_geometry_objects[k];
@@ -345,7 +355,8 @@ namespace pinocchio
   template<typename Manager>
   bool BroadPhaseManagerTpl<Manager>::check() const
   {
-    std::vector<coal::CollisionObject *> collision_objects_ptr = manager.getObjects();
+    std::vector<coal::CollisionObject *> & collision_objects_ptr = registered_collision_objects;
+    manager.getObjects(collision_objects_ptr);
     if (collision_objects_ptr.size() > collision_objects.size())
       return false;
 
@@ -406,6 +417,9 @@ namespace pinocchio
   {
     const GeometryModel & geom_model = getGeometryModel();
     collision_objects.reserve(selected_geometry_objects.size());
+    new_active_collision_objects.reserve(selected_geometry_objects.size());
+    new_inactive_collision_objects.reserve(selected_geometry_objects.size());
+    registered_collision_objects.reserve(selected_geometry_objects.size());
     for (size_t k = 0; k < selected_geometry_objects.size(); ++k)
     {
       const size_t geometry_id = selected_geometry_objects[k];
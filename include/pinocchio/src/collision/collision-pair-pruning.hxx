@@ -0,0 +1,274 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/collision/collision-pair-pruning.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/collision/collision-pair-pruning.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  namespace details
+  {
+    /// Distance from the origin of the parent joint to the farthest point of the geometry, as
+    /// in computeBodyRadius.
+    inline GeometryData::Scalar computeGeometryRadius(const GeometryObject & geom_object)
+    {
+      typedef GeometryData::Scalar GeometryScalar;
+
+      const GeometryObject::CollisionGeometryPtr & geometry = geom_object.geometry;
+      const_cast<coal::CollisionGeometry &>(*geometry).computeLocalAABB();
+
+      const coal::AABB & aabb = geometry->aabb_local;
+      GeometryScalar radius = GeometryScalar(0);
+      for (int corner = 0; corner < 8; ++corner)
+      {
+        const GeometryModel::SE3::Vector3 point(
+          (corner & 1) ? aabb.max_[0] : aabb.min_[0], (corner & 2) ? aabb.max_[1] : aabb.min_[1],
+          (corner & 4) ? aabb.max_[2] : aabb.min_[2]);
+        radius = math::max(radius, geom_object.placement.act(point).norm());
+      }
+      return radius;
+    }
+  } // namespace details
+
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  std::size_t computeCollisionPairPruning(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    CollisionPairPruningCache & cache,
+    const CollisionPairPruningSettings & settings)
+  {
+    typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+    typedef typename Model::JointIndex JointIndex;
+    typedef typename Model::IndexVector IndexVector;
+    typedef typename Model::ConfigVectorType ConfigVectorType;
+    typedef GeometryData::Scalar GeometryScalar;
+    typedef Eigen::Matrix<GeometryScalar, Eigen::Dynamic, 1> VectorXs;
+
+    const std::size_t num_pairs = geom_model.collisionPairs.size();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.collisionRequests.size(), num_pairs,
+      "The geometry data is not consistent with the geometry model.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      settings.security_margin >= 0., "The security margin should be non negative.");
+
+    const auto pair_margin = [&](const std::size_t cp_index) {
+      return geom_data.collisionRequests[cp_index].security_margin + settings.security_margin;
+    };
+    const auto pair_distance = [&](const std::size_t cp_index) {
+      const coal::DistanceResult & distance_result =
+        computeDistance(geom_model, geom_data, cp_index);
+      return distance_result.min_distance - geom_data.distanceRequests[cp_index].gjk_tolerance;
+    };
+
+    // Sampling box, the unbounded coordinates (default limits being +/- max) being sampled in
+    // [-1, 1]. It only leads to keep more pairs.
+    ConfigVectorType lower_limits = model.lowerPositionLimit,
+                     upper_limits = model.upperPositionLimit;
+    for (Eigen::Index k = 0; k < model.nq; ++k)
+    {
+      if (!std::isfinite(upper_limits[k] - lower_limits[k]))
+      {
+        lower_limits[k] = Scalar(-1);
+        upper_limits[k] = Scalar(1);
+      }
+    }
+
+    // 1. Discard the pairs found in collision at random configurations
+    std::vector<bool> can_collide(num_pairs, false);
+    ConfigVectorType q(model.nq);
+    for (std::size_t sample = 0; sample < settings.num_samples; ++sample)
+    {
+      randomConfiguration(model, lower_limits, upper_limits, q);
+      updateGeometryPlacements(model, data, geom_model, geom_data, q);
+      for (std::size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+      {
+        if (!can_collide[cp_index] && pair_distance(cp_index) <= pair_margin(cp_index))
+          can_collide[cp_index] = true;
+      }
+    }
+
+    // 2. Lipschitz constants of the joints: a point at distance r from the origin of the child
+    // frame of a joint moves by at most (|v| + |w| r) per unit of joint position, (v, w) being
+    // the motion subspace of the joint. Only joints with one degree of freedom and finite limits
+    // are supported.
+    q = neutral(model);
+    forwardKinematics(model, data, q);
+    std::vector<bool> is_bounded(size_t(model.njoints), false);
+    VectorXs linear_speed = VectorXs::Zero(model.njoints);
+    VectorXs angular_speed = VectorXs::Zero(model.njoints);
+    VectorXs extension = VectorXs::Zero(model.njoints);
+    for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+    {
+      const auto & jmodel = model.joints[joint_id];
+      if (jmodel.nq() != 1 || jmodel.nv() != 1)
+        continue;
+
+      const Eigen::Index idx_q = jmodel.idx_q();
+      const Scalar lower = model.lowerPositionLimit[idx_q], upper = model.upperPositionLimit[idx_q];
+      if (!std::isfinite(upper - lower))
+        continue;
+
+      const auto S = data.joints[joint_id].S().matrix();
+      is_bounded[joint_id] = true;
+      linear_speed[joint_id] = GeometryScalar(S.col(0).template head<3>().norm());
+      angular_speed[joint_id] = GeometryScalar(S.col(0).template tail<3>().norm());
+      // Largest displacement of the origin of the child frame
+      extension[joint_id] =
+        linear_speed[joint_id] * GeometryScalar(math::max(math::fabs(lower), math::fabs(upper)));
+    }
+
+    // 3. Certify the remaining pairs by bisection of the joint limits along their path
+    std::vector<JointIndex> path_joints;
+    std::vector<GeometryScalar> levers;
+    VectorXs lipschitz, box_lower, box_upper, half_widths;
+    std::vector<std::pair<VectorXs, VectorXs>> boxes;
+
+    cache.pruned_pairs.clear();
+    for (std::size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+    {
+      if (can_collide[cp_index])
+        continue;
+
+      const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+      const GeomIndex geom_ids[2] = {cp.first, cp.second};
+
+      // Joints between the common ancestor and the parent joints of the geometries
+      const IndexVector & support1 =
+        model.supports[geom_model.geometryObjects[geom_ids[0]].parentJoint];
+      const IndexVector & support2 =
+        model.supports[geom_model.geometryObjects[geom_ids[1]].parentJoint];
+      std::size_t common = 0;
+      while (common < support1.size() && common < support2.size()
+             && support1[common] == support2[common])
+        ++common;
+
+      bool is_certifiable = true;
+      path_joints.clear();
+      levers.clear();
+      for (int side = 0; side < 2 && is_certifiable; ++side)
+      {
+        const GeometryObject & geom_object = geom_model.geometryObjects[geom_ids[side]];
+        const IndexVector & support = side == 0 ? support1 : support2;
+        if (model.mimic_joint_supports[geom_object.parentJoint].size() > 1)
+          is_certifiable = false;
+
+        // Distance from the child frame of each joint to the farthest point of the geometry,
+        // accumulated from the geometry up to the common ancestor.
+        GeometryScalar lever = details::computeGeometryRadius(geom_object);
+        for (std::size_t k = support.size(); k-- > common;)
+        {
+          const JointIndex joint_id = support[k];
+          if (!is_bounded[joint_id])
+          {
+            is_certifiable = false;
+            break;
+          }
+          path_joints.push_back(joint_id);
+          levers.push_back(lever);
+          lever += GeometryScalar(model.jointPlacements[joint_id].translation().norm())
+                   + extension[joint_id];
+        }
+      }
+      if (!is_certifiable)
+        continue;
+
+      const Eigen::Index path_size = Eigen::Index(path_joints.size());
+      lipschitz.resize(path_size);
+      box_lower.resize(path_size);
+      box_upper.resize(path_size);
+      for (Eigen::Index k = 0; k < path_size; ++k)
+      {
+        const JointIndex joint_id = path_joints[size_t(k)];
+        const Eigen::Index idx_q = model.joints[joint_id].idx_q();
+        lipschitz[k] = linear_speed[joint_id] + angular_speed[joint_id] * levers[size_t(k)];
+        box_lower[k] = GeometryScalar(model.lowerPositionLimit[idx_q]);
+        box_upper[k] = GeometryScalar(model.upperPositionLimit[idx_q]);
+      }
+
+      // Branch and bound over the boxes of joint positions
+      const GeometryScalar margin = pair_margin(cp_index);
+      boxes.clear();
+      boxes.push_back(std::make_pair(box_lower, box_upper));
+      std::size_t num_boxes = 0;
+      bool is_certified = true;
+      q = neutral(model);
+      while (!boxes.empty())
+      {
+        if (num_boxes++ == settings.max_num_boxes)
+        {
+          is_certified = false;
+          break;
+        }
+
+        const std::pair<VectorXs, VectorXs> box = boxes.back();
+        boxes.pop_back();
+        for (Eigen::Index k = 0; k < path_size; ++k)
+          q[model.joints[path_joints[size_t(k)]].idx_q()] =
+            Scalar(0.5 * (box.first[k] + box.second[k]));
+        updateGeometryPlacements(model, data, geom_model, geom_data, q);
+
+        const GeometryScalar distance = pair_distance(cp_index) - margin;
+        if (distance <= GeometryScalar(0))
+        {
+          is_certified = false;
+          break;
+        }
+
+        half_widths = GeometryScalar(0.5) * (box.second - box.first);
+        const VectorXs variations = lipschitz.cwiseProduct(half_widths);
+        if (path_size == 0 || distance > variations.sum())
+          continue;
+
+        // Bisect the box along the joint contributing the most to the bound
+        Eigen::Index split_id;
+        variations.maxCoeff(&split_id);
+        const GeometryScalar middle =
+          GeometryScalar(0.5) * (box.first[split_id] + box.second[split_id]);
+        std::pair<VectorXs, VectorXs> lower_box = box, upper_box = box;
+        lower_box.second[split_id] = middle;
+        upper_box.first[split_id] = middle;
+        boxes.push_back(lower_box);
+        boxes.push_back(upper_box);
+      }
+
+      if (is_certified)
+        cache.pruned_pairs.push_back(cp);
+    }
+
+    cache.lowerPositionLimit = model.lowerPositionLimit.template cast<GeometryScalar>();
+    cache.upperPositionLimit = model.upperPositionLimit.template cast<GeometryScalar>();
+    cache.geometry_names.resize(geom_model.ngeoms);
+    for (GeomIndex geom_id = 0; geom_id < geom_model.ngeoms; ++geom_id)
+      cache.geometry_names[geom_id] = geom_model.geometryObjects[geom_id].name;
+    cache.security_margin = settings.security_margin;
+
+    return cache.pruned_pairs.size();
+  }
+
+} // namespace pinocchio
+
+#ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
+
+namespace pinocchio
+{
+
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI std::size_t
+  computeCollisionPairPruning<context::Scalar, context::Options, JointCollectionDefaultTpl>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    CollisionPairPruningCache &,
+    const CollisionPairPruningSettings &);
+
+} // namespace pinocchio
+#endif // ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
@@ -68,6 +68,20 @@ namespace pinocchio
     coal::CollisionResult & collision_result = geom_data.collisionResults[pair_id];
     collision_result.clear();
 
+    coal::DistanceResult field_distance_result;
+    if (details::computeDistanceFromSignedDistanceField(
+          geom_model, geom_data, pair_id, field_distance_result))
+    {
+      const double distance = field_distance_result.min_distance;
+      collision_result.distance_lower_bound = distance;
+      if (distance <= collision_request.security_margin && collision_request.num_max_contacts > 0)
+        collision_result.addContact(coal::Contact(
+          field_distance_result.o1, field_distance_result.o2, field_distance_result.b1,
+          field_distance_result.b2, field_distance_result.nearest_points[0],
+          field_distance_result.nearest_points[1], field_distance_result.normal, distance));
+      return collision_result.isCollision();
+    }
+
     coal::Transform3s oM1(toCoalTransform3s(geom_data.oMg[pair.first])),
       oM2(toCoalTransform3s(geom_data.oMg[pair.second]));
 
@@ -158,6 +172,222 @@ namespace pinocchio
     return computeCollisions(geom_model, geom_data, stopAtFirstCollision);
   }
 
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  inline bool computeCollisionsWithTemporalCoherence(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const bool stopAtFirstCollision)
+  {
+    typedef GeometryData::Scalar GeometryScalar;
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.radius.size(), size_t(model.njoints),
+      "The body radius have not been computed. Please call computeBodyRadius first.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.coherence_pair_distances.size(), geom_model.collisionPairs.size(),
+      "The coherence cache is not consistent with the geometry model.");
+
+    updateGeometryPlacements(model, data, geom_model, geom_data, q);
+
+    // Accumulate an upper bound on the displacement of the bodies since the previous call.
+    // A point at distance r from the joint origin moves by at most the displacement of the origin
+    // plus r times the chord 2 sin(theta/2) = sqrt(3 - tr(R R_prev^T)) of the relative rotation.
+    std::vector<GeometryData::SE3> & joint_placements = geom_data.coherence_joint_placements;
+    std::vector<GeometryScalar> & joint_displacements = geom_data.coherence_joint_displacements;
+    if (joint_placements.size() != size_t(model.njoints))
+    {
+      joint_placements.resize(size_t(model.njoints));
+      joint_displacements.assign(size_t(model.njoints), GeometryScalar(0));
+      for (JointIndex joint_id = 0; joint_id < JointIndex(model.njoints); ++joint_id)
+        joint_placements[joint_id] = data.oMi[joint_id];
+    }
+    else
+    {
+      for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+      {
+        GeometryData::SE3 & oMi_prev = joint_placements[joint_id];
+        const typename DataTpl<Scalar, Options, JointCollectionTpl>::SE3 & oMi =
+          data.oMi[joint_id];
+
+        const GeometryScalar translation_displacement =
+          (oMi.translation() - oMi_prev.translation()).norm();
+        const GeometryScalar chord = math::sqrt(math::max(
+          GeometryScalar(0),
+          GeometryScalar(3) - oMi.rotation().cwiseProduct(oMi_prev.rotation()).sum()));
+        joint_displacements[joint_id] +=
+          translation_displacement + chord * geom_data.radius[joint_id];
+        oMi_prev = oMi;
+      }
+    }
+
+    bool isColliding = false;
+    for (std::size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+    {
+      const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+      const GeometryObject & geom_object1 = geom_model.geometryObjects[cp.first];
+      const GeometryObject & geom_object2 = geom_model.geometryObjects[cp.second];
+
+      if (
+        !geom_data.activeCollisionPairs[cp_index]
+        || (geom_object1.disableCollision || geom_object2.disableCollision))
+        continue;
+
+      // Skip the pair if its bodies cannot have travelled the separation distance.
+      const GeometryScalar pair_displacement = joint_displacements[geom_object1.parentJoint]
+                                               + joint_displacements[geom_object2.parentJoint];
+      GeometryScalar & pair_distance = geom_data.coherence_pair_distances[cp_index];
+      GeometryScalar & pair_displacement_ref = geom_data.coherence_pair_displacements[cp_index];
+      if (pair_distance > pair_displacement - pair_displacement_ref)
+        continue;
+
+      // Narrow phase
+      const coal::DistanceResult & distance_result =
+        computeDistance(geom_model, geom_data, cp_index);
+      pair_distance = distance_result.min_distance
+                      - geom_data.collisionRequests[cp_index].security_margin
+                      - geom_data.distanceRequests[cp_index].gjk_tolerance;
+      pair_displacement_ref = pair_displacement;
+
+      bool res = false;
+      if (pair_distance > GeometryScalar(0))
+        geom_data.collisionResults[cp_index].clear();
+      else
+        res = computeCollision(geom_model, geom_data, cp_index);
+
+      if (!isColliding && res)
+      {
+        isColliding = true;
+        geom_data.collisionPairIndex = cp_index; // first pair to be in collision
+        if (stopAtFirstCollision)
+          return true;
+      }
+    }
+
+    return isColliding;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType1,
+    typename ConfigVectorType2>
+  inline bool computeContinuousCollisions(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType1> & q0,
+    const Eigen::MatrixBase<ConfigVectorType2> & q1,
+    Scalar & time_of_contact,
+    const Scalar tolerance)
+  {
+    typedef ModelTpl<Scalar, Options, JointCollectionTpl> Model;
+    typedef DataTpl<Scalar, Options, JointCollectionTpl> Data;
+    typedef typename Model::JointIndex JointIndex;
+    typedef typename Model::VectorXs VectorXs;
+    typedef typename Data::Motion Motion;
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q0.size(), model.nq, "The initial configuration vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q1.size(), model.nq, "The final configuration vector is not of right size");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.radius.size(), size_t(model.njoints),
+      "The body radius have not been computed. Please call computeBodyRadius first.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(tolerance > Scalar(0), "The tolerance should be positive.");
+
+    const Scalar infinity = std::numeric_limits<Scalar>::infinity();
+    const std::size_t num_pairs = geom_model.collisionPairs.size();
+
+    // Earliest time at which each pair may be in collision. Inactive pairs are never checked.
+    std::vector<Scalar> pair_times(num_pairs, Scalar(0));
+    for (std::size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+    {
+      const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+      if (
+        !geom_data.activeCollisionPairs[cp_index]
+        || geom_model.geometryObjects[cp.first].disableCollision
+        || geom_model.geometryObjects[cp.second].disableCollision)
+        pair_times[cp_index] = infinity;
+    }
+
+    const VectorXs v = difference(model, q0, q1);
+    VectorXs q(model.nq);
+
+    // Upper bounds on the angular velocity of the joint frames, on the velocity of their origin
+    // and on the velocity of the points of the supported bodies.
+    std::vector<Scalar> angular_speeds(size_t(model.njoints), Scalar(0));
+    std::vector<Scalar> linear_speeds(size_t(model.njoints), Scalar(0));
+    std::vector<Scalar> body_speeds(size_t(model.njoints), Scalar(0));
+
+    while (num_pairs > 0)
+    {
+      const Scalar t = *std::min_element(pair_times.begin(), pair_times.end());
+      if (t > Scalar(1))
+        break;
+
+      interpolate(model, q0, q1, t, q);
+      forwardKinematics(model, data, q, v);
+      updateGeometryPlacements(model, data, geom_model, geom_data);
+
+      // Speed bounds valid over [t, 1]. The distance between a joint origin and the origin of its
+      // parent grows at most as fast as the linear velocity of the joint.
+      for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+      {
+        const JointIndex parent_id = model.parents[joint_id];
+        const Motion joint_velocity =
+          data.v[joint_id] - data.liMi[joint_id].actInv(data.v[parent_id]);
+        const Scalar joint_angular_speed = joint_velocity.angular().norm();
+        const Scalar joint_linear_speed = joint_velocity.linear().norm();
+        const Scalar segment_length =
+          data.liMi[joint_id].translation().norm() + joint_linear_speed * (Scalar(1) - t);
+
+        angular_speeds[joint_id] = angular_speeds[parent_id] + joint_angular_speed;
+        linear_speeds[joint_id] = linear_speeds[parent_id]
+                                  + angular_speeds[parent_id] * segment_length
+                                  + joint_linear_speed;
+        body_speeds[joint_id] =
+          linear_speeds[joint_id] + angular_speeds[joint_id] * geom_data.radius[joint_id];
+      }
+
+      // Narrow phase on the pairs reaching their safe time
+      for (std::size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+      {
+        if (pair_times[cp_index] > t)
+          continue;
+
+        const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+        const coal::DistanceResult & distance_result =
+          computeDistance(geom_model, geom_data, cp_index);
+        const Scalar distance = Scalar(distance_result.min_distance)
+                                - geom_data.collisionRequests[cp_index].security_margin
+                                - geom_data.distanceRequests[cp_index].gjk_tolerance;
+        if (distance <= tolerance)
+        {
+          time_of_contact = t;
+          geom_data.collisionPairIndex = cp_index;
+          return true;
+        }
+
+        const Scalar pair_speed =
+          body_speeds[geom_model.geometryObjects[cp.first].parentJoint]
+          + body_speeds[geom_model.geometryObjects[cp.second].parentJoint];
+        pair_times[cp_index] = pair_speed > Scalar(0) ? t + distance / pair_speed : infinity;
+      }
+    }
+
+    time_of_contact = Scalar(1);
+    return false;
+  }
+
   /* --- RADIUS -------------------------------------------------------------------- */
   /* --- RADIUS -------------------------------------------------------------------- */
   /* --- RADIUS -------------------------------------------------------------------- */
@@ -237,6 +467,35 @@ namespace pinocchio
     const Eigen::MatrixBase<context::VectorXs> &,
     const bool stopAtFirstCollision);
 
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI bool
+  computeCollisionsWithTemporalCoherence<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const bool stopAtFirstCollision);
+
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI bool
+  computeContinuousCollisions<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    context::Scalar &,
+    const context::Scalar);
+
   extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI void
   computeBodyRadius<context::Scalar, context::Options, JointCollectionDefaultTpl>(
     const Model &, const GeometryModel &, GeometryData &);
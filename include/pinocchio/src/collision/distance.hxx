@@ -58,6 +58,10 @@ namespace pinocchio
     coal::DistanceResult & distance_result = geom_data.distanceResults[pair_id];
     distance_result.clear();
 
+    if (details::computeDistanceFromSignedDistanceField(
+          geom_model, geom_data, pair_id, distance_result))
+      return distance_result;
+
     coal::Transform3s oM1(toCoalTransform3s(geom_data.oMg[pair.first])),
       oM2(toCoalTransform3s(geom_data.oMg[pair.second]));
 
@@ -105,6 +109,145 @@ namespace pinocchio
     return min_index;
   }
 
+  namespace details
+  {
+    ///
+    /// \brief Add to row the projection of the columns of data.J supporting joint_id on the given
+    /// spatial force, following the column walk of translateJointJacobian.
+    ///
+    template<
+      typename Scalar,
+      int Options,
+      template<typename, int> class JointCollectionTpl,
+      typename Vector6Like,
+      typename RowVectorLike>
+    void addJointJacobianProjection(
+      const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+      const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+      const JointIndex joint_id,
+      const Eigen::MatrixBase<Vector6Like> & force,
+      const Eigen::MatrixBase<RowVectorLike> & row)
+    {
+      if (joint_id == 0)
+        return;
+
+      RowVectorLike & row_ = row.const_cast_derived();
+
+      const bool is_joint_mimic = (model.mimic_joint_supports[joint_id].back() == joint_id);
+      const int joint_first_col = model.idx_vExtendeds[joint_id];
+      const int joint_last_col = model.idx_vExtendeds[joint_id] + model.nvExtendeds[joint_id] - 1;
+      const int colRef =
+        is_joint_mimic ? data.non_mimic_parents_fromRow[(size_t)joint_first_col] : joint_last_col;
+      const int colRefMimicPass =
+        is_joint_mimic ? joint_last_col : data.mimic_parents_fromRow[(size_t)joint_first_col];
+
+      for (Eigen::Index jExtended = colRef; jExtended >= 0;
+           jExtended = data.non_mimic_parents_fromRow[(size_t)jExtended])
+        row_(data.idx_vExtended_to_idx_v_fromRow[size_t(jExtended)]) +=
+          force.dot(data.J.col(jExtended));
+      // Add mimicking joint effect into mimicked column
+      for (Eigen::Index jExtended = colRefMimicPass; jExtended >= 0;
+           jExtended = data.mimic_parents_fromRow[(size_t)jExtended])
+        row_(data.idx_vExtended_to_idx_v_fromRow[size_t(jExtended)]) +=
+          force.dot(data.J.col(jExtended));
+    }
+
+    ///
+    /// \brief Fill row with the derivative of the distance of the collision pair pair_id, zero if
+    /// the pair is inactive.
+    ///
+    /// With n the normal of the pair and p1, p2 its nearest points, the derivative of the distance
+    /// is the power of the spatial force (n, p2 x n) on the world velocity of the second geometry
+    /// minus the one of (n, p1 x n) on the world velocity of the first geometry.
+    ///
+    template<
+      typename Scalar,
+      int Options,
+      template<typename, int> class JointCollectionTpl,
+      typename RowVectorLike>
+    void computeDistanceDerivatives(
+      const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+      const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+      const GeometryModel & geom_model,
+      const GeometryData & geom_data,
+      const PairIndex pair_id,
+      const Eigen::MatrixBase<RowVectorLike> & row)
+    {
+      typedef Eigen::Matrix<Scalar, 3, 1, Options> Vector3;
+      typedef Eigen::Matrix<Scalar, 6, 1, Options> Vector6;
+
+      RowVectorLike & row_ = row.const_cast_derived();
+      row_.setZero();
+
+      const CollisionPair & pair = geom_model.collisionPairs[pair_id];
+      const GeometryObject & geom_object1 = geom_model.geometryObjects[pair.first];
+      const GeometryObject & geom_object2 = geom_model.geometryObjects[pair.second];
+      if (
+        !geom_data.activeCollisionPairs[pair_id] || geom_object1.disableCollision
+        || geom_object2.disableCollision)
+        return;
+
+      const coal::DistanceResult & distance_result = geom_data.distanceResults[pair_id];
+      const Vector3 normal = distance_result.normal.template cast<Scalar>();
+      const Vector3 p1 = distance_result.nearest_points[0].template cast<Scalar>();
+      const Vector3 p2 = distance_result.nearest_points[1].template cast<Scalar>();
+
+      Vector6 force;
+      force << normal, p2.cross(normal);
+      addJointJacobianProjection(model, data, geom_object2.parentJoint, force, row_);
+      force << -normal, -p1.cross(normal);
+      addJointJacobianProjection(model, data, geom_object1.parentJoint, force, row_);
+    }
+  } // namespace details
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename MatrixType>
+  void computeDistancesDerivatives(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    const DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    const GeometryData & geom_data,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      distance_jacobian.rows(), Eigen::DenseIndex(geom_model.collisionPairs.size()));
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(distance_jacobian.cols(), model.nv);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.distanceResults.size(), geom_model.collisionPairs.size());
+
+    MatrixType & distance_jacobian_ = distance_jacobian.const_cast_derived();
+    for (std::size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+      details::computeDistanceDerivatives(
+        model, data, geom_model, geom_data, cp_index,
+        distance_jacobian_.row(Eigen::DenseIndex(cp_index)));
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivatives(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian)
+  {
+    assert(model.check(data) && "data is not consistent with model.");
+    computeJointJacobians(model, data, q);
+    updateGeometryPlacements(model, data, geom_model, geom_data);
+    const std::size_t min_index = computeDistances(geom_model, geom_data);
+    computeDistancesDerivatives(model, data, geom_model, geom_data, distance_jacobian);
+    return min_index;
+  }
+
 } // namespace pinocchio
 
 #ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
@@ -120,5 +263,31 @@ namespace pinocchio
     GeometryData &,
     const Eigen::MatrixBase<context::VectorXs> &);
 
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI void
+  computeDistancesDerivatives<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::MatrixXs>(
+    const Model &,
+    const Data &,
+    const GeometryModel &,
+    const GeometryData &,
+    const Eigen::MatrixBase<context::MatrixXs> &);
+
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI std::size_t
+  computeDistancesDerivatives<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs,
+    context::MatrixXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const Eigen::MatrixBase<context::MatrixXs> &);
+
 }
 #endif // ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
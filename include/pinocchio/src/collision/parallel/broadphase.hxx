@@ -15,6 +15,7 @@ namespace pinocchio
 {
 
   template<
+    typename Executor,
     typename BroadPhaseManagerDerived,
     typename Scalar,
     int Options,
@@ -22,7 +23,7 @@ namespace pinocchio
     typename ConfigVectorPool,
     typename CollisionVectorResult>
   void computeCollisionsInParallel(
-    const size_t num_threads,
+    ExecutorBase<Executor> & executor,
     BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
     const Eigen::MatrixBase<ConfigVectorPool> & q,
     const Eigen::MatrixBase<CollisionVectorResult> & res,
@@ -38,6 +39,7 @@ namespace pinocchio
     typedef typename Pool::BroadPhaseManager BroadPhaseManager;
     typedef typename Pool::BroadPhaseManagerVector BroadPhaseManagerVector;
 
+    const size_t num_threads = executor.numThreads();
     const ModelVector & models = pool.getModels();
     const Model & model_check = models[0];
     DataVector & datas = pool.getDatas();
@@ -49,82 +51,51 @@ namespace pinocchio
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.cols(), res.size());
     res_.fill(false);
 
-    setDefaultOpenMPSettings(num_threads);
-    const Eigen::Index batch_size = res.size();
+    std::atomic<bool> is_colliding(false);
+    executor.parallelFor(res.size(), [&](const size_t thread_id, const Eigen::Index i) {
+      if (stopAtFirstCollisionInBatch && is_colliding.load())
+        return;
 
-    typedef typename PINOCCHIO_EIGEN_PLAIN_TYPE(ConfigVectorPool) ConfigVectorPoolPlain;
-    std::vector<ConfigVectorPoolPlain> q_thread(num_threads, q);
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      BroadPhaseManager & manager = broadphase_managers[thread_id];
 
-    OpenMPException openmp_exception;
+      res_[i] =
+        computeCollisions(model, data, manager, q.col(i), stopAtFirstCollisionInConfiguration);
 
-    if (stopAtFirstCollisionInBatch)
-    {
-      bool is_colliding = false;
-      Eigen::Index i = 0;
-
-#pragma omp parallel for schedule(static)
-      for (i = 0; i < batch_size; i++)
-      {
-        if (is_colliding)
-          continue;
-
-        const int thread_id = omp_get_thread_num();
-
-        const Model & model = models[(size_t)thread_id];
-        Data & data = datas[(size_t)thread_id];
-        BroadPhaseManager & manager = broadphase_managers[(size_t)thread_id];
-        const ConfigVectorPoolPlain & q = q_thread[size_t(thread_id)];
-
-        openmp_exception.run([=, &is_colliding, &model, &data, &manager, &q, &res_] {
-          // lambda start corpus
-
-          res_[i] =
-            computeCollisions(model, data, manager, q.col(i), stopAtFirstCollisionInConfiguration);
-
-          if (res_[i])
-          {
-            is_colliding = true;
-          }
-          // lambda end corpus
-        });
-      }
-    }
-    else
-    {
-      Eigen::Index i = 0;
-#pragma omp parallel for schedule(static)
-      for (i = 0; i < batch_size; i++)
-      {
-        const int thread_id = omp_get_thread_num();
-
-        const Model & model = models[(size_t)thread_id];
-        Data & data = datas[(size_t)thread_id];
-        BroadPhaseManager & manager = broadphase_managers[(size_t)thread_id];
-        const ConfigVectorPoolPlain & q = q_thread[size_t(thread_id)];
-
-        openmp_exception.run([=, &model, &data, &manager, &q, &res_] {
-          // lambda start corpus
-          res_[i] =
-            computeCollisions(model, data, manager, q.col(i), stopAtFirstCollisionInConfiguration);
-          // lambda end corpus
-        });
-      }
-    }
+      if (res_[i])
+        is_colliding.store(true);
+    });
+  }
 
-    openmp_exception.rethrowException();
+  template<
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename CollisionVectorResult>
+  void computeCollisionsInParallel(
+    const size_t num_threads,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<CollisionVectorResult> & res,
+    const bool stopAtFirstCollisionInConfiguration,
+    const bool stopAtFirstCollisionInBatch)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    computeCollisionsInParallel(
+      executor, pool, q, res, stopAtFirstCollisionInConfiguration, stopAtFirstCollisionInBatch);
   }
 
-  ///
-  /// \brief Evaluate the collision over a set of trajectories and return whether a trajectory
-  /// contains a collision
-  ///
   template<
+    typename Executor,
     typename BroadPhaseManagerDerived,
     typename Scalar,
     int Options,
     template<typename, int> class JointCollectionTpl>
   void computeCollisionsInParallel(
-    const size_t num_threads,
+    ExecutorBase<Executor> & executor,
     BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
     const std::vector<Eigen::MatrixXd> & trajectories,
     std::vector<VectorXb> & res,
@@ -144,7 +115,7 @@ namespace pinocchio
     DataVector & datas = pool.getDatas();
     BroadPhaseManagerVector & broadphase_managers = pool.getBroadPhaseManagers();
 
-    PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads <= pool.size(), "The pool is too small");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(executor.numThreads() <= pool.size(), "The pool is too small");
     PINOCCHIO_CHECK_ARGUMENT_SIZE(trajectories.size(), res.size());
 
     for (size_t k = 0; k < trajectories.size(); ++k)
@@ -153,26 +124,15 @@ namespace pinocchio
       PINOCCHIO_CHECK_ARGUMENT_SIZE(trajectories[k].rows(), model_check.nq);
     }
 
-    setDefaultOpenMPSettings(num_threads);
-    const size_t batch_size = trajectories.size();
-
-    OpenMPException openmp_exception;
-
-    size_t i = 0;
-#pragma omp parallel for schedule(static)
-    for (i = 0; i < batch_size; i++)
-    {
-      const int thread_id = omp_get_thread_num();
-
-      const Model & model = models[size_t(thread_id)];
-      Data & data = datas[(size_t)thread_id];
-      const Eigen::MatrixXd & current_traj = trajectories[i];
-      VectorXb & res_current_traj = res[i];
-      res_current_traj.fill(false);
-      BroadPhaseManager & manager = broadphase_managers[size_t(thread_id)];
+    executor.parallelFor(
+      Eigen::Index(trajectories.size()), [&](const size_t thread_id, const Eigen::Index i) {
+        const Model & model = models[thread_id];
+        Data & data = datas[thread_id];
+        const Eigen::MatrixXd & current_traj = trajectories[size_t(i)];
+        VectorXb & res_current_traj = res[size_t(i)];
+        res_current_traj.fill(false);
+        BroadPhaseManager & manager = broadphase_managers[thread_id];
 
-      openmp_exception.run([=, &model, &data, &manager, &current_traj, &res_current_traj] {
-        // lambda start corpus
         for (Eigen::Index col_id = 0; col_id < current_traj.cols(); ++col_id)
         {
           res_current_traj[col_id] =
@@ -181,10 +141,111 @@ namespace pinocchio
           if (res_current_traj[col_id] && stopAtFirstCollisionInTrajectory)
             break;
         }
-        // lambda end corpus
       });
-    }
+  }
 
-    openmp_exception.rethrowException();
+  ///
+  /// \brief Evaluate the collision over a set of trajectories and return whether a trajectory
+  /// contains a collision
+  ///
+  template<
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl>
+  void computeCollisionsInParallel(
+    const size_t num_threads,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const std::vector<Eigen::MatrixXd> & trajectories,
+    std::vector<VectorXb> & res,
+    const bool stopAtFirstCollisionInTrajectory)
+  {
+    OpenMPExecutor executor(num_threads);
+    computeCollisionsInParallel(executor, pool, trajectories, res, stopAtFirstCollisionInTrajectory);
+  }
+
+  template<
+    typename Executor,
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigurationGenerator,
+    typename ResultCallback>
+  bool computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::Index num_configurations,
+    ConfigurationGenerator && configuration_generator,
+    ResultCallback && result_callback,
+    const bool stopAtFirstCollisionInConfiguration,
+    const bool stopAtFirstCollisionInBatch)
+  {
+    typedef BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl>
+      Pool;
+    typedef typename Pool::Model Model;
+    typedef typename Pool::Data Data;
+    typedef typename Pool::ModelVector ModelVector;
+    typedef typename Pool::DataVector DataVector;
+    typedef typename Pool::BroadPhaseManager BroadPhaseManager;
+    typedef typename Pool::BroadPhaseManagerVector BroadPhaseManagerVector;
+    typedef typename Model::ConfigVectorType ConfigVectorType;
+
+    const size_t num_threads = executor.numThreads();
+    const ModelVector & models = pool.getModels();
+    DataVector & datas = pool.getDatas();
+    BroadPhaseManagerVector & broadphase_managers = pool.getBroadPhaseManagers();
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads <= pool.size(), "The pool is too small");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      num_configurations >= 0, "The number of configurations should be non negative");
+
+    // One configuration buffer per thread, filled by the generator
+    std::vector<ConfigVectorType> q_thread(num_threads, ConfigVectorType(models[0].nq));
+
+    std::atomic<bool> is_colliding(false);
+    executor.parallelFor(num_configurations, [&](const size_t thread_id, const Eigen::Index i) {
+      if (stopAtFirstCollisionInBatch && is_colliding.load(std::memory_order_relaxed))
+        return;
+
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      BroadPhaseManager & manager = broadphase_managers[thread_id];
+      ConfigVectorType & q = q_thread[thread_id];
+
+      configuration_generator(i, q);
+      PINOCCHIO_CHECK_ARGUMENT_SIZE(q.size(), model.nq);
+
+      const bool res =
+        computeCollisions(model, data, manager, q, stopAtFirstCollisionInConfiguration);
+      if (res)
+        is_colliding.store(true, std::memory_order_relaxed);
+
+      result_callback(i, static_cast<const ConfigVectorType &>(q), res);
+    });
+
+    return is_colliding.load();
+  }
+
+  template<
+    typename BroadPhaseManagerDerived,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigurationGenerator,
+    typename ResultCallback>
+  bool computeCollisionsInParallel(
+    const size_t num_threads,
+    BroadPhaseManagerPoolBase<BroadPhaseManagerDerived, Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::Index num_configurations,
+    ConfigurationGenerator && configuration_generator,
+    ResultCallback && result_callback,
+    const bool stopAtFirstCollisionInConfiguration,
+    const bool stopAtFirstCollisionInBatch)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    return computeCollisionsInParallel(
+      executor, pool, num_configurations, configuration_generator, result_callback,
+      stopAtFirstCollisionInConfiguration, stopAtFirstCollisionInBatch);
   }
 } // namespace pinocchio
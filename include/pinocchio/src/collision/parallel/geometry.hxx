@@ -14,49 +14,76 @@
 namespace pinocchio
 {
 
-  inline bool computeCollisionsInParallel(
-    const size_t num_threads,
+  template<typename Executor>
+  bool computeCollisionsInParallel(
+    ExecutorBase<Executor> & executor,
     const GeometryModel & geom_model,
     GeometryData & geom_data,
     const bool stopAtFirstCollision)
   {
-    bool is_colliding = false;
+    const std::size_t num_pairs = geom_model.collisionPairs.size();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(geom_data.collisionResults.size(), num_pairs);
 
-    setDefaultOpenMPSettings(num_threads);
-    std::size_t cp_index = 0;
+    // Contiguous blocks of pairs, a few per thread to balance the uneven narrow phase costs
+    const std::size_t num_blocks = std::min(num_pairs, 8 * executor.numThreads());
+    if (num_blocks == 0)
+      return false;
+    const std::size_t block_size = (num_pairs + num_blocks - 1) / num_blocks;
 
-    OpenMPException openmp_exception;
+    // Index of the first colliding pair found so far, num_pairs if none
+    std::atomic<std::size_t> first_collision(num_pairs);
 
-#pragma omp parallel for schedule(dynamic)
-    for (cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
-    {
-      if (stopAtFirstCollision && is_colliding)
-        continue;
+    executor.parallelFor(Eigen::Index(num_blocks), [&](const size_t, const Eigen::Index block) {
+      const std::size_t block_begin = std::size_t(block) * block_size;
+      const std::size_t block_end = std::min(num_pairs, block_begin + block_size);
 
-      openmp_exception.run([=, &is_colliding, &geom_model, &geom_data] {
-        // lambda start corpus
-        const CollisionPair & collision_pair = geom_model.collisionPairs[cp_index];
+      for (std::size_t cp_index = block_begin; cp_index < block_end; ++cp_index)
+      {
+        // The pairs located after a colliding pair do not change the merged result
+        if (stopAtFirstCollision && cp_index > first_collision.load(std::memory_order_relaxed))
+          return;
 
+        const CollisionPair & collision_pair = geom_model.collisionPairs[cp_index];
         if (
-          geom_data.activeCollisionPairs[cp_index]
-          && !(
-            geom_model.geometryObjects[collision_pair.first].disableCollision
-            || geom_model.geometryObjects[collision_pair.second].disableCollision))
+          !geom_data.activeCollisionPairs[cp_index]
+          || geom_model.geometryObjects[collision_pair.first].disableCollision
+          || geom_model.geometryObjects[collision_pair.second].disableCollision)
+          continue;
+
+        if (computeCollision(geom_model, geom_data, cp_index))
         {
-          bool res = computeCollision(geom_model, geom_data, cp_index);
-          if (!is_colliding && res)
-          {
-            is_colliding = true;
-            geom_data.collisionPairIndex = cp_index; // first pair to be in collision
-          }
+          // Atomic min, the pairs of a block being visited in increasing order
+          std::size_t current = first_collision.load(std::memory_order_relaxed);
+          while (cp_index < current && !first_collision.compare_exchange_weak(current, cp_index))
+            continue;
+          if (stopAtFirstCollision)
+            return;
         }
-        // lambda end corpus
-      });
-    }
+      }
+    });
 
-    openmp_exception.rethrowException();
+    // Deterministic merge: every pair located before the first colliding one has been evaluated
+    const std::size_t first_collision_index = first_collision.load();
+    if (first_collision_index == num_pairs)
+      return false;
+
+    geom_data.collisionPairIndex = first_collision_index;
+    if (stopAtFirstCollision)
+    {
+      for (std::size_t cp_index = first_collision_index + 1; cp_index < num_pairs; ++cp_index)
+        geom_data.collisionResults[cp_index].clear();
+    }
+    return true;
+  }
 
-    return is_colliding;
+  inline bool computeCollisionsInParallel(
+    const size_t num_threads,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const bool stopAtFirstCollision)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    return computeCollisionsInParallel(executor, geom_model, geom_data, stopAtFirstCollision);
   }
 
   template<
@@ -78,13 +105,14 @@ namespace pinocchio
   }
 
   template<
+    typename Executor,
     typename Scalar,
     int Options,
     template<typename, int> class JointCollectionTpl,
     typename ConfigVectorPool,
     typename CollisionVectorResult>
   void computeCollisionsInParallel(
-    const size_t num_threads,
+    ExecutorBase<Executor> & executor,
     GeometryPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
     const Eigen::MatrixBase<ConfigVectorPool> & q,
     const Eigen::MatrixBase<CollisionVectorResult> & res,
@@ -101,6 +129,7 @@ namespace pinocchio
     typedef typename Pool::GeometryModelVector GeometryModelVector;
     typedef typename Pool::GeometryDataVector GeometryDataVector;
 
+    const size_t num_threads = executor.numThreads();
     PINOCCHIO_CHECK_INPUT_ARGUMENT(pool.size() > 0, "The pool should have at least one element");
     PINOCCHIO_CHECK_INPUT_ARGUMENT(num_threads <= pool.size(), "The pool is too small");
 
@@ -115,73 +144,118 @@ namespace pinocchio
     PINOCCHIO_CHECK_ARGUMENT_SIZE(q.cols(), res.size());
     res_.fill(false);
 
-    setDefaultOpenMPSettings(num_threads);
-    const Eigen::Index batch_size = res.size();
+    // TODO(jcarpent): set one res_ per thread to enhance efficiency
+    std::atomic<bool> is_colliding(false);
+    executor.parallelFor(res.size(), [&](const size_t thread_id, const Eigen::Index i) {
+      if (stopAtFirstCollisionInBatch && is_colliding.load())
+        return;
 
-    typedef typename PINOCCHIO_EIGEN_PLAIN_TYPE(ConfigVectorPool) ConfigVectorPoolPlain;
-    std::vector<ConfigVectorPoolPlain> q_thread(num_threads, q);
+      const Model & model = models[thread_id];
+      Data & data = datas[thread_id];
+      const GeometryModel & geometry_model = geometry_models[thread_id];
+      GeometryData & geometry_data = geometry_datas[thread_id];
 
-    OpenMPException openmp_exception;
+      res_[i] = computeCollisions(
+        model, data, geometry_model, geometry_data, q.col(i), stopAtFirstCollisionInConfiguration);
 
-    // TODO(jcarpent): set one res_ per thread to enhance efficiency
-    if (stopAtFirstCollisionInBatch)
-    {
-      bool is_colliding = false;
-      Eigen::Index i = 0;
-#pragma omp parallel for schedule(static)
-      for (i = 0; i < batch_size; i++)
-      {
-        if (is_colliding)
-          continue;
+      if (res_[i])
+        is_colliding.store(true);
+    });
+  }
 
-        const int thread_id = omp_get_thread_num();
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorPool,
+    typename CollisionVectorResult>
+  void computeCollisionsInParallel(
+    const size_t num_threads,
+    GeometryPoolTpl<Scalar, Options, JointCollectionTpl> & pool,
+    const Eigen::MatrixBase<ConfigVectorPool> & q,
+    const Eigen::MatrixBase<CollisionVectorResult> & res,
+    const bool stopAtFirstCollisionInConfiguration,
+    const bool stopAtFirstCollisionInBatch)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    computeCollisionsInParallel(
+      executor, pool, q, res, stopAtFirstCollisionInConfiguration, stopAtFirstCollisionInBatch);
+  }
 
-        const Model & model = models[size_t(thread_id)];
-        Data & data = datas[size_t(thread_id)];
-        const GeometryModel & geometry_model = geometry_models[size_t(thread_id)];
-        GeometryData & geometry_data = geometry_datas[size_t(thread_id)];
-        const ConfigVectorPoolPlain & q = q_thread[size_t(thread_id)];
+  template<
+    typename Executor,
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivativesInParallel(
+    ExecutorBase<Executor> & executor,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian)
+  {
+    const std::size_t num_pairs = geom_model.collisionPairs.size();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(geom_data.distanceResults.size(), num_pairs);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(distance_jacobian.rows(), Eigen::DenseIndex(num_pairs));
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(distance_jacobian.cols(), model.nv);
 
-        openmp_exception.run(
-          [=, &is_colliding, &model, &data, &geometry_model, &geometry_data, &q, &res_] {
-            // lambda start corpus
+    // The Jacobians are shared by all the pairs
+    computeJointJacobians(model, data, q);
+    updateGeometryPlacements(model, data, geom_model, geom_data);
 
-            res_[i] = computeCollisions(
-              model, data, geometry_model, geometry_data, q.col(i),
-              stopAtFirstCollisionInConfiguration);
+    MatrixType & distance_jacobian_ = distance_jacobian.const_cast_derived();
+    executor.parallelFor(Eigen::Index(num_pairs), [&](const size_t, const Eigen::Index i) {
+      const std::size_t cp_index = std::size_t(i);
+      const CollisionPair & collision_pair = geom_model.collisionPairs[cp_index];
+      if (
+        geom_data.activeCollisionPairs[cp_index]
+        && !geom_model.geometryObjects[collision_pair.first].disableCollision
+        && !geom_model.geometryObjects[collision_pair.second].disableCollision)
+        computeDistance(geom_model, geom_data, cp_index);
+      details::computeDistanceDerivatives(
+        model, data, geom_model, geom_data, cp_index, distance_jacobian_.row(i));
+    });
 
-            if (res_[i])
-            {
-              is_colliding = true;
-            }
-            // lambda end corpus
-          });
-      }
-    }
-    else
+    // Same selection of the minimal distance as computeDistances
+    std::size_t min_index = num_pairs;
+    double min_dist = std::numeric_limits<double>::infinity();
+    for (std::size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
     {
-      Eigen::Index i = 0;
-#pragma omp parallel for schedule(static)
-      for (i = 0; i < batch_size; i++)
+      const CollisionPair & collision_pair = geom_model.collisionPairs[cp_index];
+      if (
+        geom_data.activeCollisionPairs[cp_index]
+        && !geom_model.geometryObjects[collision_pair.first].disableCollision
+        && !geom_model.geometryObjects[collision_pair.second].disableCollision
+        && geom_data.distanceResults[cp_index].min_distance < min_dist)
       {
-        const int thread_id = omp_get_thread_num();
-
-        const Model & model = models[(size_t)thread_id];
-        Data & data = datas[(size_t)thread_id];
-        const GeometryModel & geometry_model = geometry_models[(size_t)thread_id];
-        GeometryData & geometry_data = geometry_datas[(size_t)thread_id];
-        const ConfigVectorPoolPlain & q = q_thread[size_t(thread_id)];
-
-        openmp_exception.run([=, &model, &data, &geometry_model, &geometry_data, &q, &res_] {
-          // lambda start corpus
-          res_[i] = computeCollisions(
-            model, data, geometry_model, geometry_data, q.col(i),
-            stopAtFirstCollisionInConfiguration);
-          // lambda end corpus
-        });
+        min_index = cp_index;
+        min_dist = geom_data.distanceResults[cp_index].min_distance;
       }
     }
+    return min_index;
+  }
 
-    openmp_exception.rethrowException();
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType,
+    typename MatrixType>
+  std::size_t computeDistancesDerivativesInParallel(
+    const size_t num_threads,
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const Eigen::MatrixBase<MatrixType> & distance_jacobian)
+  {
+    OpenMPExecutor executor(num_threads, true);
+    return computeDistancesDerivativesInParallel(
+      executor, model, data, geom_model, geom_data, q, distance_jacobian);
   }
 } // namespace pinocchio
@@ -0,0 +1,157 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/collision/signed-distance-field.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/collision/signed-distance-field.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+
+  inline SignedDistanceField computeSignedDistanceField(
+    const coal::CollisionGeometry & geometry, const double resolution, const double padding)
+  {
+    typedef SignedDistanceField::Scalar Scalar;
+    typedef SignedDistanceField::Vector3 Vector3;
+    typedef SignedDistanceField::Index3 Index3;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(resolution > 0., "The resolution should be positive.");
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(padding >= 0., "The padding should be non negative.");
+
+    const_cast<coal::CollisionGeometry &>(geometry).computeLocalAABB();
+    const coal::AABB & aabb = geometry.aabb_local;
+    const Vector3 lower = (aabb.min_.array() - padding).matrix();
+    const Vector3 extent = (aabb.max_ - aabb.min_).array() + 2. * padding;
+
+    Index3 sizes;
+    for (int axis = 0; axis < 3; ++axis)
+      sizes[axis] =
+        (std::max)(Eigen::Index(2), Eigen::Index(std::ceil(extent[axis] / resolution)) + 1);
+
+    SignedDistanceField field(lower, Scalar(resolution), sizes);
+
+    // Distance between the geometry and a sphere of zero radius located at each node
+    const coal::Sphere node_shape(0.);
+    const coal::Transform3s geometry_placement(coal::Transform3s::Identity());
+    coal::Transform3s node_placement(coal::Transform3s::Identity());
+    const coal::DistanceRequest distance_request;
+    coal::DistanceResult distance_result;
+    for (Eigen::Index k = 0; k < sizes[2]; ++k)
+    {
+      for (Eigen::Index j = 0; j < sizes[1]; ++j)
+      {
+        for (Eigen::Index i = 0; i < sizes[0]; ++i)
+        {
+          node_placement.setTranslation(field.nodePosition(i, j, k));
+          distance_result.clear();
+          field.value(i, j, k) = coal::distance(
+            &geometry, geometry_placement, &node_shape, node_placement, distance_request,
+            distance_result);
+        }
+      }
+    }
+
+    return field;
+  }
+
+  namespace details
+  {
+    ///
+    /// \brief Compute the distance of a collision pair from the signed distance field of one of
+    /// its geometries, when the other one is a sphere or a capsule.
+    ///
+    /// The axis of a capsule is sampled at the resolution of the field. The nearest points and
+    /// the normal follow the conventions of coal, the normal being the gradient of the distance
+    /// with respect to the position of the second geometry.
+    ///
+    /// \returns false if the collision pair cannot be handled by a signed distance field, in
+    /// which case distance_result is left untouched.
+    ///
+    inline bool computeDistanceFromSignedDistanceField(
+      const GeometryModel & geom_model,
+      const GeometryData & geom_data,
+      const PairIndex pair_id,
+      coal::DistanceResult & distance_result)
+    {
+      typedef SignedDistanceField::Scalar Scalar;
+      typedef SignedDistanceField::Vector3 Vector3;
+      typedef GeometryObject::SE3 SE3;
+
+      const CollisionPair & pair = geom_model.collisionPairs[pair_id];
+      const GeometryObject & geom_object1 = geom_model.geometryObjects[pair.first];
+      const GeometryObject & geom_object2 = geom_model.geometryObjects[pair.second];
+
+      // Exactly one of the geometries should have a signed distance field
+      const bool field_is_first = geom_object1.distanceField != nullptr;
+      if (field_is_first == (geom_object2.distanceField != nullptr))
+        return false;
+
+      const GeomIndex field_id = field_is_first ? pair.first : pair.second;
+      const GeomIndex shape_id = field_is_first ? pair.second : pair.first;
+      const SignedDistanceField & field = *geom_model.geometryObjects[field_id].distanceField;
+      const coal::CollisionGeometry & shape = *geom_model.geometryObjects[shape_id].geometry;
+
+      Scalar radius, half_length;
+      switch (shape.getNodeType())
+      {
+      case coal::GEOM_SPHERE:
+        radius = static_cast<const coal::Sphere &>(shape).radius;
+        half_length = Scalar(0);
+        break;
+      case coal::GEOM_CAPSULE:
+        radius = static_cast<const coal::Capsule &>(shape).radius;
+        half_length = static_cast<const coal::Capsule &>(shape).halfLength;
+        break;
+      default:
+        return false;
+      }
+
+      // Point of the axis of the shape closest to the static geometry, in the frame of the field
+      const SE3 & oMfield = geom_data.oMg[field_id];
+      const SE3 fieldMshape = oMfield.actInv(geom_data.oMg[shape_id]);
+      const Eigen::Index num_samples =
+        half_length > Scalar(0) ? Eigen::Index(std::ceil(2 * half_length / field.resolution)) + 1
+                                : 1;
+      Scalar min_value = std::numeric_limits<Scalar>::infinity();
+      Vector3 axis_point, gradient, sample_gradient;
+      for (Eigen::Index s = 0; s < num_samples; ++s)
+      {
+        const Scalar z = num_samples == 1
+                           ? Scalar(0)
+                           : half_length * (Scalar(2 * s) / Scalar(num_samples - 1) - Scalar(1));
+        const Vector3 sample = fieldMshape.translation() + z * fieldMshape.rotation().col(2);
+        const Scalar value = field.evaluate(sample, sample_gradient);
+        if (value < min_value)
+        {
+          min_value = value;
+          axis_point = sample;
+          gradient = sample_gradient;
+        }
+      }
+
+      const Scalar gradient_norm = gradient.norm();
+      const Vector3 normal =
+        gradient_norm > Scalar(0) ? Vector3(gradient / gradient_norm) : Vector3(Vector3::UnitZ());
+      const Vector3 world_normal = oMfield.rotation() * normal;
+      const Vector3 field_point = oMfield.act(Vector3(axis_point - min_value * normal));
+      const Vector3 shape_point = oMfield.act(Vector3(axis_point - radius * normal));
+
+      distance_result.min_distance = min_value - radius;
+      distance_result.o1 = geom_object1.geometry.get();
+      distance_result.o2 = geom_object2.geometry.get();
+      distance_result.b1 = coal::DistanceResult::NONE;
+      distance_result.b2 = coal::DistanceResult::NONE;
+      distance_result.nearest_points[0] = field_is_first ? field_point : shape_point;
+      distance_result.nearest_points[1] = field_is_first ? shape_point : field_point;
+      distance_result.normal = field_is_first ? world_normal : Vector3(-world_normal);
+      return true;
+    }
+  } // namespace details
+
+} // namespace pinocchio
@@ -0,0 +1,298 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/collision/sphere-tree.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/collision/sphere-tree.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+
+  inline SphereTree
+  computeSphereTree(const coal::CollisionGeometry & geometry, const std::size_t num_levels)
+  {
+    typedef SphereTree::Scalar Scalar;
+    typedef Eigen::Matrix<Scalar, 3, 1> Vector3;
+    typedef Eigen::Matrix<Eigen::Index, 3, 1> Index3;
+
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(num_levels > 0, "The number of levels should be positive.");
+
+    SphereTree tree;
+    const_cast<coal::CollisionGeometry &>(geometry).computeLocalAABB();
+    const coal::AABB & aabb = geometry.aabb_local;
+    if (!aabb.min_.allFinite() || !aabb.max_.allFinite())
+      return tree;
+
+    const Vector3 lower = aabb.min_;
+    const Vector3 size = aabb.max_ - aabb.min_;
+
+    coal::CollisionRequest collision_request;
+    coal::CollisionResult collision_result;
+    const coal::Transform3s geometry_placement(coal::Transform3s::Identity());
+    coal::Transform3s cell_placement(coal::Transform3s::Identity());
+
+    // Cells of the current level, given by their integer coordinates in the subdivision
+    std::vector<Index3> cells(1, Index3::Zero()), next_cells;
+    for (std::size_t level = 0; level < num_levels; ++level)
+    {
+      const Vector3 cell_size = size / Scalar(Eigen::Index(1) << level);
+      const Eigen::Index num_cells = Eigen::Index(cells.size());
+
+      SphereTree::Matrix3Xs centers(3, num_cells);
+      for (Eigen::Index k = 0; k < num_cells; ++k)
+        centers.col(k) =
+          lower
+          + (cells[size_t(k)].cast<Scalar>().array() + Scalar(0.5)).matrix().cwiseProduct(
+            cell_size);
+      tree.centers.push_back(centers);
+      tree.radii.push_back(
+        SphereTree::VectorXs::Constant(num_cells, Scalar(0.5) * cell_size.norm()));
+
+      if (level + 1 == num_levels)
+        break;
+
+      // Children cells intersecting the geometry, with a margin avoiding to miss the parts of the
+      // geometry lying on the boundary of two cells.
+      const Vector3 child_size = Scalar(0.5) * cell_size;
+      const coal::Box child_box(child_size);
+      collision_request.security_margin = Scalar(1e-6) * child_size.norm();
+
+      SphereTree::IndexVector children(num_cells + 1);
+      next_cells.clear();
+      for (Eigen::Index k = 0; k < num_cells; ++k)
+      {
+        children[k] = Eigen::Index(next_cells.size());
+        for (int octant = 0; octant < 8; ++octant)
+        {
+          const Index3 child = Eigen::Index(2) * cells[size_t(k)]
+                               + Index3(
+                                 Eigen::Index(octant & 1), Eigen::Index((octant >> 1) & 1),
+                                 Eigen::Index((octant >> 2) & 1));
+          cell_placement.setTranslation(
+            lower
+            + (child.cast<Scalar>().array() + Scalar(0.5)).matrix().cwiseProduct(child_size));
+          collision_result.clear();
+          if (coal::collide(
+                &child_box, cell_placement, &geometry, geometry_placement, collision_request,
+                collision_result))
+            next_cells.push_back(child);
+        }
+      }
+      children[num_cells] = Eigen::Index(next_cells.size());
+      tree.children.push_back(children);
+      cells.swap(next_cells);
+    }
+
+    return tree;
+  }
+
+  inline SphereTreeModel
+  buildSphereTreeModel(const GeometryModel & geom_model, const std::size_t num_levels)
+  {
+    SphereTreeModel sphere_tree_model;
+    sphere_tree_model.trees.resize(geom_model.ngeoms);
+    for (GeomIndex geom_id = 0; geom_id < geom_model.ngeoms; ++geom_id)
+    {
+      const GeometryObject & geom_object = geom_model.geometryObjects[geom_id];
+      if (geom_object.geometry)
+        sphere_tree_model.trees[geom_id] = computeSphereTree(*geom_object.geometry, num_levels);
+    }
+    return sphere_tree_model;
+  }
+
+  inline void updateSphereTreePlacements(
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const GeometryData & geom_data)
+  {
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      sphere_tree_data.oCenters.size(), sphere_tree_model.trees.size(),
+      "The sphere tree data is not consistent with the sphere tree model.");
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      geom_data.oMg.size(), sphere_tree_model.trees.size(),
+      "The sphere tree model is not consistent with the geometry data.");
+
+    for (std::size_t geom_id = 0; geom_id < sphere_tree_model.trees.size(); ++geom_id)
+    {
+      const SphereTree & tree = sphere_tree_model.trees[geom_id];
+      const GeometryData::SE3 & oMg = geom_data.oMg[geom_id];
+      for (std::size_t level = 0; level < tree.numLevels(); ++level)
+      {
+        SphereTree::Matrix3Xs & oCenters = sphere_tree_data.oCenters[geom_id][level];
+        oCenters.noalias() = oMg.rotation() * tree.centers[level];
+        oCenters.colwise() += oMg.translation();
+      }
+    }
+  }
+
+  inline bool computeSphereTreeCollision(
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const GeomIndex geom_id1,
+    const GeomIndex geom_id2,
+    const SphereTree::Scalar security_margin)
+  {
+    typedef SphereTree::Scalar Scalar;
+    typedef std::array<Eigen::Index, 4> SpherePair;
+
+    const SphereTree & tree1 = sphere_tree_model.trees[geom_id1];
+    const SphereTree & tree2 = sphere_tree_model.trees[geom_id2];
+    if (tree1.numLevels() == 0 || tree2.numLevels() == 0)
+      return true;
+
+    const std::vector<SphereTree::Matrix3Xs> & oCenters1 = sphere_tree_data.oCenters[geom_id1];
+    const std::vector<SphereTree::Matrix3Xs> & oCenters2 = sphere_tree_data.oCenters[geom_id2];
+    const Eigen::Index last_level1 = Eigen::Index(tree1.numLevels()) - 1;
+    const Eigen::Index last_level2 = Eigen::Index(tree2.numLevels()) - 1;
+
+    const auto overlap = [&](const SpherePair & pair) {
+      const Scalar bound = tree1.radii[size_t(pair[0])][pair[1]]
+                           + tree2.radii[size_t(pair[2])][pair[3]] + security_margin;
+      const auto center1 = oCenters1[size_t(pair[0])].col(pair[1]);
+      const auto center2 = oCenters2[size_t(pair[2])].col(pair[3]);
+      return bound >= Scalar(0) && (center1 - center2).squaredNorm() <= bound * bound;
+    };
+
+    std::vector<SpherePair> & stack = sphere_tree_data.stack;
+    stack.clear();
+    const SpherePair roots = {{0, 0, 0, 0}};
+    if (overlap(roots))
+      stack.push_back(roots);
+
+    while (!stack.empty())
+    {
+      const SpherePair pair = stack.back();
+      stack.pop_back();
+
+      const bool is_leaf1 = pair[0] == last_level1, is_leaf2 = pair[2] == last_level2;
+      if (is_leaf1 && is_leaf2)
+        return true;
+
+      // Refine the largest sphere which is not a leaf
+      const Scalar radius1 = tree1.radii[size_t(pair[0])][pair[1]];
+      const Scalar radius2 = tree2.radii[size_t(pair[2])][pair[3]];
+      const bool refine_first = is_leaf2 || (!is_leaf1 && radius1 >= radius2);
+      const SphereTree & tree = refine_first ? tree1 : tree2;
+      const Eigen::Index level = refine_first ? pair[0] : pair[2];
+      const Eigen::Index index = refine_first ? pair[1] : pair[3];
+      const SphereTree::IndexVector & children = tree.children[size_t(level)];
+      for (Eigen::Index child = children[index]; child < children[index + 1]; ++child)
+      {
+        const SpherePair child_pair =
+          refine_first ? SpherePair{{level + 1, child, pair[2], pair[3]}}
+                       : SpherePair{{pair[0], pair[1], level + 1, child}};
+        if (overlap(child_pair))
+          stack.push_back(child_pair);
+      }
+    }
+
+    return false;
+  }
+
+  inline bool computeCollisionsWithSphereTrees(
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const bool stopAtFirstCollision,
+    const bool refineWithNarrowPhase)
+  {
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      sphere_tree_model.trees.size(), geom_model.ngeoms,
+      "The sphere tree model is not consistent with the geometry model.");
+
+    updateSphereTreePlacements(sphere_tree_model, sphere_tree_data, geom_data);
+
+    bool isColliding = false;
+    for (std::size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+    {
+      const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+      if (
+        !geom_data.activeCollisionPairs[cp_index]
+        || geom_model.geometryObjects[cp.first].disableCollision
+        || geom_model.geometryObjects[cp.second].disableCollision)
+        continue;
+
+      bool res;
+      if (!computeSphereTreeCollision(
+            sphere_tree_model, sphere_tree_data, cp.first, cp.second,
+            geom_data.collisionRequests[cp_index].security_margin))
+      {
+        geom_data.collisionResults[cp_index].clear();
+        res = false;
+      }
+      else if (refineWithNarrowPhase)
+      {
+        res = computeCollision(geom_model, geom_data, cp_index);
+      }
+      else
+      {
+        geom_data.collisionResults[cp_index].clear();
+        res = true;
+      }
+
+      if (!isColliding && res)
+      {
+        isColliding = true;
+        geom_data.collisionPairIndex = cp_index; // first pair to be in collision
+        if (stopAtFirstCollision)
+          return true;
+      }
+    }
+
+    return isColliding;
+  }
+
+  template<
+    typename Scalar,
+    int Options,
+    template<typename, int> class JointCollectionTpl,
+    typename ConfigVectorType>
+  bool computeCollisionsWithSphereTrees(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    DataTpl<Scalar, Options, JointCollectionTpl> & data,
+    const GeometryModel & geom_model,
+    GeometryData & geom_data,
+    const SphereTreeModel & sphere_tree_model,
+    SphereTreeData & sphere_tree_data,
+    const Eigen::MatrixBase<ConfigVectorType> & q,
+    const bool stopAtFirstCollision,
+    const bool refineWithNarrowPhase)
+  {
+    updateGeometryPlacements(model, data, geom_model, geom_data, q);
+    return computeCollisionsWithSphereTrees(
+      geom_model, geom_data, sphere_tree_model, sphere_tree_data, stopAtFirstCollision,
+      refineWithNarrowPhase);
+  }
+
+} // namespace pinocchio
+
+#ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
+
+namespace pinocchio
+{
+
+  extern template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI bool
+  computeCollisionsWithSphereTrees<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const SphereTreeModel &,
+    SphereTreeData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const bool,
+    const bool);
+
+} // namespace pinocchio
+#endif // ifdef PINOCCHIO_ENABLE_TEMPLATE_INSTANTIATION
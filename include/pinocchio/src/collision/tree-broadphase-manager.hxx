@@ -148,6 +148,7 @@ namespace pinocchio
     {
       manager.update(compute_local_aabb);
     }
+    last_q.resize(0);
   }
 
   template<typename Manager>
@@ -157,6 +158,56 @@ namespace pinocchio
     {
       manager.update(geom_data_ptr_new);
     }
+    last_q.resize(0);
+  }
+
+  template<typename Manager>
+  template<typename ConfigVectorLike>
+  void TreeBroadPhaseManagerTpl<Manager>::update(
+    const Eigen::MatrixBase<ConfigVectorLike> & q, bool compute_local_aabb)
+  {
+    const Model & model = getModel();
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      q.size(), model.nq, "The configuration vector is not of right size");
+
+    const size_t num_joints = managers.size();
+    if (last_q.size() != model.nq)
+    {
+      update(compute_local_aabb);
+      std::fill(joint_is_dirty.begin(), joint_is_dirty.end(), true);
+      last_q = q;
+      return;
+    }
+
+    // Joints whose own configuration has changed
+    joint_is_dirty[0] = false;
+    for (size_t joint_id = 1; joint_id < num_joints; ++joint_id)
+    {
+      const int idx_q = model.idx_qs[joint_id];
+      const int nq = model.nqs[joint_id];
+      joint_is_dirty[joint_id] = q.segment(idx_q, nq) != last_q.segment(idx_q, nq);
+    }
+
+    // Mimic joints move with the joints they mimic
+    for (size_t k = 0; k < model.mimicking_joints.size(); ++k)
+    {
+      if (joint_is_dirty[model.mimicked_joints[k]])
+        joint_is_dirty[model.mimicking_joints[k]] = true;
+    }
+
+    // A joint moves with its parent, which always comes first in the kinematic tree
+    for (size_t joint_id = 1; joint_id < num_joints; ++joint_id)
+    {
+      if (joint_is_dirty[model.parents[joint_id]])
+        joint_is_dirty[joint_id] = true;
+    }
+
+    for (size_t joint_id = 1; joint_id < num_joints; ++joint_id)
+    {
+      if (joint_is_dirty[joint_id])
+        managers[joint_id].update(compute_local_aabb);
+    }
+    last_q = q;
   }
 
   template<typename Manager>
@@ -187,6 +238,7 @@ namespace pinocchio
   void TreeBroadPhaseManagerTpl<Manager>::init(const size_t njoints)
   {
     managers.reserve(njoints);
+    joint_is_dirty.assign(njoints, true);
     for (size_t joint_id = 0; joint_id < njoints; ++joint_id)
     {
       GeometryObjectFilterSelectByJoint filter(joint_id);
@@ -191,13 +191,14 @@ namespace pinocchio
 
       /// \brief Reserve some place if the capacity is not enough.
       ///
-      /// \remarks This is not data conservative
+      /// \remarks The current values are kept, so that the storage can be reserved at any time
+      /// before entering a section where no memory allocation should happen.
       void reserve(const Index rows, const Index cols)
       {
         const Index new_size = rows * cols;
         if (new_size > capacity())
         {
-          m_storage.resize(new_size);
+          m_storage.conservativeResize(new_size);
           new (&m_map) MapType(m_storage.data(), m_map.rows(), m_map.cols());
           new (&m_const_map) MapType(m_storage.data(), m_map.rows(), m_map.cols());
         }
@@ -208,7 +209,7 @@ namespace pinocchio
         EIGEN_STATIC_ASSERT_VECTOR_ONLY(MatrixLike)
         if (new_size > capacity())
         {
-          m_storage.resize(new_size);
+          m_storage.conservativeResize(new_size);
           new (&m_map) MapType(m_storage.data(), m_map.size());
           new (&m_const_map) MapType(m_storage.data(), m_map.size());
         }
@@ -236,6 +237,13 @@ namespace pinocchio
       void conservativeResize(const Index new_size)
       {
         EIGEN_STATIC_ASSERT_VECTOR_ONLY(MatrixLike)
+        if (new_size <= capacity())
+        {
+          // the values are already in place: no copy nor memory allocation is needed.
+          this->resize(new_size);
+          return;
+        }
+
         const Index old_size = this->size();
         const PlainMatrixType copy(map()); // save current value in the storage
         this->resize(new_size);
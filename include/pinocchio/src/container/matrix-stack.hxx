@@ -240,6 +240,7 @@ namespace pinocchio
       ///
       MatrixStackTpl(const MatrixStackTpl & other)
       : m_data_ptr(nullptr)
+      , m_memory_capacity(0)
       {
         *this = other;
       }
@@ -287,27 +288,21 @@ namespace pinocchio
         if (this == &other)
           return *this;
 
-        free(m_data_ptr);
-
-        m_memory_capacity = other.raw_size();
+        const std::size_t memory_size = other.raw_size();
 
-        if (m_memory_capacity > 0)
+        if (memory_size > 0)
         {
-          m_data_ptr = MatrixStackTpl::malloc(m_memory_capacity);
+          // The current memory is reused when large enough.
+          malloc_if_needed(memory_size);
           if (m_data_ptr == nullptr)
           {
-            m_memory_capacity = 0;
             m_matrix_maps.clear();
             m_offsets.clear();
             return *this;
           }
 
           // Copy raw data
-          std::memcpy(m_data_ptr, other.m_data_ptr, m_memory_capacity);
-        }
-        else
-        {
-          m_data_ptr = nullptr;
+          std::memcpy(m_data_ptr, other.m_data_ptr, memory_size);
         }
 
         // Add aligned map
@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/geometry.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/geometry.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  ///
+  /// \brief Collision pairs of a geometry model which can never be in collision within the joint
+  /// limits of the kinematic model, as computed by computeCollisionPairPruning.
+  ///
+  /// The cache can be saved and loaded (see serialization::Serializable), so that a new process
+  /// prunes the collision pairs without running the analysis again. It records the joint limits
+  /// and the geometry names it has been computed for, which are checked when it is applied.
+  ///
+  struct CollisionPairPruningCache : serialization::Serializable<CollisionPairPruningCache>
+  {
+    typedef double Scalar;
+    typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorXs;
+    typedef std::vector<CollisionPair> CollisionPairVector;
+
+    CollisionPairPruningCache()
+    : security_margin(Scalar(0))
+    {
+    }
+
+    ///
+    /// \brief Check whether the cache has been computed for the given models, i.e. for the same
+    /// joint limits and the same geometries.
+    ///
+    template<typename S, int O, template<typename, int> class JointCollectionTpl>
+    bool check(
+      const ModelTpl<S, O, JointCollectionTpl> & model, const GeometryModel & geom_model) const;
+
+    ///
+    /// \brief Returns true if *this and other are equal.
+    ///
+    bool operator==(const CollisionPairPruningCache & other) const
+    {
+      return lowerPositionLimit.size() == other.lowerPositionLimit.size()
+             && upperPositionLimit.size() == other.upperPositionLimit.size()
+             && lowerPositionLimit == other.lowerPositionLimit
+             && upperPositionLimit == other.upperPositionLimit
+             && geometry_names == other.geometry_names && security_margin == other.security_margin
+             && pruned_pairs == other.pruned_pairs;
+    }
+
+    ///
+    /// \brief Returns true if *this and other are not equal.
+    ///
+    bool operator!=(const CollisionPairPruningCache & other) const
+    {
+      return !(*this == other);
+    }
+
+    /// \brief Lower joint limits of the model the cache has been computed for.
+    VectorXs lowerPositionLimit;
+
+    /// \brief Upper joint limits of the model the cache has been computed for.
+    VectorXs upperPositionLimit;
+
+    /// \brief Names of the geometries of the geometry model the cache has been computed for.
+    std::vector<std::string> geometry_names;
+
+    /// \brief Minimal distance between the geometries of the pruned pairs.
+    Scalar security_margin;
+
+    /// \brief Collision pairs which can never be in collision within the joint limits.
+    CollisionPairVector pruned_pairs;
+  }; // struct CollisionPairPruningCache
+
+  ///
+  /// \brief Remove from the geometry model the collision pairs pruned by the cache, the order of
+  /// the remaining collision pairs being kept.
+  ///
+  /// \param[in] model Kinematic model the cache has been computed for.
+  /// \param[in,out] geom_model Geometry model the cache has been computed for.
+  /// \param[in] cache Cache computed by computeCollisionPairPruning.
+  ///
+  /// \throws std::invalid_argument if the cache has not been computed for model and geom_model.
+  ///
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  void removeCollisionPairs(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    GeometryModel & geom_model,
+    const CollisionPairPruningCache & cache);
+
+  template<typename S, int O, template<typename, int> class JointCollectionTpl>
+  bool CollisionPairPruningCache::check(
+    const ModelTpl<S, O, JointCollectionTpl> & model, const GeometryModel & geom_model) const
+  {
+    if (
+      lowerPositionLimit.size() != model.nq || upperPositionLimit.size() != model.nq
+      || geometry_names.size() != geom_model.ngeoms)
+      return false;
+
+    if (
+      lowerPositionLimit != model.lowerPositionLimit.template cast<Scalar>()
+      || upperPositionLimit != model.upperPositionLimit.template cast<Scalar>())
+      return false;
+
+    for (GeomIndex geom_id = 0; geom_id < geom_model.ngeoms; ++geom_id)
+    {
+      if (geometry_names[geom_id] != geom_model.geometryObjects[geom_id].name)
+        return false;
+    }
+    return true;
+  }
+
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  void removeCollisionPairs(
+    const ModelTpl<Scalar, Options, JointCollectionTpl> & model,
+    GeometryModel & geom_model,
+    const CollisionPairPruningCache & cache)
+  {
+    PINOCCHIO_CHECK_INPUT_ARGUMENT(
+      cache.check(model, geom_model),
+      "The cache has not been computed for the given model and geometry model.");
+
+    const Eigen::Index ngeoms = Eigen::Index(geom_model.ngeoms);
+    GeometryModel::MatrixXb is_pruned = GeometryModel::MatrixXb::Constant(ngeoms, ngeoms, false);
+    for (const CollisionPair & pair : cache.pruned_pairs)
+    {
+      is_pruned(Eigen::Index(pair.first), Eigen::Index(pair.second)) = true;
+      is_pruned(Eigen::Index(pair.second), Eigen::Index(pair.first)) = true;
+    }
+
+    // Rebuild the collision pairs, which is linear in their number contrary to removing them one
+    // by one.
+    const GeometryModel::CollisionPairVector collision_pairs = geom_model.collisionPairs;
+    geom_model.removeAllCollisionPairs();
+    for (const CollisionPair & pair : collision_pairs)
+    {
+      if (!is_pruned(Eigen::Index(pair.first), Eigen::Index(pair.second)))
+        geom_model.addCollisionPair(pair);
+    }
+  }
+} // namespace pinocchio
@@ -20,6 +20,7 @@ namespace pinocchio
   struct GeometryPhongMaterial;
   struct FrictionCoefficientMatrix;
   struct PhysicsMaterial;
+  struct SignedDistanceField;
   struct GeometryObject;
   struct ComputeCollision;
   struct ComputeContactPatch;
@@ -28,6 +29,8 @@ namespace pinocchio
   struct CollisionPair;
   struct GeometryModel;
   struct GeometryData;
+  struct CollisionPairPruningCache;
+  struct GeometryPlacementsBatch;
 
   struct GeometryObjectFilterBase;
   struct GeometryObjectFilterNothing;
@@ -176,6 +176,10 @@ namespace pinocchio
     /// \brief The physics property of the object.
     PhysicsMaterial physicsMaterial;
 
+    /// \brief Optional signed distance field of a static geometry, queried instead of the
+    /// geometry by computeDistance and computeCollision against spheres and capsules.
+    std::shared_ptr<SignedDistanceField> distanceField;
+
     ///
     /// \brief Full constructor.
     ///
@@ -368,6 +372,7 @@ namespace pinocchio
       meshTexturePath = other.meshTexturePath;
       disableCollision = other.disableCollision;
       physicsMaterial = other.physicsMaterial;
+      distanceField = other.distanceField;
       return *this;
     }
 
@@ -397,7 +402,8 @@ namespace pinocchio
              && meshMaterial == other.meshMaterial && meshTexturePath == other.meshTexturePath
              && disableCollision == other.disableCollision
              && physicsMaterial == other.physicsMaterial
-             && compare_shared_ptr(geometry, other.geometry);
+             && compare_shared_ptr(geometry, other.geometry)
+             && compare_shared_ptr(distanceField, other.distanceField);
     }
 
     bool operator!=(const GeometryObject & other) const
@@ -0,0 +1,95 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/geometry.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/geometry.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  ///
+  /// \brief Structure-of-arrays storage of the placements of the geometry objects of a
+  /// GeometryModel, the geometries being grouped by parent joint.
+  ///
+  /// The rotations (resp. translations) of the geometries are stored contiguously in 3 x 3n
+  /// (resp. 3 x n) matrices, so that the placements of all the geometries supported by a joint are
+  /// composed with the joint placement by a single matrix product (see updateGeometryPlacements).
+  /// The local placements are copied from the geometry model at construction: the batch should
+  /// be rebuilt when the geometry model is modified.
+  ///
+  struct GeometryPlacementsBatch
+  {
+    typedef GeometryData::Scalar Scalar;
+    typedef Eigen::Matrix<Scalar, 3, Eigen::Dynamic> Matrix3Xs;
+    typedef std::vector<Eigen::Index> IndexVector;
+
+    /// \brief Default constructor, building an empty batch.
+    GeometryPlacementsBatch()
+    {
+    }
+
+    /// \brief Constructor storing the placements of the geometry objects of geom_model.
+    explicit GeometryPlacementsBatch(const GeometryModel & geom_model)
+    {
+      const Eigen::Index ngeoms = Eigen::Index(geom_model.ngeoms);
+
+      // Counting sort of the geometries by parent joint
+      JointIndex njoints = 0;
+      for (const GeometryObject & geom_object : geom_model.geometryObjects)
+        njoints = (std::max)(njoints, geom_object.parentJoint + 1);
+      joint_offsets.assign(njoints + 1, 0);
+      for (const GeometryObject & geom_object : geom_model.geometryObjects)
+        ++joint_offsets[geom_object.parentJoint + 1];
+      for (JointIndex joint_id = 0; joint_id < njoints; ++joint_id)
+        joint_offsets[joint_id + 1] += joint_offsets[joint_id];
+
+      geometry_ids.resize(geom_model.ngeoms);
+      rotations.resize(3, 3 * ngeoms);
+      translations.resize(3, ngeoms);
+      IndexVector next(joint_offsets.begin(), joint_offsets.end() - 1);
+      for (GeomIndex geom_id = 0; geom_id < geom_model.ngeoms; ++geom_id)
+      {
+        const GeometryObject & geom_object = geom_model.geometryObjects[geom_id];
+        const Eigen::Index k = next[geom_object.parentJoint]++;
+        geometry_ids[size_t(k)] = geom_id;
+        rotations.middleCols<3>(3 * k) = geom_object.placement.rotation();
+        translations.col(k) = geom_object.placement.translation();
+      }
+
+      oRotations = rotations;
+      oTranslations = translations;
+    }
+
+    /// \brief Returns the number of geometries of the batch.
+    Eigen::Index size() const
+    {
+      return translations.cols();
+    }
+
+    /// \brief Index in the geometry model of each geometry of the batch.
+    std::vector<GeomIndex> geometry_ids;
+
+    /// \brief The geometries of the batch supported by the joint j are the geometries
+    /// joint_offsets[j] to joint_offsets[j+1] - 1.
+    IndexVector joint_offsets;
+
+    /// \brief Rotations of the geometries with respect to their parent joint (dim 3 x 3n).
+    Matrix3Xs rotations;
+
+    /// \brief Translations of the geometries with respect to their parent joint (dim 3 x n).
+    Matrix3Xs translations;
+
+    /// \brief Rotations of the geometries with respect to the world (dim 3 x 3n).
+    Matrix3Xs oRotations;
+
+    /// \brief Translations of the geometries with respect to the world (dim 3 x n).
+    Matrix3Xs oTranslations;
+  }; // struct GeometryPlacementsBatch
+
+} // namespace pinocchio
@@ -313,6 +313,30 @@ namespace pinocchio
     ///  \brief Functor associated to the computation of distances.
     std::vector<ComputeDistance> distance_functors;
 
+    ///
+    /// \brief Placements of the joints at the last call to computeCollisionsWithTemporalCoherence.
+    ///
+    std::vector<SE3> coherence_joint_placements;
+
+    ///
+    /// \brief Accumulated upper bound on the displacement of the points of the bodies supported by
+    /// each joint, since the initialization of the coherence cache.
+    ///
+    std::vector<Scalar> coherence_joint_displacements;
+
+    ///
+    /// \brief Lower bound on the distance minus the security margin of each collision pair, as
+    /// computed by the last narrow phase performed on this pair.
+    /// A negative infinite value forces the narrow phase at the next call.
+    ///
+    std::vector<Scalar> coherence_pair_distances;
+
+    ///
+    /// \brief Sum of the accumulated displacements of the two bodies of each collision pair at the
+    /// time of its last narrow phase.
+    ///
+    std::vector<Scalar> coherence_pair_displacements;
+
 #endif // PINOCCHIO_WITH_COLLISION
 
     /// \brief Map over vector GeomModel::geometryObjects, indexed by joints.
@@ -447,6 +471,28 @@ namespace pinocchio
       const bool upper = true,
       const bool sync_distance_upper_bound = false);
 
+    ///
+    /// \brief Preallocate the contacts of the collision results, according to the maximum number
+    /// of contacts (num_max_contacts) of the related collision requests. The collision results are
+    /// cleared.
+    ///
+    /// Once reserved, computing the collisions does not involve any dynamic memory allocation.
+    /// This method is called by the constructor and should be called again after increasing the
+    /// num_max_contacts field of a collision request.
+    ///
+    /// \remarks Copying a GeometryData does not preserve the reserved memory.
+    ///
+    void reserveCollisionResults();
+
+    ///
+    /// \brief Reset the cache used by computeCollisionsWithTemporalCoherence, so that the narrow
+    /// phase is performed on all the collision pairs at the next call.
+    ///
+    /// \remarks This method must be called whenever the geometries or their placements relatively
+    /// to their parent joints are modified.
+    ///
+    void resetCollisionCoherenceCache();
+
 #endif // ifdef PINOCCHIO_WITH_COLLISION
 
     friend std::ostream & operator<<(std::ostream & os, const GeometryData & geomData);
@@ -584,6 +630,8 @@ namespace pinocchio
       contact_patch_functors.push_back(ComputeContactPatch(obj_1, obj_2));
       distance_functors.push_back(ComputeDistance(obj_1, obj_2));
     }
+    reserveCollisionResults();
+    resetCollisionCoherenceCache();
 #endif
     fillInnerOuterObjectMaps(geom_model);
   }
@@ -603,6 +651,10 @@ namespace pinocchio
   , collision_functors(other.collision_functors)
   , contact_patch_functors(other.contact_patch_functors)
   , distance_functors(other.distance_functors)
+  , coherence_joint_placements(other.coherence_joint_placements)
+  , coherence_joint_displacements(other.coherence_joint_displacements)
+  , coherence_pair_distances(other.coherence_pair_distances)
+  , coherence_pair_displacements(other.coherence_pair_displacements)
 #endif // PINOCCHIO_WITH_COLLISION
   , innerObjects(other.innerObjects)
   , outerObjects(other.outerObjects)
@@ -627,6 +679,10 @@ namespace pinocchio
       collision_functors = other.collision_functors;
       contact_patch_functors = other.contact_patch_functors;
       distance_functors = other.distance_functors;
+      coherence_joint_placements = other.coherence_joint_placements;
+      coherence_joint_displacements = other.coherence_joint_displacements;
+      coherence_pair_distances = other.coherence_pair_distances;
+      coherence_pair_displacements = other.coherence_pair_displacements;
 #endif // PINOCCHIO_WITH_COLLISION
       innerObjects = other.innerObjects;
       outerObjects = other.outerObjects;
@@ -990,6 +1046,32 @@ namespace pinocchio
         collisionRequests[k].distance_upper_bound = collisionRequests[k].security_margin;
     }
   }
+
+  inline void GeometryData::reserveCollisionResults()
+  {
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(
+      collisionResults.size(), collisionRequests.size(),
+      "The number of collision results and collision requests are not the same.");
+
+    // coal::CollisionResult keeps the capacity of its contact vector when cleared.
+    for (size_t k = 0; k < collisionResults.size(); ++k)
+    {
+      coal::CollisionResult & collision_result = collisionResults[k];
+      for (size_t i = collision_result.numContacts(); i < collisionRequests[k].num_max_contacts;
+           ++i)
+        collision_result.addContact(coal::Contact());
+      collision_result.clear();
+    }
+  }
+
+  inline void GeometryData::resetCollisionCoherenceCache()
+  {
+    coherence_joint_placements.clear();
+    coherence_joint_displacements.clear();
+    coherence_pair_distances.assign(
+      collisionRequests.size(), -std::numeric_limits<Scalar>::infinity());
+    coherence_pair_displacements.assign(collisionRequests.size(), Scalar(0));
+  }
 #endif // ifdef PINOCCHIO_WITH_COLLISION
 
   inline void GeometryData::deactivateCollisionPair(const PairIndex pair_id)
@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/geometry.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/geometry.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  ///
+  /// \brief Signed distance field of a static geometry, sampled on a regular grid expressed in the
+  /// frame of the geometry.
+  ///
+  /// Once attached to a GeometryObject (see GeometryObject::distanceField), computeDistance and
+  /// computeCollision query the field instead of running the narrow phase against the spheres
+  /// and capsules it is paired with, which takes a constant time whatever the complexity of the
+  /// static geometry. The field is computed with computeSignedDistanceField and can be saved and
+  /// loaded (see serialization::Serializable).
+  ///
+  struct SignedDistanceField : serialization::Serializable<SignedDistanceField>
+  {
+    typedef double Scalar;
+    typedef Eigen::Matrix<Scalar, 3, 1> Vector3;
+    typedef Eigen::Matrix<Scalar, Eigen::Dynamic, 1> VectorXs;
+    typedef Eigen::Matrix<Eigen::Index, 3, 1> Index3;
+
+    /// \brief Default constructor, building an empty field.
+    SignedDistanceField()
+    : origin(Vector3::Zero())
+    , resolution(Scalar(1))
+    , sizes(Index3::Zero())
+    {
+    }
+
+    ///
+    /// \brief Constructor of a field whose values are all set to zero.
+    ///
+    /// \param[in] origin Position of the first node of the grid in the frame of the geometry.
+    /// \param[in] resolution Distance between two consecutive nodes of the grid.
+    /// \param[in] sizes Number of nodes of the grid along each axis, at least two.
+    ///
+    SignedDistanceField(const Vector3 & origin, const Scalar resolution, const Index3 & sizes)
+    : origin(origin)
+    , resolution(resolution)
+    , sizes(sizes)
+    {
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(resolution > Scalar(0), "The resolution should be positive.");
+      PINOCCHIO_CHECK_INPUT_ARGUMENT(
+        (sizes.array() >= 2).all(), "The grid should have at least two nodes along each axis.");
+      values.setZero(sizes.prod());
+    }
+
+    /// \brief Returns the index in values of the node (i, j, k).
+    Eigen::Index index(const Eigen::Index i, const Eigen::Index j, const Eigen::Index k) const
+    {
+      return i + sizes[0] * (j + sizes[1] * k);
+    }
+
+    /// \brief Returns the value of the node (i, j, k).
+    Scalar & value(const Eigen::Index i, const Eigen::Index j, const Eigen::Index k)
+    {
+      return values[index(i, j, k)];
+    }
+
+    /// \brief Returns the value of the node (i, j, k).
+    Scalar value(const Eigen::Index i, const Eigen::Index j, const Eigen::Index k) const
+    {
+      return values[index(i, j, k)];
+    }
+
+    /// \brief Returns the position of the node (i, j, k) in the frame of the geometry.
+    Vector3 nodePosition(const Eigen::Index i, const Eigen::Index j, const Eigen::Index k) const
+    {
+      return origin + resolution * Vector3(Scalar(i), Scalar(j), Scalar(k));
+    }
+
+    ///
+    /// \brief Evaluate the field and its gradient at a given point by trilinear interpolation of
+    /// the nodes of the grid.
+    ///
+    /// Outside of the grid, the field is extrapolated by adding the distance to the grid to the
+    /// value at the closest point of the grid.
+    ///
+    /// \param[in] point Point expressed in the frame of the geometry.
+    /// \param[out] gradient Gradient of the field at point, expressed in the frame of the geometry.
+    ///
+    /// \returns The value of the field at point.
+    ///
+    template<typename Vector3Like, typename GradientVector3Like>
+    Scalar evaluate(
+      const Eigen::MatrixBase<Vector3Like> & point,
+      const Eigen::MatrixBase<GradientVector3Like> & gradient) const;
+
+    ///
+    /// \brief Returns true if *this and other are equal.
+    ///
+    bool operator==(const SignedDistanceField & other) const
+    {
+      return origin == other.origin && resolution == other.resolution && sizes == other.sizes
+             && values.size() == other.values.size() && values == other.values;
+    }
+
+    ///
+    /// \brief Returns true if *this and other are not equal.
+    ///
+    bool operator!=(const SignedDistanceField & other) const
+    {
+      return !(*this == other);
+    }
+
+    /// \brief Position of the first node of the grid in the frame of the geometry.
+    Vector3 origin;
+
+    /// \brief Distance between two consecutive nodes of the grid.
+    Scalar resolution;
+
+    /// \brief Number of nodes of the grid along each axis.
+    Index3 sizes;
+
+    /// \brief Signed distances at the nodes of the grid, the first axis being the fastest.
+    VectorXs values;
+  }; // struct SignedDistanceField
+
+  template<typename Vector3Like, typename GradientVector3Like>
+  SignedDistanceField::Scalar SignedDistanceField::evaluate(
+    const Eigen::MatrixBase<Vector3Like> & point,
+    const Eigen::MatrixBase<GradientVector3Like> & gradient_) const
+  {
+    GradientVector3Like & gradient = gradient_.const_cast_derived();
+    assert(values.size() == sizes.prod() && values.size() > 0 && "The field is empty.");
+
+    // Closest point of the grid, the cell containing it and its coordinates within the cell
+    const Vector3 upper =
+      origin + resolution * (sizes.cast<Scalar>().array() - Scalar(1)).matrix();
+    const Vector3 clamped = point.template cast<Scalar>().cwiseMax(origin).cwiseMin(upper);
+    Index3 cell;
+    Vector3 t;
+    for (int k = 0; k < 3; ++k)
+    {
+      const Scalar coordinate = (clamped[k] - origin[k]) / resolution;
+      cell[k] = (std::min)(Eigen::Index(coordinate), sizes[k] - 2);
+      t[k] = coordinate - Scalar(cell[k]);
+    }
+
+    const Eigen::Index i = cell[0], j = cell[1], k = cell[2];
+    const Scalar c000 = value(i, j, k), c100 = value(i + 1, j, k);
+    const Scalar c010 = value(i, j + 1, k), c110 = value(i + 1, j + 1, k);
+    const Scalar c001 = value(i, j, k + 1), c101 = value(i + 1, j, k + 1);
+    const Scalar c011 = value(i, j + 1, k + 1), c111 = value(i + 1, j + 1, k + 1);
+
+    // Interpolation along x, then y, then z
+    const Scalar c00 = c000 + t[0] * (c100 - c000), c10 = c010 + t[0] * (c110 - c010);
+    const Scalar c01 = c001 + t[0] * (c101 - c001), c11 = c011 + t[0] * (c111 - c011);
+    const Scalar c0 = c00 + t[1] * (c10 - c00), c1 = c01 + t[1] * (c11 - c01);
+    Scalar res = c0 + t[2] * (c1 - c0);
+
+    const Scalar dx0 = (c100 - c000) + t[1] * ((c110 - c010) - (c100 - c000));
+    const Scalar dx1 = (c101 - c001) + t[1] * ((c111 - c011) - (c101 - c001));
+    gradient[0] = (dx0 + t[2] * (dx1 - dx0)) / resolution;
+    gradient[1] = ((c10 - c00) + t[2] * ((c11 - c01) - (c10 - c00))) / resolution;
+    gradient[2] = (c1 - c0) / resolution;
+
+    // Extrapolation outside of the grid
+    const Vector3 offset = point.template cast<Scalar>() - clamped;
+    const Scalar outside_distance = offset.norm();
+    if (outside_distance > Scalar(0))
+    {
+      for (int axis = 0; axis < 3; ++axis)
+      {
+        if (offset[axis] != Scalar(0))
+          gradient[axis] = offset[axis] / outside_distance;
+      }
+      res += outside_distance;
+    }
+
+    return res;
+  }
+} // namespace pinocchio
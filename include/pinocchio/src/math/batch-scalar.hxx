@@ -0,0 +1,498 @@
+//
+// Copyright (c) 2026 INRIA
+//
+#pragma once
+
+// IWYU pragma: private, include "pinocchio/math/batch-scalar.hpp"
+
+#ifdef PINOCCHIO_LSP
+  #undef PINOCCHIO_LSP
+  #include "pinocchio/math/batch-scalar.hpp"
+#endif // PINOCCHIO_LSP
+
+namespace pinocchio
+{
+  ///
+  /// \brief Scalar type packing BatchSize values, evaluated in lockstep.
+  ///
+  /// Instantiating ModelTpl and DataTpl over BatchScalarTpl allows a single traversal of the
+  /// kinematic tree to evaluate an algorithm for BatchSize different states, each lane of the
+  /// scalar corresponding to one element of the batch. All the arithmetic operations and the
+  /// elementary functions are applied lane-wise on the underlying Eigen::Array, so they are
+  /// vectorized by Eigen (e.g. 4 lanes of double with AVX2, 8 lanes with AVX512).
+  ///
+  /// Comparison operators return true if the comparison holds for all the lanes (any lane for
+  /// operator!=). Branches depending on the value of a scalar are therefore taken according to
+  /// all the lanes. Lane-wise selections must go through internal::if_then_else.
+  ///
+  /// \tparam _Scalar Scalar type of each lane.
+  /// \tparam _BatchSize Number of lanes.
+  ///
+  template<typename _Scalar, int _BatchSize>
+  struct BatchScalarTpl
+  {
+    typedef _Scalar Scalar;
+    enum
+    {
+      BatchSize = _BatchSize
+    };
+    typedef Eigen::Array<Scalar, BatchSize, 1, Eigen::DontAlign> LanesType;
+
+    BatchScalarTpl()
+    {
+    }
+
+    /// \brief Broadcasts value to all the lanes.
+    template<
+      typename T,
+      typename std::enable_if<std::is_arithmetic<T>::value, bool>::type = true>
+    BatchScalarTpl(const T value)
+    : m_lanes(LanesType::Constant(static_cast<Scalar>(value)))
+    {
+    }
+
+    template<typename OtherDerived>
+    explicit BatchScalarTpl(const Eigen::ArrayBase<OtherDerived> & lanes)
+    : m_lanes(lanes)
+    {
+    }
+
+    const LanesType & lanes() const
+    {
+      return m_lanes;
+    }
+    LanesType & lanes()
+    {
+      return m_lanes;
+    }
+
+    const Scalar & lane(const Eigen::Index i) const
+    {
+      return m_lanes.coeff(i);
+    }
+    Scalar & lane(const Eigen::Index i)
+    {
+      return m_lanes.coeffRef(i);
+    }
+
+    BatchScalarTpl & operator+=(const BatchScalarTpl & other)
+    {
+      m_lanes += other.m_lanes;
+      return *this;
+    }
+    BatchScalarTpl & operator-=(const BatchScalarTpl & other)
+    {
+      m_lanes -= other.m_lanes;
+      return *this;
+    }
+    BatchScalarTpl & operator*=(const BatchScalarTpl & other)
+    {
+      m_lanes *= other.m_lanes;
+      return *this;
+    }
+    BatchScalarTpl & operator/=(const BatchScalarTpl & other)
+    {
+      m_lanes /= other.m_lanes;
+      return *this;
+    }
+
+    // The operators and the elementary functions are defined as hidden friends: they are found by
+    // argument dependent lookup (e.g. after using std::sin) and accept arithmetic types on both
+    // sides through the broadcasting constructor.
+
+    friend BatchScalarTpl operator-(const BatchScalarTpl & x)
+    {
+      return BatchScalarTpl(-x.m_lanes);
+    }
+    friend BatchScalarTpl operator+(const BatchScalarTpl & x)
+    {
+      return x;
+    }
+
+#define PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR(op)                                                 \
+  friend BatchScalarTpl operator op(const BatchScalarTpl & x, const BatchScalarTpl & y)            \
+  {                                                                                                \
+    return BatchScalarTpl(x.m_lanes op y.m_lanes);                                                 \
+  }
+
+    PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR(+)
+    PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR(-)
+    PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR(*)
+    PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR(/)
+
+#undef PINOCCHIO_BATCH_SCALAR_BINARY_OPERATOR
+
+#define PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(op)                                             \
+  friend bool operator op(const BatchScalarTpl & x, const BatchScalarTpl & y)                      \
+  {                                                                                                \
+    return (x.m_lanes op y.m_lanes).all();                                                         \
+  }
+
+    PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(<)
+    PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(<=)
+    PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(>)
+    PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(>=)
+    PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR(==)
+
+#undef PINOCCHIO_BATCH_SCALAR_COMPARISON_OPERATOR
+
+    friend bool operator!=(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return !(x == y);
+    }
+
+#define PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(name, expr)                                          \
+  friend BatchScalarTpl name(const BatchScalarTpl & x)                                             \
+  {                                                                                                \
+    return BatchScalarTpl(x.m_lanes.expr);                                                         \
+  }
+
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(abs, abs())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(fabs, abs())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(sqrt, sqrt())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(exp, exp())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(log, log())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(sin, sin())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(cos, cos())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(tan, tan())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(asin, asin())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(acos, acos())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(atan, atan())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(tanh, tanh())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(floor, floor())
+    PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION(ceil, ceil())
+
+#undef PINOCCHIO_BATCH_SCALAR_UNARY_FUNCTION
+
+    friend BatchScalarTpl atan2(const BatchScalarTpl & y, const BatchScalarTpl & x)
+    {
+      return BatchScalarTpl(y.m_lanes.binaryExpr(x.m_lanes, [](const Scalar & a, const Scalar & b) {
+        using std::atan2;
+        return atan2(a, b);
+      }));
+    }
+    friend BatchScalarTpl pow(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return BatchScalarTpl(x.m_lanes.pow(y.m_lanes));
+    }
+    friend BatchScalarTpl min(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return BatchScalarTpl(x.m_lanes.min(y.m_lanes));
+    }
+    friend BatchScalarTpl max(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return BatchScalarTpl(x.m_lanes.max(y.m_lanes));
+    }
+    friend BatchScalarTpl fmin(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return min(x, y);
+    }
+    friend BatchScalarTpl fmax(const BatchScalarTpl & x, const BatchScalarTpl & y)
+    {
+      return max(x, y);
+    }
+
+    friend bool isfinite(const BatchScalarTpl & x)
+    {
+      return x.m_lanes.isFinite().all();
+    }
+    friend bool isnan(const BatchScalarTpl & x)
+    {
+      return x.m_lanes.isNaN().any();
+    }
+    friend bool isinf(const BatchScalarTpl & x)
+    {
+      return x.m_lanes.isInf().any();
+    }
+
+    friend std::ostream & operator<<(std::ostream & os, const BatchScalarTpl & x)
+    {
+      return os << "[" << x.m_lanes.transpose() << "]";
+    }
+
+  protected:
+    LanesType m_lanes;
+  }; // struct BatchScalarTpl
+
+  ///
+  /// \brief Packs the columns of batch into the lanes of the coefficients of packed.
+  ///
+  /// \param[in] batch Matrix of dimension n x BatchSize, each column being one element of the
+  /// batch.
+  /// \param[out] packed Vector of BatchScalarTpl of dimension n.
+  ///
+  template<typename MatrixType, typename BatchVectorType>
+  void packBatch(
+    const Eigen::MatrixBase<MatrixType> & batch, const Eigen::MatrixBase<BatchVectorType> & packed)
+  {
+    typedef typename BatchVectorType::Scalar BatchScalar;
+    BatchVectorType & packed_ = packed.const_cast_derived();
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(batch.cols(), BatchScalar::BatchSize);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(packed.size(), batch.rows());
+
+    for (Eigen::Index k = 0; k < batch.rows(); ++k)
+      packed_.coeffRef(k).lanes() = batch.row(k).transpose().array();
+  }
+
+  ///
+  /// \brief Unpacks the lanes of the coefficients of packed into the columns of batch.
+  ///
+  /// \param[in] packed Vector of BatchScalarTpl of dimension n.
+  /// \param[out] batch Matrix of dimension n x BatchSize, each column being one element of the
+  /// batch.
+  ///
+  template<typename BatchVectorType, typename MatrixType>
+  void unpackBatch(
+    const Eigen::MatrixBase<BatchVectorType> & packed, const Eigen::MatrixBase<MatrixType> & batch)
+  {
+    typedef typename BatchVectorType::Scalar BatchScalar;
+    MatrixType & batch_ = batch.const_cast_derived();
+
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(batch.cols(), BatchScalar::BatchSize);
+    PINOCCHIO_CHECK_ARGUMENT_SIZE(batch.rows(), packed.size());
+
+    for (Eigen::Index k = 0; k < packed.size(); ++k)
+      batch_.row(k) = packed.coeff(k).lanes().transpose().matrix();
+  }
+
+  template<typename Scalar, int BatchSize>
+  struct TaylorSeriesExpansion<BatchScalarTpl<Scalar, BatchSize>> : TaylorSeriesExpansion<Scalar>
+  {
+    typedef TaylorSeriesExpansion<Scalar> Base;
+    typedef BatchScalarTpl<Scalar, BatchSize> BatchScalar;
+
+    template<int degree>
+    static BatchScalar precision()
+    {
+      return BatchScalar(Base::template precision<degree>());
+    }
+
+    static BatchScalar precision(const int degree)
+    {
+      return BatchScalar(Base::precision(degree));
+    }
+  };
+
+  namespace internal
+  {
+    /// \brief Lane-wise selection between then_value and else_value.
+    template<typename Scalar, int BatchSize>
+    struct if_then_else_impl<
+      BatchScalarTpl<Scalar, BatchSize>,
+      BatchScalarTpl<Scalar, BatchSize>,
+      BatchScalarTpl<Scalar, BatchSize>,
+      BatchScalarTpl<Scalar, BatchSize>>
+    {
+      typedef BatchScalarTpl<Scalar, BatchSize> BatchScalar;
+      typedef BatchScalar ReturnType;
+
+      static inline ReturnType run(
+        const ComparisonOperators op,
+        const BatchScalar & lhs_value,
+        const BatchScalar & rhs_value,
+        const BatchScalar & then_value,
+        const BatchScalar & else_value)
+      {
+        const typename BatchScalar::LanesType & lhs = lhs_value.lanes();
+        const typename BatchScalar::LanesType & rhs = rhs_value.lanes();
+        const typename BatchScalar::LanesType & then_lanes = then_value.lanes();
+        const typename BatchScalar::LanesType & else_lanes = else_value.lanes();
+
+        switch (op)
+        {
+        case LT:
+          return BatchScalar((lhs < rhs).select(then_lanes, else_lanes));
+        case LE:
+          return BatchScalar((lhs <= rhs).select(then_lanes, else_lanes));
+        case EQ:
+          return BatchScalar((lhs == rhs).select(then_lanes, else_lanes));
+        case GE:
+          return BatchScalar((lhs >= rhs).select(then_lanes, else_lanes));
+        case GT:
+          return BatchScalar((lhs > rhs).select(then_lanes, else_lanes));
+        }
+        PINOCCHIO_THROW_PRETTY(
+          std::logic_error, "ComparisonOperators " << static_cast<int>(op) << " is not managed");
+      }
+    };
+
+    ///
+    /// \brief Inversion without pivoting, the pivots being lane dependent.
+    ///
+    /// \remarks The matrices inverted along the algorithms (e.g. the joint space inertia of a
+    /// subtree) are symmetric positive definite, for which no pivoting is required.
+    ///
+    template<typename Scalar, int BatchSize>
+    struct CallCorrectMatrixInverseAccordingToScalar<BatchScalarTpl<Scalar, BatchSize>>
+    {
+      template<typename MatrixIn, typename MatrixOut>
+      static void
+      run(const Eigen::MatrixBase<MatrixIn> & m_in, const Eigen::MatrixBase<MatrixOut> & dest)
+      {
+        typedef BatchScalarTpl<Scalar, BatchSize> BatchScalar;
+        MatrixOut & res = PINOCCHIO_EIGEN_CONST_CAST(MatrixOut, dest);
+
+        // Gauss-Jordan elimination performed in place.
+        res = m_in;
+        const Eigen::Index n = res.rows();
+        for (Eigen::Index k = 0; k < n; ++k)
+        {
+          const BatchScalar pivot_inv = BatchScalar(1) / res.coeff(k, k);
+          res.coeffRef(k, k) = BatchScalar(1);
+          res.row(k) *= pivot_inv;
+          for (Eigen::Index i = 0; i < n; ++i)
+          {
+            if (i == k)
+              continue;
+            const BatchScalar factor = res.coeff(i, k);
+            res.coeffRef(i, k) = BatchScalar(0);
+            res.row(i) -= factor * res.row(k);
+          }
+        }
+      }
+    };
+
+    template<typename Scalar, int BatchSize, int Options, typename NewScalar>
+    struct cast_call_normalize_method<
+      SE3Tpl<BatchScalarTpl<Scalar, BatchSize>, Options>,
+      NewScalar,
+      BatchScalarTpl<Scalar, BatchSize>>
+    {
+      template<typename T>
+      static void run(T &)
+      {
+        // do nothing
+      }
+    };
+
+    template<typename Scalar, int Options, typename NewScalar, int BatchSize>
+    struct cast_call_normalize_method<
+      SE3Tpl<Scalar, Options>,
+      BatchScalarTpl<NewScalar, BatchSize>,
+      Scalar>
+    {
+      template<typename T>
+      static void run(T &)
+      {
+        // do nothing
+      }
+    };
+  } // namespace internal
+} // namespace pinocchio
+
+namespace boost
+{
+  namespace math
+  {
+    namespace constants
+    {
+      namespace detail
+      {
+        template<typename Scalar, int BatchSize>
+        struct constant_pi<::pinocchio::BatchScalarTpl<Scalar, BatchSize>> : constant_pi<Scalar>
+        {
+          typedef ::pinocchio::BatchScalarTpl<Scalar, BatchSize> BatchScalar;
+
+          template<int N>
+          static inline BatchScalar get(const mpl::int_<N> & n)
+          {
+            return BatchScalar(constant_pi<Scalar>::get(n));
+          }
+
+#if BOOST_VERSION >= 107700
+          template<class T, T value>
+          static inline BatchScalar get(const std::integral_constant<T, value> & n)
+          {
+            return BatchScalar(constant_pi<Scalar>::get(n));
+          }
+#else
+          template<class T, T value>
+          static inline BatchScalar get(const boost::integral_constant<T, value> & n)
+          {
+            return BatchScalar(constant_pi<Scalar>::get(n));
+          }
+#endif
+        };
+      } // namespace detail
+    } // namespace constants
+  } // namespace math
+} // namespace boost
+
+namespace Eigen
+{
+  /// \brief Eigen::NumTraits<> specialization for pinocchio::BatchScalarTpl
+  template<typename Scalar, int BatchSize>
+  struct NumTraits<::pinocchio::BatchScalarTpl<Scalar, BatchSize>>
+  {
+    typedef ::pinocchio::BatchScalarTpl<Scalar, BatchSize> BatchScalar;
+
+    typedef BatchScalar Real;
+    typedef BatchScalar NonInteger;
+    typedef BatchScalar Literal;
+    typedef BatchScalar Nested;
+
+    enum
+    {
+      IsComplex = 0,
+      IsInteger = 0,
+      IsSigned = 1,
+      RequireInitialization = 0,
+      ReadCost = NumTraits<Scalar>::ReadCost,
+      AddCost = NumTraits<Scalar>::AddCost,
+      MulCost = NumTraits<Scalar>::MulCost
+    };
+
+    EIGEN_DEVICE_FUNC static inline BatchScalar epsilon()
+    {
+      return BatchScalar(NumTraits<Scalar>::epsilon());
+    }
+    EIGEN_DEVICE_FUNC static inline BatchScalar dummy_precision()
+    {
+      return BatchScalar(NumTraits<Scalar>::dummy_precision());
+    }
+    EIGEN_DEVICE_FUNC static inline BatchScalar highest()
+    {
+      return BatchScalar(NumTraits<Scalar>::highest());
+    }
+    EIGEN_DEVICE_FUNC static inline BatchScalar lowest()
+    {
+      return BatchScalar(NumTraits<Scalar>::lowest());
+    }
+    EIGEN_DEVICE_FUNC static inline BatchScalar infinity()
+    {
+      return BatchScalar(NumTraits<Scalar>::infinity());
+    }
+    EIGEN_DEVICE_FUNC static inline BatchScalar quiet_NaN()
+    {
+      return BatchScalar(NumTraits<Scalar>::quiet_NaN());
+    }
+    EIGEN_DEVICE_FUNC EIGEN_CONSTEXPR static inline int digits10()
+    {
+      return NumTraits<Scalar>::digits10();
+    }
+    EIGEN_DEVICE_FUNC EIGEN_CONSTEXPR static inline int digits()
+    {
+      return NumTraits<Scalar>::digits();
+    }
+#if EIGEN_VERSION_AT_LEAST(3, 4, 90)
+    EIGEN_DEVICE_FUNC EIGEN_CONSTEXPR static inline int max_digits10()
+    {
+      return NumTraits<Scalar>::max_digits10();
+    }
+#endif
+  };
+
+  /// \brief Products and sums between a BatchScalarTpl and its lane type return a BatchScalarTpl.
+  template<typename Scalar, int BatchSize, typename BinaryOp>
+  struct ScalarBinaryOpTraits<::pinocchio::BatchScalarTpl<Scalar, BatchSize>, Scalar, BinaryOp>
+  {
+    typedef ::pinocchio::BatchScalarTpl<Scalar, BatchSize> ReturnType;
+  };
+
+  template<typename Scalar, int BatchSize, typename BinaryOp>
+  struct ScalarBinaryOpTraits<Scalar, ::pinocchio::BatchScalarTpl<Scalar, BatchSize>, BinaryOp>
+  {
+    typedef ::pinocchio::BatchScalarTpl<Scalar, BatchSize> ReturnType;
+  };
+} // namespace Eigen
@@ -696,6 +696,22 @@ namespace pinocchio
       template<typename DiagonalVectorType>
       void rebuild(const Eigen::DiagonalWrapper<DiagonalVectorType> & diagonal_expression);
 
+      /**
+       * @brief Rebuilds the block-diagonal matrix as a zero matrix.
+       * @details Contrary to Zero(), the memory already allocated by the matrix is reused.
+       * @param[in] size The dimension of the resulting square matrix.
+       */
+      void rebuildZero(const Eigen::Index size);
+
+      /**
+       * @brief Rebuilds the block-diagonal matrix as a scalar multiple of the identity matrix.
+       * @details Contrary to ScalarIdentity(), the memory already allocated by the matrix is
+       * reused.
+       * @param[in] size The dimension of the resulting square matrix.
+       * @param[in] value The scalar value to place on the main diagonal.
+       */
+      void rebuildScalarIdentity(const Eigen::Index size, const Scalar & value);
+
       /// \brief Returns a pointer to the underlying array serving as element storage.
       void * data()
       {
@@ -778,11 +794,11 @@ namespace pinocchio
       // ConstMatrixBlockElement block_info = {
       //   pinocchio::MatrixBlockType::Diagonal, diagonal_terms.size(), diagonal_terms};
       const auto & diagonal_terms = diagonal_expression.diagonal();
-      ConstMatrixBlockElement block_info = {MatrixBlockType::Diagonal, diagonal_terms.size()};
-
-      const std::vector<ConstMatrixBlockElement> input_block_pattern = {{block_info}};
+      const ConstMatrixBlockElement block_info = {
+        MatrixBlockType::Diagonal, diagonal_terms.size()};
 
-      init_or_rebuild(input_block_pattern);
+      // A single element pattern does not need any heap allocated container.
+      init_or_rebuild(&block_info, 1);
       m_matrix_block_elements.back().container() = diagonal_terms;
     }
 
@@ -1326,24 +1342,37 @@ namespace pinocchio
     BlockDiagonalMatrixTpl<Scalar, Options, Alignment>
     BlockDiagonalMatrixTpl<Scalar, Options, Alignment>::Zero(const Eigen::Index size)
     {
-      MatrixBlockElement block_info = {MatrixBlockType::Zero, size};
-      const std::vector<MatrixBlockElement> input_block_pattern = {{block_info}};
+      BlockDiagonalMatrixTpl res;
+      res.rebuildZero(size);
+      return res;
+    }
 
-      return BlockDiagonalMatrixTpl(input_block_pattern);
+    template<typename Scalar, int Options, std::size_t Alignment>
+    void BlockDiagonalMatrixTpl<Scalar, Options, Alignment>::rebuildZero(const Eigen::Index size)
+    {
+      const MatrixBlockElement block_info = {MatrixBlockType::Zero, size};
+      init_or_rebuild(&block_info, 1);
     }
 
     template<typename Scalar, int Options, std::size_t Alignment>
     BlockDiagonalMatrixTpl<Scalar, Options, Alignment>
     BlockDiagonalMatrixTpl<Scalar, Options, Alignment>::ScalarIdentity(
       const Eigen::Index size, const Scalar & value)
+    {
+      BlockDiagonalMatrixTpl res;
+      res.rebuildScalarIdentity(size, value);
+      return res;
+    }
+
+    template<typename Scalar, int Options, std::size_t Alignment>
+    void BlockDiagonalMatrixTpl<Scalar, Options, Alignment>::rebuildScalarIdentity(
+      const Eigen::Index size, const Scalar & value)
     {
       typedef Eigen::Matrix<Scalar, 1, 1> M11;
       M11 value_mat = M11(value);
       const auto matrix_map = make_map<MatrixMap>(value_mat);
-      MatrixBlockElement block_info = {MatrixBlockType::ScalarIdentity, size, matrix_map};
-      const std::vector<MatrixBlockElement> input_block_pattern = {{block_info}};
-
-      return BlockDiagonalMatrixTpl(input_block_pattern);
+      const MatrixBlockElement block_info = {MatrixBlockType::ScalarIdentity, size, matrix_map};
+      init_or_rebuild(&block_info, 1);
     }
 
     template<typename Scalar, int Options, std::size_t Alignment>
@@ -619,19 +619,25 @@ namespace pinocchio
     /// etc.)
     DynamicMatrixStack joint_apparent_inertia;
 
+    /// \brief Optional buffers which are allocated, as a combination of DataFeature flags.
+    int features;
+
     PINOCCHIO_COMPILER_DIAGNOSTIC_PUSH
     PINOCCHIO_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
     ///
     /// \brief Default constructor of pinocchio::Data from a pinocchio::Model.
     ///
     /// \param[in] model The model structure of the rigid body system.
+    /// \param[in] data_features Optional buffers to allocate, as a combination of DataFeature
+    /// flags. By default, all the buffers are allocated.
     ///
-    explicit DataTpl(const Model & model);
+    explicit DataTpl(const Model & model, const int data_features = DATA_ALL_FEATURES);
 
     ///
     /// \brief Default constructor
     ///
     DataTpl()
+    : features(DATA_ALL_FEATURES)
     {
     }
 
@@ -642,6 +648,24 @@ namespace pinocchio
 
     PINOCCHIO_COMPILER_DIAGNOSTIC_POP
 
+    ///
+    /// \brief Returns true if all the given optional buffers are allocated.
+    ///
+    /// \param[in] data_features Combination of DataFeature flags.
+    ///
+    bool hasFeatures(const int data_features) const
+    {
+      return (features & data_features) == data_features;
+    }
+
+    ///
+    /// \brief Allocate the given optional buffers, if they are not already allocated.
+    ///
+    /// \param[in] model The model structure of the rigid body system.
+    /// \param[in] data_features Combination of DataFeature flags.
+    ///
+    void allocateFeatures(const Model & model, const int data_features);
+
   private:
     void computeLastChild(const Model & model); // TODO Remove when lastChild is removed
     void computeNvSubtree(const Model & model);
@@ -661,7 +685,8 @@ namespace pinocchio
   PINOCCHIO_COMPILER_DIAGNOSTIC_PUSH
   PINOCCHIO_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
   template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
-  DataTpl<Scalar, Options, JointCollectionTpl>::DataTpl(const Model & model)
+  DataTpl<Scalar, Options, JointCollectionTpl>::DataTpl(
+    const Model & model, const int data_features)
   : q_in(neutral(model))
   , v_in(VectorXs::Zero(model.nv))
   , a_in(VectorXs::Zero(model.nv))
@@ -687,9 +712,6 @@ namespace pinocchio
   , oMf((std::size_t)model.nframes, SE3::Identity())
   , Ycrb((std::size_t)model.njoints, Inertia::Zero())
   , dYcrb((std::size_t)model.njoints, Inertia::Zero())
-  , M(MatrixXs::Zero(model.nv, model.nv))
-  , Minv(MatrixXs::Zero(model.nv, model.nv))
-  , C(MatrixXs::Zero(model.nv, model.nv))
   , dHdq(Matrix6x::Zero(6, model.nv))
   , dFdq(Matrix6x::Zero(6, model.nv))
   , dFdv(Matrix6x::Zero(6, model.nv))
@@ -715,13 +737,11 @@ namespace pinocchio
   , hg(Force::Zero())
   , dhg(Force::Zero())
   , Ig(Inertia::Zero())
-  , Fcrb((std::size_t)model.njoints, Matrix6x::Zero(6, model.nv))
   , lastChild((std::size_t)model.njoints, -1)
   , nvSubtree((std::size_t)model.njoints, 0)
   , start_idx_v_fromRow((std::size_t)model.nvExtended, -1)
   , end_idx_v_fromRow((std::size_t)model.nvExtended, -1)
   , idx_vExtended_to_idx_v_fromRow((std::size_t)model.nvExtended, -1)
-  , U(MatrixXs::Identity(model.nv, model.nv))
   , D(VectorXs::Zero(model.nv))
   , Dinv(VectorXs::Zero(model.nv))
   , tmp(VectorXs::Zero(model.nv))
@@ -738,11 +758,6 @@ namespace pinocchio
   , dVdq(Matrix6x::Zero(6, model.nv))
   , dAdq(Matrix6x::Zero(6, model.nv))
   , dAdv(Matrix6x::Zero(6, model.nv))
-  , dtau_dq(RowMatrixXs::Zero(model.nv, model.nv))
-  , dtau_dv(RowMatrixXs::Zero(model.nv, model.nv))
-  , ddq_dq(RowMatrixXs::Zero(model.nv, model.nv))
-  , ddq_dv(RowMatrixXs::Zero(model.nv, model.nv))
-  , ddq_dtau(RowMatrixXs::Zero(model.nv, model.nv))
   , iMf((std::size_t)model.njoints, SE3::Identity())
   , com((std::size_t)model.njoints, Vector3::Zero())
   , vcom((std::size_t)model.njoints, Vector3::Zero())
@@ -757,15 +772,10 @@ namespace pinocchio
   , lambda_c()
   , lambda_c_prox()
   , diff_lambda_c()
-  , sDUiJt(MatrixXs::Zero(model.nv, model.nv))
   , torque_residual(VectorXs::Zero(model.nv))
   , dq_after(VectorXs::Zero(model.nv))
   , impulse_c()
-  , staticRegressor(Matrix3x::Zero(3, 4 * (model.njoints - 1)))
   , bodyRegressor(BodyRegressorType::Zero())
-  , jointTorqueRegressor(MatrixXs::Zero(model.nv, 10 * (model.njoints - 1)))
-  , kineticEnergyRegressor(RowVectorXs::Zero(10 * (model.njoints - 1)))
-  , potentialEnergyRegressor(RowVectorXs::Zero(10 * (model.njoints - 1)))
   , KA((std::size_t)model.njoints, Matrix6x::Zero(6, 0))
   , LA((std::size_t)model.njoints, MatrixXs::Zero(0, 0))
   , lA((std::size_t)model.njoints, VectorXs::Zero(0))
@@ -773,13 +783,8 @@ namespace pinocchio
   , par_cons_ind((std::size_t)model.njoints, 0)
   , a_bias((std::size_t)model.njoints, Motion::Zero())
   , KAS((std::size_t)model.njoints, MatrixXs::Zero(0, 0))
-  , kinematic_hessians(6, model.nv, model.nv)
   , constraint_chol()
   , contact_chol(constraint_chol)
-  , d2tau_dqdq(model.nv, model.nv, model.nv)
-  , d2tau_dvdv(model.nv, model.nv, model.nv)
-  , d2tau_dqdv(model.nv, model.nv, model.nv)
-  , d2tau_dadq(model.nv, model.nv, model.nv)
   , extended_motion_propagator((std::size_t)model.njoints, Matrix6::Zero())
   , extended_motion_propagator2((std::size_t)model.njoints, Matrix6::Zero())
   , spatial_inv_inertia((std::size_t)model.njoints, Matrix6::Zero())
@@ -796,6 +801,7 @@ namespace pinocchio
   , joint_apparent_inertia(
       std::size_t(model.njoints),
       std::size_t(PINOCCHIO_SQUARE(*std::max_element(model.nvs.begin(), model.nvs.end()))))
+  , features(0)
   {
     typedef typename Model::JointIndex JointIndex;
 
@@ -811,9 +817,8 @@ namespace pinocchio
     }
     joints_augmented = joints;
 
-    /* Init for CRBA */
-    M.setZero();
-    Minv.setZero();
+    /* Allocate the optional buffers */
+    allocateFeatures(model, data_features);
 
     computeLastChild(model);
 
@@ -825,15 +830,59 @@ namespace pinocchio
 
     /* Init universe states relatively to itself */
     a_gf[0] = -model.gravity;
-
-    kinematic_hessians.setZero();
-    d2tau_dqdq.setZero();
-    d2tau_dvdv.setZero();
-    d2tau_dqdv.setZero();
-    d2tau_dadq.setZero();
   }
   PINOCCHIO_COMPILER_DIAGNOSTIC_POP
 
+  template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
+  void DataTpl<Scalar, Options, JointCollectionTpl>::allocateFeatures(
+    const Model & model, const int data_features)
+  {
+    const int new_features = data_features & ~features;
+
+    if (new_features & DATA_MASS_MATRIX)
+    {
+      M.setZero(model.nv, model.nv);
+      Minv.setZero(model.nv, model.nv);
+      C.setZero(model.nv, model.nv);
+      Fcrb.assign((std::size_t)model.njoints, Matrix6x::Zero(6, model.nv));
+      U.setIdentity(model.nv, model.nv);
+      sDUiJt.setZero(model.nv, model.nv);
+    }
+
+    if (new_features & DATA_DERIVATIVES)
+    {
+      dtau_dq.setZero(model.nv, model.nv);
+      dtau_dv.setZero(model.nv, model.nv);
+      ddq_dq.setZero(model.nv, model.nv);
+      ddq_dv.setZero(model.nv, model.nv);
+      ddq_dtau.setZero(model.nv, model.nv);
+    }
+
+    if (new_features & DATA_SECOND_ORDER_DERIVATIVES)
+    {
+      kinematic_hessians.resize(6, model.nv, model.nv);
+      kinematic_hessians.setZero();
+      d2tau_dqdq.resize(model.nv, model.nv, model.nv);
+      d2tau_dqdq.setZero();
+      d2tau_dvdv.resize(model.nv, model.nv, model.nv);
+      d2tau_dvdv.setZero();
+      d2tau_dqdv.resize(model.nv, model.nv, model.nv);
+      d2tau_dqdv.setZero();
+      d2tau_dadq.resize(model.nv, model.nv, model.nv);
+      d2tau_dadq.setZero();
+    }
+
+    if (new_features & DATA_REGRESSORS)
+    {
+      staticRegressor.setZero(3, 4 * (model.njoints - 1));
+      jointTorqueRegressor.setZero(model.nv, 10 * (model.njoints - 1));
+      kineticEnergyRegressor.setZero(10 * (model.njoints - 1));
+      potentialEnergyRegressor.setZero(10 * (model.njoints - 1));
+    }
+
+    features |= new_features;
+  }
+
   PINOCCHIO_COMPILER_DIAGNOSTIC_PUSH
   PINOCCHIO_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
   template<typename Scalar, int Options, template<typename, int> class JointCollectionTpl>
@@ -1057,7 +1106,8 @@ namespace pinocchio
       && data1.joint_cross_coupling == data2.joint_cross_coupling
       && data1.joint_coupling_info == data2.joint_coupling_info
       && data1.projected_joint_cross_coupling == data2.projected_joint_cross_coupling
-      && data1.joint_apparent_inertia == data2.joint_apparent_inertia;
+      && data1.joint_apparent_inertia == data2.joint_apparent_inertia
+      && data1.features == data2.features;
 
     // operator== for Eigen::Tensor provides an Expression which might be not evaluated as a boolean
     value &= Tensor<bool, 0>((data1.kinematic_hessians == data2.kinematic_hessians).all())(0)
@@ -1096,7 +1146,8 @@ namespace pinocchio
   DataTpl<context::Scalar, context::Options, JointCollectionDefaultTpl>::DataTpl();
 
   extern template PINOCCHIO_EXPLICIT_INSTANTIATION_DECLARATION_DLLAPI
-  DataTpl<context::Scalar, context::Options, JointCollectionDefaultTpl>::DataTpl(const Model &);
+  DataTpl<context::Scalar, context::Options, JointCollectionDefaultTpl>::DataTpl(
+    const Model &, const int);
 
 } // namespace pinocchio
 
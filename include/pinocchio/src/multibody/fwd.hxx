@@ -101,6 +101,31 @@ namespace pinocchio
     LOCAL = 1,
   };
 
+  ///
+  /// \brief Groups of optional buffers of DataTpl, to be combined as a bit mask.
+  ///
+  /// The buffers required by the kinematics, RNEA and ABA are always allocated. A DataTpl
+  /// constructed without some of the features cannot be used by the algorithms relying on them
+  /// until they are allocated with DataTpl::allocateFeatures.
+  enum DataFeature
+  {
+    /// Joint space inertia matrix and its decompositions (DataTpl::M, Minv, C, U, Fcrb and
+    /// sDUiJt), used by CRBA, Cholesky, computeMinverse and the contact dynamics.
+    DATA_MASS_MATRIX = 1 << 0,
+    /// Partial derivatives of RNEA and ABA (DataTpl::dtau_dq, dtau_dv, ddq_dq, ddq_dv and
+    /// ddq_dtau). The derivative algorithms also require DATA_MASS_MATRIX.
+    DATA_DERIVATIVES = 1 << 1,
+    /// Kinematic Hessians and second order derivatives of RNEA (DataTpl::kinematic_hessians and
+    /// d2tau_*).
+    DATA_SECOND_ORDER_DERIVATIVES = 1 << 2,
+    /// Regressors (DataTpl::staticRegressor, jointTorqueRegressor, kineticEnergyRegressor and
+    /// potentialEnergyRegressor).
+    DATA_REGRESSORS = 1 << 3,
+    /// All the features.
+    DATA_ALL_FEATURES =
+      DATA_MASS_MATRIX | DATA_DERIVATIVES | DATA_SECOND_ORDER_DERIVATIVES | DATA_REGRESSORS
+  };
+
   // Forward declaration needed for Model::check
   template<class D>
   struct AlgorithmCheckerBase;
@@ -30,11 +30,15 @@ namespace pinocchio
     ///
     /// \param[in] model input model used for parallel computations.
     /// \param[in] pool_size total size of the pool.
+    /// \param[in] data_features Optional buffers of the datas, as a combination of DataFeature
+    /// flags (see DataTpl::DataTpl).
     ///
     explicit ModelPoolTpl(
-      const Model & model, const size_t pool_size = (size_t)omp_get_max_threads())
+      const Model & model,
+      const size_t pool_size = (size_t)omp_get_max_threads(),
+      const int data_features = DATA_ALL_FEATURES)
     : m_models(pool_size, model)
-    , m_datas(pool_size, Data(model))
+    , m_datas(pool_size, Data(model, data_features))
     {
     }
 
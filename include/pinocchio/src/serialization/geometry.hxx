@@ -102,5 +102,26 @@ namespace boost
       ar & make_nvp("outerObjects", geom_data.outerObjects);
     }
 
+    template<class Archive>
+    void serialize(
+      Archive & ar, pinocchio::CollisionPairPruningCache & cache, const unsigned int /*version*/)
+    {
+      ar & make_nvp("lowerPositionLimit", cache.lowerPositionLimit);
+      ar & make_nvp("upperPositionLimit", cache.upperPositionLimit);
+      ar & make_nvp("geometry_names", cache.geometry_names);
+      ar & make_nvp("security_margin", cache.security_margin);
+      ar & make_nvp("pruned_pairs", cache.pruned_pairs);
+    }
+
+    template<class Archive>
+    void serialize(
+      Archive & ar, pinocchio::SignedDistanceField & field, const unsigned int /*version*/)
+    {
+      ar & make_nvp("origin", field.origin);
+      ar & make_nvp("resolution", field.resolution);
+      ar & make_nvp("sizes", field.sizes);
+      ar & make_nvp("values", field.values);
+    }
+
   } // namespace serialization
 } // namespace boost
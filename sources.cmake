@@ -14,6 +14,7 @@ set(${PROJECT_NAME}_CORE_PUBLIC_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/check-model.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/check.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/cholesky.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/compiled-model.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/compute-all-terms.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/constrained-dynamics-derivatives.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/constrained-dynamics.hpp
@@ -28,6 +29,7 @@ set(${PROJECT_NAME}_CORE_PUBLIC_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/delassus.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/diagonal-preconditioner.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/energy.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/fixed-model.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/frames-derivatives.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/frames.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/fwd.hpp
@@ -48,6 +50,7 @@ set(${PROJECT_NAME}_CORE_PUBLIC_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/rnea-second-order-derivatives.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/rnea.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/solvers/admm-solver.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/solvers/admm-solver-mixed-precision.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/solvers/anderson-acceleration.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/solvers/constraint-solver-base.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/solvers/constraint-solver-utils.hpp
@@ -68,6 +71,7 @@ set(${PROJECT_NAME}_CORE_PUBLIC_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/geometry.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/geometry/fwd.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/macros.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/math/batch-scalar.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/math/fwd.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/math/multiprecision-mpfr.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/math/multiprecision.hpp
@@ -139,7 +143,10 @@ set(${PROJECT_NAME}_CORE_PRIVATE_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/instance-filter.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/geometry-object.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/geometry.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/geometry-placements-batch.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/geometry-object-filter.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/collision-pair-pruning.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/geometry/signed-distance-field.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/delassus-operator-preconditioned.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/crba.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/kinematics.hxx
@@ -191,6 +198,7 @@ set(${PROJECT_NAME}_CORE_PRIVATE_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/math/matrix-block-type.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/math/comparison-operators.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/math/multiprecision.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/math/batch-scalar.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/joint-configuration.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/center-of-mass.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/spatial/se3-tpl-interpolate.hxx
@@ -342,6 +350,8 @@ set(${PROJECT_NAME}_CORE_PRIVATE_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/aba.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/serialization/joints-transform.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/compute-all-terms.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/compiled-model.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/fixed-model.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/delassus-operator-rigid-body.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/center-of-mass-derivatives.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/check-base.hxx
@@ -358,6 +368,7 @@ set(${PROJECT_NAME}_CORE_PRIVATE_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/solvers/constraint-solver-base.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/solvers/pgs-solver.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/solvers/admm-solver.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/solvers/admm-solver-mixed-precision.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/solvers/constraint-solver-utils.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/multibody/joint/joint-translation.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/multibody/joint/joint-prismatic-unaligned.hxx
@@ -584,12 +595,26 @@ set(${PROJECT_NAME}_CPPADCG_DEPRECATED_HEADERS
 
 # OpenMP dependent algorithm
 set(${PROJECT_NAME}_PARALLEL_PUBLIC_HEADERS
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/aba-derivatives.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/aba.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/admm-solver.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/constrained-dynamics-derivatives.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/constraint-cholesky.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/executor.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/pgs-solver.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/rnea-derivatives.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/algorithm/parallel/rnea.hpp
 )
 
 set(${PROJECT_NAME}_PARALLEL_PRIVATE_HEADERS
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/aba-derivatives.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/aba.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/admm-solver.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/constrained-dynamics-derivatives.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/constraint-cholesky.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/executor.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/pgs-solver.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/rnea-derivatives.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/algorithm/parallel/rnea.hxx
 )
 
@@ -600,7 +625,9 @@ set(${PROJECT_NAME}_PARALLEL_DEPRECATED_HEADERS
 # Collision
 set(${PROJECT_NAME}_COLLISION_TEMPLATE_INSTANTIATION_SOURCES
     ${PROJECT_SOURCE_DIR}/src/collision/collision.cpp
+    ${PROJECT_SOURCE_DIR}/src/collision/collision-pair-pruning.cpp
     ${PROJECT_SOURCE_DIR}/src/collision/distance.cpp
+    ${PROJECT_SOURCE_DIR}/src/collision/sphere-tree.cpp
 )
 
 set(${PROJECT_NAME}_COLLISION_PUBLIC_HEADERS
@@ -610,9 +637,12 @@ set(${PROJECT_NAME}_COLLISION_PUBLIC_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/broadphase.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/coal-pinocchio-conversions.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/collision.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/collision-pair-pruning.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/distance.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/pool/broadphase-manager.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/pool/fwd.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/signed-distance-field.hpp
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/sphere-tree.hpp
     ${PROJECT_SOURCE_DIR}/include/pinocchio/collision/tree-broadphase-manager.hpp
 )
 
@@ -621,9 +651,12 @@ set(${PROJECT_NAME}_COLLISION_PRIVATE_HEADERS
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/broadphase-manager.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/broadphase.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/collision.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/collision-pair-pruning.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/distance.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/pool/broadphase-manager.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/pool/fwd.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/signed-distance-field.hxx
+    ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/sphere-tree.hxx
     ${PROJECT_SOURCE_DIR}/include/pinocchio/src/collision/tree-broadphase-manager.hxx
 )
 
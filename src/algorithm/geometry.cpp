@@ -26,6 +26,22 @@ namespace pinocchio
   updateGeometryPlacements<context::Scalar, context::Options, JointCollectionDefaultTpl>(
     const Model &, const Data &, const GeometryModel &, GeometryData &);
 
+  template PINOCCHIO_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI void
+  updateGeometryPlacements<context::Scalar, context::Options, JointCollectionDefaultTpl>(
+    const Model &, const Data &, const GeometryModel &, GeometryData &, GeometryPlacementsBatch &);
+
+  template PINOCCHIO_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI void updateGeometryPlacements<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    GeometryPlacementsBatch &,
+    const Eigen::MatrixBase<context::VectorXs> &);
+
 } // namespace pinocchio
 
 #endif // PINOCCHIO_SKIP_ALGORITHM_GEOMETRY
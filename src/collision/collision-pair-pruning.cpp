@@ -0,0 +1,20 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/src/context/template-instantiation.hxx"
+#include "pinocchio/collision/collision-pair-pruning.hpp"
+
+namespace pinocchio
+{
+
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI std::size_t
+  computeCollisionPairPruning<context::Scalar, context::Options, JointCollectionDefaultTpl>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    CollisionPairPruningCache &,
+    const CollisionPairPruningSettings &);
+
+} // namespace pinocchio
@@ -20,6 +20,35 @@ namespace pinocchio
     const Eigen::MatrixBase<context::VectorXs> &,
     const bool stopAtFirstCollision);
 
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI bool
+  computeCollisionsWithTemporalCoherence<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const bool stopAtFirstCollision);
+
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI bool
+  computeContinuousCollisions<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    context::Scalar &,
+    const context::Scalar);
+
   template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI void
   computeBodyRadius<context::Scalar, context::Options, JointCollectionDefaultTpl>(
     const Model &, const GeometryModel &, GeometryData &);
@@ -16,4 +16,30 @@ namespace pinocchio
     GeometryData &,
     const Eigen::MatrixBase<context::VectorXs> &);
 
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI void
+  computeDistancesDerivatives<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::MatrixXs>(
+    const Model &,
+    const Data &,
+    const GeometryModel &,
+    const GeometryData &,
+    const Eigen::MatrixBase<context::MatrixXs> &);
+
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI std::size_t
+  computeDistancesDerivatives<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs,
+    context::MatrixXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const Eigen::MatrixBase<context::MatrixXs> &);
+
 } // namespace pinocchio
@@ -0,0 +1,27 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/src/context/template-instantiation.hxx"
+#include "pinocchio/collision/sphere-tree.hpp"
+
+namespace pinocchio
+{
+
+  template PINOCCHIO_COLLISION_EXPLICIT_INSTANTIATION_DEFINITION_DLLAPI bool
+  computeCollisionsWithSphereTrees<
+    context::Scalar,
+    context::Options,
+    JointCollectionDefaultTpl,
+    context::VectorXs>(
+    const Model &,
+    Data &,
+    const GeometryModel &,
+    GeometryData &,
+    const SphereTreeModel &,
+    SphereTreeData &,
+    const Eigen::MatrixBase<context::VectorXs> &,
+    const bool,
+    const bool);
+
+} // namespace pinocchio
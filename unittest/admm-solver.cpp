@@ -6,6 +6,7 @@
 #include "pinocchio/algorithm/joint-configuration.hpp"
 #include "pinocchio/constraints.hpp"
 #include "pinocchio/algorithm/solvers/admm-solver.hpp"
+#include "pinocchio/algorithm/solvers/admm-solver-mixed-precision.hpp"
 #include "pinocchio/algorithm/aba.hpp"
 #include "pinocchio/algorithm/crba.hpp"
 
@@ -1430,6 +1431,106 @@ BOOST_AUTO_TEST_CASE(joint_limit_composite)
   }
 }
 
+BOOST_AUTO_TEST_CASE(mixed_precision_stack_of_boxes)
+{
+  const std::vector<double> masses = {1e-1, 1., 1e1, 1e2};
+
+  Model model;
+  typedef PointContactConstraintModel ConstraintModel;
+  typedef ConstraintModel::ConstraintData ConstraintData;
+  std::vector<ConstraintModel> constraint_models;
+  buildStackOfCubesModel(masses, model, constraint_models);
+  Data data(model);
+
+  std::vector<ConstraintData> constraint_datas;
+  for (const auto & cm : constraint_models)
+    constraint_datas.push_back(cm.createData());
+
+  const SE3::Vector3 box_dims = SE3::Vector3::Ones();
+  Eigen::VectorXd q0 = neutral(model);
+  for (Eigen::Index i = 0; i < Eigen::Index(masses.size()); i++)
+    q0[7 * i + 2] = double(i) * box_dims[2] + box_dims[2] / 2;
+  const Eigen::VectorXd v0 = Eigen::VectorXd::Zero(model.nv);
+  const Eigen::VectorXd tau0 = Eigen::VectorXd::Zero(model.nv);
+  const double dt = 1e-3;
+
+  const Eigen::VectorXd v_free = v0 + dt * aba(model, data, q0, v0, tau0, Convention::WORLD);
+  data.q_in = q0;
+  calc(model, data, constraint_models, constraint_datas);
+
+  crba(model, data, q0, Convention::WORLD);
+  ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+  chol.compute(model, data, constraint_models, constraint_datas, 1e-10);
+  const Eigen::MatrixXd delassus_matrix = chol.getDelassusOperatorCholeskyExpression().matrix();
+
+  Eigen::MatrixXd constraint_jacobian = Eigen::MatrixXd::Zero(delassus_matrix.rows(), model.nv);
+  getConstraintsJacobian(model, data, constraint_models, constraint_datas, constraint_jacobian);
+  const Eigen::VectorXd g = constraint_jacobian * v_free;
+
+  ADMMSolverSettings settings;
+  settings.max_iterations = 10000;
+  settings.absolute_feasibility_tol = 1e-10;
+  settings.relative_feasibility_tol = 1e-12;
+  settings.absolute_complementarity_tol = 1e-10;
+  settings.relative_complementarity_tol = 1e-12;
+
+  // Reference solution in double precision
+  DelassusOperatorDense delassus(delassus_matrix);
+  ADMMConstraintSolver admm_solver;
+  ADMMSolverResult result_ref;
+  BOOST_CHECK(
+    admm_solver.solve(delassus, g, constraint_models, constraint_datas, settings, result_ref));
+  BOOST_CHECK(result_ref.residual <= 1e-8);
+  Eigen::VectorXd impulses_ref(g.size());
+  result_ref.retrieveConstraintImpulses(impulses_ref);
+
+  // Low precision problem. The friction cones of the contacts do not depend on their datas.
+  typedef PointContactConstraintModelTpl<float> ConstraintModelf;
+  typedef ConstraintModelf::ConstraintData ConstraintDataf;
+  std::vector<ConstraintModelf> constraint_models_f;
+  std::vector<ConstraintDataf> constraint_datas_f;
+  for (const auto & cm : constraint_models)
+  {
+    constraint_models_f.push_back(cm.cast<float>());
+    constraint_datas_f.push_back(constraint_models_f.back().createData());
+  }
+  DelassusOperatorDenseTpl<float> delassus_f(delassus_matrix.cast<float>());
+
+  ADMMMixedPrecisionConstraintSolver mixed_solver;
+  ADMMSolverResult result;
+  const bool has_converged = mixed_solver.solve(
+    delassus_f, constraint_models_f, constraint_datas_f, delassus, g, constraint_models,
+    constraint_datas, settings, result);
+  BOOST_CHECK(has_converged);
+  BOOST_CHECK(mixed_solver.low_precision_result.isValid());
+  BOOST_CHECK(mixed_solver.low_precision_result.iterations > 0);
+  BOOST_CHECK(result.residual <= 1e-8);
+
+  Eigen::VectorXd impulses(g.size()), velocities(g.size());
+  result.retrieveConstraintImpulses(impulses);
+  result.retrieveConstraintVelocities(velocities);
+  BOOST_CHECK(velocities.isZero(1e-8));
+  const Force::Vector3 f_tot = computeFtotOfFirstBoxInStackOfBoxes(impulses);
+  const Force::Vector3 f_tot_ref = computeFtotOfFirstBoxInStackOfBoxes(impulses_ref);
+  BOOST_CHECK(f_tot.isApprox(f_tot_ref, 1e-6));
+
+  // The low precision solve is warm-started with the previous solution
+  result.setConstraintImpulseGuess(impulses);
+  BOOST_CHECK(mixed_solver.solve(
+    delassus_f, constraint_models_f, constraint_datas_f, delassus, g, constraint_models,
+    constraint_datas, settings, result));
+  BOOST_CHECK(result.residual <= 1e-8);
+
+  // Sizes of the low and high precision problems must agree
+  constraint_models_f.pop_back();
+  constraint_datas_f.pop_back();
+  BOOST_CHECK_THROW(
+    mixed_solver.solve(
+      delassus_f, constraint_models_f, constraint_datas_f, delassus, g, constraint_models,
+      constraint_datas, settings, result),
+    std::invalid_argument);
+}
+
 BOOST_AUTO_TEST_CASE(test_copy_result)
 {
   const Eigen::Index n = 6;
@@ -0,0 +1,163 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/math/batch-scalar.hpp"
+
+#include "pinocchio/multibody/sample-models.hpp"
+
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/rnea.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+static const int batch_size = 4;
+typedef BatchScalarTpl<double, batch_size> BatchScalar;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_basic)
+{
+  BatchScalar x(Eigen::Array4d(1., -2., 3., 0.5));
+  BatchScalar y(2.);
+
+  BOOST_CHECK(((x + y).lanes() == Eigen::Array4d(3., 0., 5., 2.5)).all());
+  BOOST_CHECK(((x * 2).lanes() == Eigen::Array4d(2., -4., 6., 1.)).all());
+  BOOST_CHECK(((1. - x).lanes() == Eigen::Array4d(0., 3., -2., 0.5)).all());
+  BOOST_CHECK(((x / y).lanes() == Eigen::Array4d(0.5, -1., 1.5, 0.25)).all());
+
+  for (int k = 0; k < batch_size; ++k)
+  {
+    BOOST_CHECK(math::sin(x).lane(k) == std::sin(x.lane(k)));
+    BOOST_CHECK(math::cos(x).lane(k) == std::cos(x.lane(k)));
+    BOOST_CHECK(math::atan2(x, y).lane(k) == std::atan2(x.lane(k), y.lane(k)));
+    BOOST_CHECK(math::fabs(x).lane(k) == std::fabs(x.lane(k)));
+  }
+
+  // Comparisons hold for all the lanes
+  BOOST_CHECK(y > BatchScalar(1.));
+  BOOST_CHECK(!(x > BatchScalar(0.)));
+  BOOST_CHECK(x != y);
+
+  // Lane-wise selection
+  const BatchScalar selected = internal::if_then_else(internal::GT, x, BatchScalar(0.), x, -x);
+  BOOST_CHECK((selected.lanes() == x.lanes().abs()).all());
+
+  BOOST_CHECK(BatchScalar(PI<BatchScalar>()) == BatchScalar(PI<double>()));
+}
+
+BOOST_AUTO_TEST_CASE(test_inverse)
+{
+  typedef Eigen::Matrix<BatchScalar, 6, 6> Matrix6Batch;
+
+  Matrix6Batch mat, mat_inv;
+  Eigen::Matrix<double, 6, 6> mats[batch_size];
+  for (int k = 0; k < batch_size; ++k)
+  {
+    const Eigen::Matrix<double, 6, 6> A = Eigen::Matrix<double, 6, 6>::Random();
+    mats[k] = A * A.transpose() + Eigen::Matrix<double, 6, 6>::Identity();
+    for (int i = 0; i < 6; ++i)
+      for (int j = 0; j < 6; ++j)
+        mat(i, j).lane(k) = mats[k](i, j);
+  }
+
+  internal::CallCorrectMatrixInverseAccordingToScalar<BatchScalar>::run(mat, mat_inv);
+
+  for (int k = 0; k < batch_size; ++k)
+  {
+    Eigen::Matrix<double, 6, 6> mat_inv_k;
+    for (int i = 0; i < 6; ++i)
+      for (int j = 0; j < 6; ++j)
+        mat_inv_k(i, j) = mat_inv(i, j).lane(k);
+    BOOST_CHECK(mat_inv_k.isApprox(mats[k].inverse()));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_pack_unpack)
+{
+  typedef Eigen::Matrix<BatchScalar, Eigen::Dynamic, 1> VectorBatch;
+
+  const Eigen::MatrixXd batch = Eigen::MatrixXd::Random(10, batch_size);
+  VectorBatch packed(10);
+  packBatch(batch, packed);
+
+  Eigen::MatrixXd unpacked(10, batch_size);
+  unpackBatch(packed, unpacked);
+  BOOST_CHECK(unpacked == batch);
+
+  BOOST_CHECK_THROW(packBatch(Eigen::MatrixXd::Zero(10, batch_size + 1), packed), std::exception);
+  BOOST_CHECK_THROW(packBatch(Eigen::MatrixXd::Zero(9, batch_size), packed), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(test_algorithms)
+{
+  Model model;
+  buildModels::humanoidRandom(model);
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+  Data data(model);
+
+  typedef ModelTpl<BatchScalar> ModelBatch;
+  typedef DataTpl<BatchScalar> DataBatch;
+
+  ModelBatch model_batch = model.cast<BatchScalar>();
+  DataBatch data_batch(model_batch);
+
+  Eigen::MatrixXd q(model.nq, batch_size), v(model.nv, batch_size), a(model.nv, batch_size),
+    tau(model.nv, batch_size);
+  for (int k = 0; k < batch_size; ++k)
+    q.col(k) = randomConfiguration(model);
+  v.setRandom();
+  a.setRandom();
+  tau.setRandom();
+
+  ModelBatch::ConfigVectorType q_batch(model.nq);
+  ModelBatch::TangentVectorType v_batch(model.nv), a_batch(model.nv), tau_batch(model.nv);
+  packBatch(q, q_batch);
+  packBatch(v, v_batch);
+  packBatch(a, a_batch);
+  packBatch(tau, tau_batch);
+
+  Eigen::MatrixXd res(model.nv, batch_size);
+
+  forwardKinematics(model_batch, data_batch, q_batch, v_batch);
+  for (int k = 0; k < batch_size; ++k)
+  {
+    forwardKinematics(model, data, q.col(k), v.col(k));
+    for (JointIndex joint_id = 1; joint_id < (JointIndex)model.njoints; ++joint_id)
+    {
+      Eigen::Matrix<double, 3, 1> translation;
+      for (int i = 0; i < 3; ++i)
+        translation[i] = data_batch.oMi[joint_id].translation()[i].lane(k);
+      BOOST_CHECK(translation.isApprox(data.oMi[joint_id].translation()));
+    }
+  }
+
+  // Inverse Dynamics
+  rnea(model_batch, data_batch, q_batch, v_batch, a_batch);
+  unpackBatch(data_batch.tau, res);
+  for (int k = 0; k < batch_size; ++k)
+  {
+    rnea(model, data, q.col(k), v.col(k), a.col(k));
+    BOOST_CHECK(res.col(k).isApprox(data.tau));
+  }
+
+  // Forward Dynamics
+  for (const Convention convention : {Convention::WORLD, Convention::LOCAL})
+  {
+    aba(model_batch, data_batch, q_batch, v_batch, tau_batch, convention);
+    unpackBatch(data_batch.ddq, res);
+    for (int k = 0; k < batch_size; ++k)
+    {
+      aba(model, data, q.col(k), v.col(k), tau.col(k), convention);
+      BOOST_CHECK(res.col(k).isApprox(data.ddq));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
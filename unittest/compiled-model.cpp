@@ -0,0 +1,90 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/multibody/sample-models.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/compiled-model.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_compiled_model_program)
+{
+  Model model;
+  buildModels::humanoidRandom(model, true);
+
+  const CompiledModel compiled_model(model);
+  BOOST_CHECK(compiled_model.njoints == JointIndex(model.njoints));
+
+  // The segments cover all the joints, in the topological order of the model
+  std::size_t num_joints = 0;
+  for (std::size_t s = 0; s < compiled_model.program.size(); ++s)
+  {
+    const CompiledModel::Segment & segment = compiled_model.program[s];
+    BOOST_CHECK(segment.begin < segment.end);
+    if (s > 0)
+      BOOST_CHECK(segment.joint_type != compiled_model.program[s - 1].joint_type);
+    num_joints += segment.end - segment.begin;
+  }
+  BOOST_CHECK(num_joints == std::size_t(model.njoints - 1));
+
+  // The free flyer is the first joint and has its own array
+  BOOST_CHECK(std::get<14>(compiled_model.joints).size() == 1);
+  BOOST_CHECK(std::get<14>(compiled_model.joints)[0].id() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(test_compiled_model_algorithms)
+{
+  // With a free flyer, or with a composite root joint going through the generic joint
+  for (int using_ff = 0; using_ff < 2; ++using_ff)
+  {
+    Model model;
+    buildModels::humanoidRandom(model, using_ff == 1);
+    model.lowerPositionLimit.head<3>().fill(-1.);
+    model.upperPositionLimit.head<3>().fill(1.);
+    model.armature = Eigen::VectorXd::Random(model.nv) + Eigen::VectorXd::Ones(model.nv);
+
+    const CompiledModel compiled_model(model);
+    Data data(model), data_compiled(model);
+
+    for (int i = 0; i < 10; ++i)
+    {
+      const Eigen::VectorXd q = randomConfiguration(model);
+      const Eigen::VectorXd v = Eigen::VectorXd::Random(model.nv);
+      const Eigen::VectorXd a = Eigen::VectorXd::Random(model.nv);
+
+      forwardKinematics(model, data, q);
+      forwardKinematics(compiled_model, model, data_compiled, q);
+      for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+      {
+        BOOST_CHECK(data_compiled.oMi[joint_id].isApprox(data.oMi[joint_id]));
+        BOOST_CHECK(data_compiled.liMi[joint_id].isApprox(data.liMi[joint_id]));
+      }
+
+      const Eigen::VectorXd tau = rnea(model, data, q, v, a);
+      BOOST_CHECK(rnea(compiled_model, model, data_compiled, q, v, a).isApprox(tau));
+
+      const Eigen::VectorXd ddq = aba(model, data, q, v, tau, Convention::LOCAL);
+      BOOST_CHECK(aba(compiled_model, model, data_compiled, q, v, tau).isApprox(ddq));
+      BOOST_CHECK(data_compiled.ddq.isApprox(a));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_compiled_model_inconsistent)
+{
+  Model model, other_model;
+  buildModels::humanoidRandom(model, true);
+  buildModels::manipulator(other_model);
+  Data data(model);
+
+  const CompiledModel compiled_model(other_model);
+  const Eigen::VectorXd q = neutral(model);
+  BOOST_CHECK_THROW(forwardKinematics(compiled_model, model, data, q), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -1661,6 +1661,162 @@ BOOST_AUTO_TEST_CASE(constraint_cholesky_updateDamping)
   }
 }
 
+BOOST_AUTO_TEST_CASE(constraint_cholesky_insert_remove_constraint)
+{
+  using namespace Eigen;
+  using namespace pinocchio;
+
+  pinocchio::Model model;
+  pinocchio::buildModels::humanoidRandom(model, true);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+  VectorXd q = randomConfiguration(model);
+
+  const std::string RF = "rleg6_joint";
+  const std::string LF = "lleg6_joint";
+  const std::string RA = "rarm6_joint";
+
+  std::vector<RigidConstraintModel> contact_models;
+  std::vector<RigidConstraintData> contact_datas;
+  RigidConstraintModel ci_RF(CONTACT_6D, model, model.getJointId(RF), LOCAL);
+  contact_models.push_back(ci_RF);
+  contact_datas.push_back(RigidConstraintData(ci_RF));
+  RigidConstraintModel ci_LF(CONTACT_6D, model, model.getJointId(LF), LOCAL);
+  contact_models.push_back(ci_LF);
+  contact_datas.push_back(RigidConstraintData(ci_LF));
+  RigidConstraintModel ci_RA(CONTACT_3D, model, model.getJointId(RA), LOCAL);
+  RigidConstraintData cd_RA(ci_RA);
+
+  Data data(model);
+  crba(model, data, q, Convention::WORLD);
+  computeJointJacobians(model, data, q);
+  data.q_in = q;
+  calc(model, data, contact_models, contact_datas);
+
+  const double mu = 1e-4;
+  ConstraintCholeskyDecomposition constraint_chol_decomposition(mu);
+  constraint_chol_decomposition.rebuild(model, data, contact_models, contact_datas);
+  constraint_chol_decomposition.compute(model, data, contact_models, contact_datas);
+
+  // Insertion in the middle of the constraint vector
+  contact_models.insert(contact_models.begin() + 1, ci_RA);
+  contact_datas.insert(contact_datas.begin() + 1, cd_RA);
+  calc(model, data, contact_models, contact_datas);
+  constraint_chol_decomposition.insertConstraint(model, data, contact_models, contact_datas, 1);
+  BOOST_CHECK(!constraint_chol_decomposition.isDirty());
+  BOOST_CHECK(constraint_chol_decomposition.constraintDim() == 15);
+
+  {
+    ConstraintCholeskyDecomposition constraint_chol_decomposition_ref(mu);
+    constraint_chol_decomposition_ref.rebuild(model, data, contact_models, contact_datas);
+    constraint_chol_decomposition_ref.compute(model, data, contact_models, contact_datas);
+
+    BOOST_CHECK(constraint_chol_decomposition.D.isApprox(constraint_chol_decomposition_ref.D));
+    BOOST_CHECK(
+      constraint_chol_decomposition.Dinv.isApprox(constraint_chol_decomposition_ref.Dinv));
+    BOOST_CHECK(constraint_chol_decomposition.U.isApprox(constraint_chol_decomposition_ref.U));
+    BOOST_CHECK(constraint_chol_decomposition.getDamping().diagonal().isConstant(mu));
+  }
+
+  // Removal of the first constraint
+  constraint_chol_decomposition.removeConstraint(model, data, contact_models, 0);
+  contact_models.erase(contact_models.begin());
+  contact_datas.erase(contact_datas.begin());
+  BOOST_CHECK(constraint_chol_decomposition.constraintDim() == 9);
+
+  {
+    ConstraintCholeskyDecomposition constraint_chol_decomposition_ref(mu);
+    constraint_chol_decomposition_ref.rebuild(model, data, contact_models, contact_datas);
+    constraint_chol_decomposition_ref.compute(model, data, contact_models, contact_datas);
+
+    BOOST_CHECK(constraint_chol_decomposition.D.isApprox(constraint_chol_decomposition_ref.D));
+    BOOST_CHECK(
+      constraint_chol_decomposition.Dinv.isApprox(constraint_chol_decomposition_ref.Dinv));
+    BOOST_CHECK(constraint_chol_decomposition.U.isApprox(constraint_chol_decomposition_ref.U));
+
+    const Eigen::MatrixXd rhs = Eigen::MatrixXd::Random(constraint_chol_decomposition.size(), 2);
+    BOOST_CHECK(constraint_chol_decomposition.solve(rhs).isApprox(
+      constraint_chol_decomposition_ref.solve(rhs)));
+  }
+
+  // Removal of the last constraint
+  constraint_chol_decomposition.removeConstraint(model, data, contact_models, 1);
+  contact_models.pop_back();
+  contact_datas.pop_back();
+
+  {
+    ConstraintCholeskyDecomposition constraint_chol_decomposition_ref(mu);
+    constraint_chol_decomposition_ref.rebuild(model, data, contact_models, contact_datas);
+    constraint_chol_decomposition_ref.compute(model, data, contact_models, contact_datas);
+
+    BOOST_CHECK(constraint_chol_decomposition.D.isApprox(constraint_chol_decomposition_ref.D));
+    BOOST_CHECK(constraint_chol_decomposition.U.isApprox(constraint_chol_decomposition_ref.U));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(constraint_cholesky_rankUpdateDamping)
+{
+  using namespace Eigen;
+  using namespace pinocchio;
+
+  pinocchio::Model model;
+  pinocchio::buildModels::humanoidRandom(model, true);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+  VectorXd q = randomConfiguration(model);
+
+  const std::string RF = "rleg6_joint";
+  const std::string LF = "lleg6_joint";
+
+  std::vector<RigidConstraintModel> contact_models;
+  std::vector<RigidConstraintData> contact_datas;
+  RigidConstraintModel ci_RF(CONTACT_6D, model, model.getJointId(RF), LOCAL);
+  contact_models.push_back(ci_RF);
+  contact_datas.push_back(RigidConstraintData(ci_RF));
+  RigidConstraintModel ci_LF(CONTACT_6D, model, model.getJointId(LF), LOCAL);
+  contact_models.push_back(ci_LF);
+  contact_datas.push_back(RigidConstraintData(ci_LF));
+
+  Data data(model);
+  crba(model, data, q, Convention::WORLD);
+  computeJointJacobians(model, data, q);
+  data.q_in = q;
+  calc(model, data, contact_models, contact_datas);
+
+  const double mu = 1e-4;
+  ConstraintCholeskyDecomposition constraint_chol_decomposition;
+  constraint_chol_decomposition.rebuild(model, data, contact_models, contact_datas);
+  constraint_chol_decomposition.compute(model, data, contact_models, contact_datas, mu);
+
+  // Only a few rows are updated
+  const Eigen::Index constraint_dim = constraint_chol_decomposition.constraintDim();
+  Eigen::VectorXd mus = Eigen::VectorXd::Constant(constraint_dim, mu);
+  mus[1] = 1e-2;
+  mus[4] = 1e-6;
+  constraint_chol_decomposition.rankUpdateDamping(mus);
+  BOOST_CHECK(!constraint_chol_decomposition.isDirty());
+  BOOST_CHECK(constraint_chol_decomposition.getDamping().diagonal() == mus);
+
+  ConstraintCholeskyDecomposition constraint_chol_decomposition_ref;
+  constraint_chol_decomposition_ref.rebuild(model, data, contact_models, contact_datas);
+  constraint_chol_decomposition_ref.compute(model, data, contact_models, contact_datas, mus);
+
+  BOOST_CHECK(constraint_chol_decomposition.D.isApprox(constraint_chol_decomposition_ref.D));
+  BOOST_CHECK(constraint_chol_decomposition.Dinv.isApprox(constraint_chol_decomposition_ref.Dinv));
+  BOOST_CHECK(constraint_chol_decomposition.U.isApprox(constraint_chol_decomposition_ref.U));
+
+  // All the rows are updated: fallback to a full decomposition
+  mus.setConstant(1e-3);
+  constraint_chol_decomposition.rankUpdateDamping(mus);
+  constraint_chol_decomposition_ref.updateDamping(mus);
+  constraint_chol_decomposition_ref.computeDelassusCholeskyDecomposition();
+
+  BOOST_CHECK(constraint_chol_decomposition.D.isApprox(constraint_chol_decomposition_ref.D));
+  BOOST_CHECK(constraint_chol_decomposition.U.isApprox(constraint_chol_decomposition_ref.U));
+}
+
 BOOST_AUTO_TEST_CASE(constraint_cholesky_joint_friction_constraint)
 {
   using namespace Eigen;
@@ -6,6 +6,10 @@
 #include "pinocchio/multibody/sample-models.hpp"
 
 #include "pinocchio/algorithm/check.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/rnea.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/crba.hpp"
 
 #include <boost/test/unit_test.hpp>
 #include <boost/utility/binary.hpp>
@@ -148,6 +152,47 @@ BOOST_AUTO_TEST_CASE(test_copy_and_equal_op)
   BOOST_CHECK(data != data_copy);
 }
 
+BOOST_AUTO_TEST_CASE(test_data_features)
+{
+  Model model;
+  buildModels::humanoidRandom(model, true);
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+
+  Data data(model), data_light(model, 0);
+  BOOST_CHECK(data.hasFeatures(DATA_ALL_FEATURES));
+  BOOST_CHECK(!data_light.hasFeatures(DATA_MASS_MATRIX));
+  BOOST_CHECK(data_light.M.size() == 0);
+  BOOST_CHECK(data_light.Fcrb.empty());
+  BOOST_CHECK(data_light.dtau_dq.size() == 0);
+  BOOST_CHECK(data_light.kinematic_hessians.size() == 0);
+  BOOST_CHECK(data_light.jointTorqueRegressor.size() == 0);
+  BOOST_CHECK(model.check(data_light));
+
+  // Kinematics and dynamics without the optional buffers
+  const Eigen::VectorXd q = randomConfiguration(model);
+  const Eigen::VectorXd v = Eigen::VectorXd::Random(model.nv);
+  const Eigen::VectorXd a = Eigen::VectorXd::Random(model.nv);
+
+  const Eigen::VectorXd tau = rnea(model, data, q, v, a);
+  BOOST_CHECK(rnea(model, data_light, q, v, a).isApprox(tau));
+  for (JointIndex joint_id = 1; joint_id < JointIndex(model.njoints); ++joint_id)
+    BOOST_CHECK(data_light.oMi[joint_id].isApprox(data.oMi[joint_id]));
+  BOOST_CHECK(aba(model, data_light, q, v, tau, Convention::LOCAL).isApprox(a));
+
+  // Allocation on demand
+  data_light.allocateFeatures(model, DATA_MASS_MATRIX);
+  BOOST_CHECK(data_light.hasFeatures(DATA_MASS_MATRIX));
+  BOOST_CHECK(!data_light.hasFeatures(DATA_MASS_MATRIX | DATA_DERIVATIVES));
+  BOOST_CHECK(model.check(data_light));
+  crba(model, data, q, Convention::WORLD);
+  BOOST_CHECK(crba(model, data_light, q, Convention::WORLD).isApprox(data.M));
+
+  Data data_allocated(model, DATA_MASS_MATRIX);
+  data_allocated.allocateFeatures(model, DATA_ALL_FEATURES);
+  BOOST_CHECK(data_allocated == Data(model));
+}
+
 BOOST_AUTO_TEST_CASE(test_std_vector_of_Data)
 {
   Model model;
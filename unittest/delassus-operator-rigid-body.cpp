@@ -5,6 +5,8 @@
 #include <memory>
 #include <algorithm>
 
+#include <Eigen/Eigenvalues>
+
 #include "pinocchio/constraints.hpp"
 #include "pinocchio/multibody/sample-models.hpp"
 
@@ -1572,6 +1574,87 @@ BOOST_AUTO_TEST_CASE(general_test_no_constraints)
   }
 }
 
+BOOST_AUTO_TEST_CASE(largest_eigenvalue_estimate)
+{
+  typedef FrameAnchorConstraintModelTpl<double> ConstraintModel;
+  typedef DelassusOperatorRigidBodySystemsTpl<
+    double, 0, JointCollectionDefaultTpl, ConstraintModel, std::reference_wrapper>
+    DelassusOperator;
+  typedef typename DelassusOperator::ConstraintModelVector ConstraintModelVector;
+  typedef typename DelassusOperator::ConstraintDataVector ConstraintDataVector;
+
+  Model model;
+  buildModels::humanoidRandom(model, true);
+  Data data(model);
+
+  const std::string RF = "rleg6_joint";
+  const std::string LF = "lleg6_joint";
+
+  ConstraintModelVector constraint_models;
+  ConstraintDataVector constraint_datas;
+  const ConstraintModel cm_RF(model, model.getJointId(RF), SE3::Random());
+  constraint_models.push_back(cm_RF);
+  constraint_datas.push_back(cm_RF.createData());
+  const ConstraintModel cm_LF(model, model.getJointId(LF), SE3::Random());
+  constraint_models.push_back(cm_LF);
+  constraint_datas.push_back(cm_LF.createData());
+
+  const double damping_value = 1e-4;
+  DelassusOperator delassus(
+    pinocchio::internal::helper::make_ref(model), pinocchio::internal::helper::make_ref(data),
+    pinocchio::internal::helper::make_ref(constraint_models),
+    pinocchio::internal::helper::make_ref(constraint_datas), damping_value);
+  BOOST_CHECK(!delassus.getLargestEigenvalueEstimate().has_value());
+
+  Eigen::VectorXd q = randomConfiguration(model);
+  computeJointJacobians(model, data, q);
+  data.q_in = q;
+  calc(model, data, constraint_models, constraint_datas);
+  delassus.compute();
+
+  const auto largest_eigenvalue = [&delassus]() {
+    const Eigen::MatrixXd G = delassus.matrix(true);
+    Eigen::SelfAdjointEigenSolver<Eigen::MatrixXd> eigen_solver(G);
+    return eigen_solver.eigenvalues().maxCoeff();
+  };
+
+  const double rel_tol = 1e-10;
+  const int max_it = 1000;
+  const double L = delassus.computeLargestEigenvalueEstimate(max_it, rel_tol);
+  BOOST_CHECK(delassus.getLargestEigenvalueEstimate().has_value());
+  BOOST_CHECK(delassus.getLargestEigenvalueEstimate().value() == L);
+  BOOST_CHECK(std::fabs(L - largest_eigenvalue()) <= 1e-4 * largest_eigenvalue());
+  const int cold_iterations = delassus.getLargestEigenvalueEstimateIterations();
+
+  // The operator varies slightly: the cached eigenvector makes the estimate converge faster.
+  q = integrate(model, q, 1e-3 * Eigen::VectorXd::Random(model.nv));
+  computeJointJacobians(model, data, q);
+  data.q_in = q;
+  calc(model, data, constraint_models, constraint_datas);
+  delassus.compute();
+
+  const double L_next = delassus.computeLargestEigenvalueEstimate(max_it, rel_tol);
+  BOOST_CHECK(std::fabs(L_next - largest_eigenvalue()) <= 1e-4 * largest_eigenvalue());
+  BOOST_CHECK(delassus.getLargestEigenvalueEstimateIterations() < cold_iterations);
+
+  // The estimate is kept by the copies.
+  DelassusOperator delassus_copy(delassus);
+  BOOST_CHECK(
+    delassus_copy.getLargestEigenvalueEstimate() == delassus.getLargestEigenvalueEstimate());
+
+  delassus.resetLargestEigenvalueEstimate();
+  BOOST_CHECK(!delassus.getLargestEigenvalueEstimate().has_value());
+
+  // The cache is discarded when the size of the operator changes.
+  constraint_models.pop_back();
+  constraint_datas.pop_back();
+  delassus_copy.rebuild(
+    pinocchio::internal::helper::make_ref(model), pinocchio::internal::helper::make_ref(data),
+    pinocchio::internal::helper::make_ref(constraint_models),
+    pinocchio::internal::helper::make_ref(constraint_datas));
+  BOOST_CHECK(!delassus_copy.getLargestEigenvalueEstimate().has_value());
+}
+
 BOOST_AUTO_TEST_CASE(test_copy)
 {
   typedef JointFrictionConstraintModelTpl<double> ConstraintModel;
@@ -10,6 +10,7 @@
 #include "pinocchio/algorithm/joint-configuration.hpp"
 #include "pinocchio/algorithm/jacobian.hpp"
 #include "pinocchio/algorithm/delassus.hpp"
+#include "pinocchio/algorithm/delassus-operator.hpp"
 #include "pinocchio/algorithm/compute-all-terms.hpp"
 
 #include <boost/test/unit_test.hpp>
@@ -871,4 +872,69 @@ BOOST_AUTO_TEST_CASE(contact_3D_6D_ancestor_6D4)
     1e-7));
 }
 
+BOOST_AUTO_TEST_CASE(sparse_delassus_matrix)
+{
+  using namespace Eigen;
+  pinocchio::Model model;
+  pinocchio::buildModels::humanoidRandom(model, true);
+
+  // Free-floating boxes, kinematically independent of the humanoid
+  const Inertia box_inertia = Inertia::FromBox(1., 1., 1., 1.);
+  const JointIndex box1_id =
+    model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "box1_free_flyer");
+  model.appendBodyToJoint(box1_id, box_inertia);
+  const JointIndex box2_id =
+    model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "box2_free_flyer");
+  model.appendBodyToJoint(box2_id, box_inertia);
+  pinocchio::Data data(model);
+
+  const std::string RF = "rleg6_joint";
+  const std::string LF = "lleg6_joint";
+  std::vector<RigidConstraintModel> contact_models;
+  contact_models.push_back(RigidConstraintModel(CONTACT_3D, model, box1_id, LOCAL));
+  contact_models.push_back(RigidConstraintModel(CONTACT_6D, model, model.getJointId(RF), LOCAL));
+  contact_models.push_back(RigidConstraintModel(CONTACT_3D, model, box2_id, LOCAL));
+  contact_models.push_back(RigidConstraintModel(CONTACT_6D, model, model.getJointId(LF), LOCAL));
+  std::vector<RigidConstraintData> contact_data;
+  for (const RigidConstraintModel & cmodel : contact_models)
+    contact_data.push_back(RigidConstraintData(cmodel));
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+  model.lowerPositionLimit.tail<14>().fill(-1.);
+  model.upperPositionLimit.tail<14>().fill(1.);
+  const VectorXd q = randomConfiguration(model);
+
+  const Eigen::Index constraint_size = getTotalConstraintResidualSize(contact_models);
+  MatrixXd delassus_dense(constraint_size, constraint_size);
+  computeDelassusMatrix(model, data, q, contact_models, contact_data, delassus_dense, mu);
+  delassus_dense.triangularView<StrictlyLower>() =
+    delassus_dense.triangularView<StrictlyUpper>().transpose();
+
+  Eigen::SparseMatrix<double> delassus_sparse;
+  computeSparseDelassusMatrix(model, data, q, contact_models, contact_data, delassus_sparse, mu);
+  BOOST_CHECK(delassus_sparse.rows() == constraint_size);
+  BOOST_CHECK(delassus_sparse.cols() == constraint_size);
+  BOOST_CHECK(delassus_sparse.isCompressed());
+  BOOST_CHECK(MatrixXd(delassus_sparse).isApprox(delassus_dense));
+
+  // Only the blocks of each box and the blocks between the feet of the humanoid are stored.
+  BOOST_CHECK(delassus_sparse.nonZeros() == 3 * 3 + 3 * 3 + 12 * 12);
+
+  // The sparse matrix can be consumed by the sparse Delassus operator.
+  DelassusOperatorSparse delassus_operator(delassus_sparse);
+  delassus_operator.updateDamping(mu);
+  delassus_operator.updateDecomposition();
+  const VectorXd rhs = VectorXd::Random(constraint_size);
+  VectorXd sol = rhs;
+  delassus_operator.solveInPlace(sol);
+  const MatrixXd damped_delassus_dense =
+    delassus_dense + mu * MatrixXd::Identity(constraint_size, constraint_size);
+  BOOST_CHECK(sol.isApprox(damped_delassus_dense.llt().solve(rhs), 1e-8));
+
+  // The matrix can be recomputed in place.
+  computeSparseDelassusMatrix(model, data, q, contact_models, contact_data, delassus_sparse, mu);
+  BOOST_CHECK(MatrixXd(delassus_sparse).isApprox(delassus_dense));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
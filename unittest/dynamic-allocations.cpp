@@ -30,6 +30,17 @@
 #include "pinocchio/algorithm/impulse-dynamics-derivatives.hpp"
 #include "pinocchio/algorithm/regressor.hpp"
 #include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/delassus-operator.hpp"
+#include "pinocchio/algorithm/solvers/admm-solver.hpp"
+#include "pinocchio/algorithm/solvers/pgs-solver.hpp"
+#ifdef PINOCCHIO_WITH_COLLISION
+  #include "pinocchio/algorithm/geometry.hpp"
+  #include "pinocchio/collision/collision.hpp"
+  #include "pinocchio/collision/distance.hpp"
+  #include "pinocchio/collision/broadphase.hpp"
+
+  #include <coal/broadphase/broadphase_dynamic_AABB_tree.h>
+#endif // PINOCCHIO_WITH_COLLISION
 using namespace pinocchio;
 
 #include <boost/test/unit_test.hpp>
@@ -558,6 +569,155 @@ BOOST_AUTO_TEST_CASE(dynamic_allocations_humanoid_composite)
   runDynamicAllocationsTest(model);
 }
 
+BOOST_AUTO_TEST_CASE(dynamic_allocations_varying_number_of_contacts)
+{
+  typedef PointContactConstraintModel ConstraintModel;
+  typedef ConstraintModel::ConstraintData ConstraintData;
+
+  // Stack of free-floating cubes, in contact with the cube below through four point contacts.
+  const std::size_t n_cubes = 4;
+  Model model;
+  const Inertia box_inertia = Inertia::FromBox(1., 1., 1., 1.);
+  for (std::size_t i = 0; i < n_cubes; ++i)
+  {
+    const JointIndex joint_id =
+      model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "free_flyer_" + std::to_string(i));
+    model.appendBodyToJoint(joint_id, box_inertia);
+  }
+
+  std::vector<ConstraintModel> constraint_models;
+  for (std::size_t i = 0; i < n_cubes; ++i)
+  {
+    for (int k = 0; k < 4; ++k)
+    {
+      const SE3::Vector3 corner(k % 2 ? 0.5 : -0.5, k / 2 ? 0.5 : -0.5, 0.5);
+      ConstraintModel cmodel(
+        model, JointIndex(i), SE3(SE3::Matrix3::Identity(), corner), JointIndex(i + 1),
+        SE3(SE3::Matrix3::Identity(), corner - SE3::Vector3::UnitZ()));
+      cmodel.setFriction(0.4);
+      constraint_models.push_back(cmodel);
+    }
+  }
+
+  Data data(model);
+  std::vector<ConstraintData> constraint_datas;
+  for (const auto & cmodel : constraint_models)
+    constraint_datas.push_back(cmodel.createData());
+
+  Eigen::VectorXd q = neutral(model);
+  for (std::size_t i = 0; i < n_cubes; ++i)
+    q[Eigen::Index(7 * i + 2)] = double(i) + 0.5;
+  data.q_in = q;
+  crba(model, data, q, Convention::WORLD);
+  calc(model, data, constraint_models, constraint_datas);
+
+  // Dense Delassus matrix of the full problem.
+  const Eigen::Index max_size = getTotalConstraintResidualSize(constraint_models);
+  ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+  chol.compute(model, data, constraint_models, constraint_datas, 1e-8);
+  const Eigen::MatrixXd G_full = chol.getInverseOperationalSpaceInertiaMatrix(true);
+  const Eigen::VectorXd g_full = Eigen::VectorXd::Random(max_size);
+
+  // Problems with a varying number of contacts, prepared beforehand.
+  std::vector<std::vector<ConstraintModel>> constraint_models_subsets;
+  std::vector<std::vector<ConstraintData>> constraint_datas_subsets;
+  for (std::size_t num_contacts = constraint_models.size(); num_contacts > 0; num_contacts -= 3)
+  {
+    constraint_models_subsets.emplace_back(
+      constraint_models.begin(), constraint_models.begin() + long(num_contacts));
+    constraint_datas_subsets.emplace_back(
+      constraint_datas.begin(), constraint_datas.begin() + long(num_contacts));
+    if (num_contacts < 3)
+      break;
+  }
+
+  DelassusOperatorDense delassus;
+  delassus.reserve(max_size);
+  chol.reserve(max_size);
+
+  ADMMConstraintSolver admm_solver;
+  admm_solver.reserve(std::size_t(max_size));
+  ADMMSolverResult admm_result;
+  admm_result.reserve(std::size_t(max_size));
+  ADMMSolverSettings admm_settings;
+  admm_settings.max_iterations = 100;
+  admm_settings.rho_init = 1e-2; // no Lanczos estimate of the largest eigenvalue
+
+  PGSConstraintSolver pgs_solver;
+  pgs_solver.reserve(std::size_t(max_size));
+  PGSSolverResult pgs_result;
+  pgs_result.reserve(std::size_t(max_size));
+  PGSSolverSettings pgs_settings;
+  pgs_settings.max_iterations = 100;
+
+  for (std::size_t k = 0; k < constraint_models_subsets.size(); ++k)
+  {
+    const auto & cmodels = constraint_models_subsets[k];
+    const auto & cdatas = constraint_datas_subsets[k];
+    const Eigen::Index size = getTotalConstraintResidualSize(cmodels);
+
+    [&]() noexcept [[clang::nonblocking]] {
+      chol.rebuild(model, data, cmodels, cdatas);
+      chol.compute(model, data, cmodels, cdatas, 1e-8);
+
+      delassus.rebuild(G_full.topLeftCorner(size, size));
+      admm_solver.solve(
+        delassus, g_full.head(size), cmodels, cdatas, admm_settings, admm_result);
+
+      delassus.rebuild(G_full.topLeftCorner(size, size));
+      pgs_solver.solve(delassus, g_full.head(size), cmodels, cdatas, pgs_settings, pgs_result);
+    }();
+  }
+}
+
+#ifdef PINOCCHIO_WITH_COLLISION
+BOOST_AUTO_TEST_CASE(dynamic_allocations_collisions)
+{
+  Model model;
+  buildModels::humanoid(model);
+  GeometryModel geom_model;
+  buildModels::humanoidGeometries(model, geom_model);
+  geom_model.addAllCollisionPairs();
+
+  Data data(model);
+  GeometryData geom_data(geom_model);
+
+  typedef BroadPhaseManagerTpl<coal::DynamicAABBTreeCollisionManager> BroadPhaseManager;
+  BroadPhaseManager broadphase_manager(&model, &geom_model, &geom_data);
+  CollisionCallBackCollect callback_collect(geom_model, geom_data);
+
+  std::vector<Eigen::VectorXd> configurations;
+  for (int k = 0; k < 20; ++k)
+    configurations.push_back(randomConfiguration(model));
+
+  // Warm-up: the first update balances the broad phase tree and the contact patch solvers size
+  // their internal buffers.
+  computeCollisions(model, data, geom_model, geom_data, configurations.front(), false);
+  computeContactPatches(geom_model, geom_data);
+  computeCollisions(model, data, broadphase_manager, configurations.front(), false);
+
+  for (const Eigen::VectorXd & q : configurations)
+  {
+    [&]() noexcept [[clang::nonblocking]] {
+      // Narrow phase over all the collision pairs
+      computeCollisions(model, data, geom_model, geom_data, q, false);
+      computeDistances(model, data, geom_model, geom_data, q);
+      computeContactPatches(geom_model, geom_data);
+
+      // Broad phase followed by the narrow phase
+      computeCollisions(model, data, broadphase_manager, q, false);
+
+      // Broad phase collecting the candidate pairs, then narrow phase on these pairs only
+      updateGeometryPlacements(model, data, geom_model, geom_data, q);
+      broadphase_manager.update(false);
+      computeCollisions(broadphase_manager, &callback_collect);
+      for (const PairIndex pair_id : callback_collect.pair_indexes)
+        computeCollision(geom_model, geom_data, pair_id);
+    }();
+  }
+}
+#endif // PINOCCHIO_WITH_COLLISION
+
 BOOST_AUTO_TEST_CASE(dynamic_allocations_spatial_operations)
 {
   [&]() noexcept [[clang::nonblocking]] {
@@ -0,0 +1,150 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "pinocchio/algorithm/parallel/executor.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+// Executor forwarding the work to std::thread, as a user would do to plug its own thread pool.
+struct CustomExecutor : ExecutorBase<CustomExecutor>
+{
+  explicit CustomExecutor(const size_t num_threads)
+  : m_num_threads(num_threads)
+  {
+  }
+
+  size_t numThreads() const
+  {
+    return m_num_threads;
+  }
+
+  template<typename Function>
+  void parallelFor(const Eigen::Index size, Function && f)
+  {
+    std::vector<std::thread> threads;
+    for (size_t thread_id = 0; thread_id < m_num_threads; ++thread_id)
+      threads.emplace_back([&f, size, thread_id, this] {
+        for (Eigen::Index i = Eigen::Index(thread_id); i < size; i += Eigen::Index(m_num_threads))
+          f(thread_id, i);
+      });
+    for (std::thread & thread : threads)
+      thread.join();
+  }
+
+  size_t m_num_threads;
+};
+
+template<typename Executor>
+void check_executor(ExecutorBase<Executor> & executor)
+{
+  const size_t num_threads = executor.numThreads();
+
+  for (const Eigen::Index size : {0, 1, 7, 1000})
+  {
+    std::vector<int> visits((size_t)size, 0);
+    std::vector<std::atomic<int>> running(num_threads);
+    for (std::atomic<int> & r : running)
+      r.store(0);
+    std::atomic<bool> valid_thread_ids(true);
+    std::atomic<bool> concurrent_thread_ids(false);
+
+    executor.parallelFor(size, [&](const size_t thread_id, const Eigen::Index i) {
+      if (thread_id >= num_threads)
+      {
+        valid_thread_ids.store(false);
+        return;
+      }
+      if (running[thread_id].fetch_add(1) != 0)
+        concurrent_thread_ids.store(true);
+
+      // Uneven costs
+      volatile double dummy = 0.;
+      for (Eigen::Index k = 0; k < (i % 13) * 1000; ++k)
+        dummy = dummy + 1.;
+
+      visits[(size_t)i] += 1;
+      running[thread_id].fetch_sub(1);
+    });
+
+    BOOST_CHECK(valid_thread_ids.load());
+    BOOST_CHECK(!concurrent_thread_ids.load());
+    for (const int visit : visits)
+      BOOST_CHECK(visit == 1);
+  }
+
+  // Exceptions are forwarded to the caller and the executor remains usable afterwards.
+  BOOST_CHECK_THROW(
+    executor.parallelFor(
+      100,
+      [](const size_t, const Eigen::Index i) {
+        if (i == 42)
+          throw std::logic_error("index 42");
+      }),
+    std::logic_error);
+
+  std::atomic<Eigen::Index> count(0);
+  executor.parallelFor(100, [&count](const size_t, const Eigen::Index) { count++; });
+  BOOST_CHECK(count.load() == 100);
+}
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_serial_executor)
+{
+  SerialExecutor executor;
+  BOOST_CHECK(executor.numThreads() == 1);
+  check_executor(executor);
+}
+
+BOOST_AUTO_TEST_CASE(test_openmp_executor)
+{
+  const int max_threads = omp_get_max_threads();
+
+  OpenMPExecutor static_executor(4);
+  BOOST_CHECK(static_executor.numThreads() == 4);
+  check_executor(static_executor);
+
+  OpenMPExecutor dynamic_executor(3, true);
+  check_executor(dynamic_executor);
+
+  // The global OpenMP settings are left untouched.
+  BOOST_CHECK(omp_get_max_threads() == max_threads);
+}
+
+BOOST_AUTO_TEST_CASE(test_thread_pool_executor)
+{
+  for (const size_t num_threads : {1, 2, 5})
+  {
+    ThreadPoolExecutor executor(num_threads);
+    BOOST_CHECK(executor.numThreads() == num_threads);
+    check_executor(executor);
+  }
+
+  ThreadPoolExecutor chunked_executor(4, 16);
+  BOOST_CHECK(chunked_executor.grainSize() == 16);
+  check_executor(chunked_executor);
+
+  BOOST_CHECK_THROW(ThreadPoolExecutor(0), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_custom_executor)
+{
+  CustomExecutor executor(3);
+  BOOST_CHECK(executor.numThreads() == 3);
+
+  std::vector<int> visits(50, 0);
+  executor.parallelFor(50, [&visits](const size_t, const Eigen::Index i) { visits[(size_t)i]++; });
+  for (const int visit : visits)
+    BOOST_CHECK(visit == 1);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
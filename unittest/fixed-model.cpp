@@ -0,0 +1,111 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/multibody/sample-models.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/fixed-model.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace pinocchio;
+
+typedef FixedModel<
+  JointModelFreeFlyer,
+  JointModelRZ,
+  JointModelRY,
+  JointModelPX,
+  JointModelSpherical,
+  JointModelRUBZ>
+  FixedArm;
+
+namespace
+{
+  Model buildArm()
+  {
+    Model model;
+    JointIndex joint_id = model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "root");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+    joint_id = model.addJoint(joint_id, JointModelRZ(), SE3::Random(), "shoulder");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+    joint_id = model.addJoint(joint_id, JointModelRY(), SE3::Random(), "elbow");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+    joint_id = model.addJoint(joint_id, JointModelPX(), SE3::Random(), "slider");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+    // Branch attached to the shoulder
+    joint_id = model.addJoint(2, JointModelSpherical(), SE3::Random(), "wrist");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+    joint_id = model.addJoint(joint_id, JointModelRUBZ(), SE3::Random(), "tool");
+    model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+
+    model.lowerPositionLimit.head<3>().fill(-1.);
+    model.upperPositionLimit.head<3>().fill(1.);
+    return model;
+  }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_fixed_model_sizes)
+{
+  BOOST_CHECK(FixedArm::njoints == 7);
+  BOOST_CHECK(FixedArm::nq == 16);
+  BOOST_CHECK(FixedArm::nv == 13);
+  BOOST_CHECK(FixedArm::ConfigVectorType::RowsAtCompileTime == 16);
+  BOOST_CHECK(FixedArm::TangentVectorType::RowsAtCompileTime == 13);
+
+  const Model model = buildArm();
+  BOOST_CHECK(model.nq == FixedArm::nq);
+  BOOST_CHECK(model.nv == FixedArm::nv);
+
+  const std::string expected_typedef = "typedef ::pinocchio::FixedModel<\n"
+                                       "  ::pinocchio::JointModelFreeFlyer,\n"
+                                       "  ::pinocchio::JointModelRZ,\n"
+                                       "  ::pinocchio::JointModelRY,\n"
+                                       "  ::pinocchio::JointModelPX,\n"
+                                       "  ::pinocchio::JointModelSpherical,\n"
+                                       "  ::pinocchio::JointModelRUBZ>\n"
+                                       "  FixedArm;\n";
+  BOOST_CHECK(fixedModelTypedef(model, "FixedArm") == expected_typedef);
+
+  // Joints which are not supported, or not matching the fixed model
+  Model humanoid;
+  buildModels::humanoidRandom(humanoid, false);
+  BOOST_CHECK_THROW(fixedModelTypedef(humanoid, "Humanoid"), std::invalid_argument);
+  BOOST_CHECK_THROW(FixedArm fixed_model(humanoid), std::invalid_argument);
+
+  Model other_model = buildArm();
+  other_model.joints[3] = JointModelRX();
+  other_model.joints[3].setIndexes(3, model.joints[3].idx_q(), model.joints[3].idx_v());
+  BOOST_CHECK_THROW(FixedArm fixed_model(other_model), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_fixed_model_algorithms)
+{
+  Model model = buildArm();
+  model.armature = FixedArm::TangentVectorType::Random() + FixedArm::TangentVectorType::Ones();
+
+  const FixedArm fixed_model(model);
+  Data data(model), data_fixed(model);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    const FixedArm::ConfigVectorType q = randomConfiguration(model);
+    const FixedArm::TangentVectorType v = FixedArm::TangentVectorType::Random();
+    const FixedArm::TangentVectorType a = FixedArm::TangentVectorType::Random();
+
+    const Eigen::VectorXd tau = rnea(model, data, q, v, a);
+    BOOST_CHECK(rnea(fixed_model, model, data_fixed, q, v, a).isApprox(tau));
+
+    const Eigen::VectorXd ddq = aba(model, data, q, v, tau, Convention::LOCAL);
+    BOOST_CHECK(aba(fixed_model, model, data_fixed, q, v, tau).isApprox(ddq));
+    BOOST_CHECK(data_fixed.ddq.isApprox(a));
+
+    crba(model, data, q, Convention::LOCAL);
+    crba(fixed_model, model, data_fixed, q);
+    BOOST_CHECK(data_fixed.M.triangularView<Eigen::Upper>().toDenseMatrix().isApprox(
+      data.M.triangularView<Eigen::Upper>().toDenseMatrix()));
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
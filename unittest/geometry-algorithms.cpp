@@ -9,10 +9,14 @@
 
 #include "pinocchio/collision/collision.hpp"
 #include "pinocchio/collision/distance.hpp"
+#include "pinocchio/collision/collision-pair-pruning.hpp"
 #include "pinocchio/algorithm/geometry.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/multibody/sample-models.hpp"
 #include "pinocchio/parsers/urdf.hpp"
 #include "pinocchio/parsers/srdf.hpp"
 
+#include <cmath>
 #include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
@@ -135,6 +139,133 @@ BOOST_AUTO_TEST_CASE(test_simple_boxes)
   BOOST_CHECK(geomData.collisionResults.size() == 1);
 }
 
+BOOST_AUTO_TEST_CASE(test_continuous_collisions)
+{
+  // A unit box sliding along the x axis towards a fixed unit box centered at x = 5.
+  Model model;
+  const JointIndex joint_id = model.addJoint(0, JointModelPX(), SE3::Identity(), "slider");
+  model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+
+  GeometryModel geom_model;
+  std::shared_ptr<coal::Box> box(new coal::Box(1, 1, 1));
+  geom_model.addGeometryObject(GeometryObject("moving_box", joint_id, SE3::Identity(), box));
+  geom_model.addGeometryObject(GeometryObject(
+    "fixed_box", 0, SE3(SE3::Matrix3::Identity(), SE3::Vector3(5., 0., 0.)), box));
+  geom_model.addAllCollisionPairs();
+
+  Data data(model);
+  GeometryData geom_data(geom_model);
+  computeBodyRadius(model, geom_model, geom_data);
+
+  const Eigen::VectorXd q0 = Eigen::VectorXd::Zero(1);
+  const double tolerance = 1e-6;
+  double time_of_contact;
+
+  // The boxes touch when the slider reaches x = 4.
+  Eigen::VectorXd q1 = Eigen::VectorXd::Constant(1, 10.);
+  BOOST_CHECK(
+    computeContinuousCollisions(
+      model, data, geom_model, geom_data, q0, q1, time_of_contact, tolerance));
+  BOOST_CHECK(geom_data.collisionPairIndex == 0);
+  BOOST_CHECK(time_of_contact <= 0.4);
+  BOOST_CHECK_CLOSE(time_of_contact, 0.4, 1e-3);
+
+  // The segment stops before the contact.
+  q1[0] = 3.9;
+  BOOST_CHECK(
+    !computeContinuousCollisions(
+      model, data, geom_model, geom_data, q0, q1, time_of_contact, tolerance));
+  BOOST_CHECK(time_of_contact == 1.);
+
+  // Both end configurations are collision free, but the box passes through the fixed one.
+  const Eigen::VectorXd q_before = Eigen::VectorXd::Constant(1, 3.);
+  const Eigen::VectorXd q_after = Eigen::VectorXd::Constant(1, 7.);
+  BOOST_CHECK(!computeCollisions(model, data, geom_model, geom_data, q_before));
+  BOOST_CHECK(!computeCollisions(model, data, geom_model, geom_data, q_after));
+  BOOST_CHECK(
+    computeContinuousCollisions(
+      model, data, geom_model, geom_data, q_before, q_after, time_of_contact, tolerance));
+  BOOST_CHECK_CLOSE(time_of_contact, 0.25, 1e-3);
+
+  // The body radius are required.
+  GeometryData geom_data_without_radius(geom_model);
+  BOOST_CHECK_THROW(
+    computeContinuousCollisions(
+      model, data, geom_model, geom_data_without_radius, q0, q_after, time_of_contact),
+    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(test_collision_pair_pruning)
+{
+  // An arm rotating around the y axis within [-0.5, 0.5], carrying a box at x = 1.
+  Model model;
+  const JointIndex joint_id = model.addJoint(
+    0, JointModelRY(), SE3::Identity(), "arm", Eigen::VectorXd::Ones(1), Eigen::VectorXd::Ones(1),
+    Eigen::VectorXd::Constant(1, -0.5), Eigen::VectorXd::Constant(1, 0.5));
+  model.appendBodyToJoint(joint_id, Inertia::Random(), SE3::Identity());
+
+  GeometryModel geom_model;
+  std::shared_ptr<coal::Box> box(new coal::Box(0.2, 0.2, 0.2));
+  const GeomIndex arm_id = geom_model.addGeometryObject(GeometryObject(
+    "arm_box", joint_id, SE3(SE3::Matrix3::Identity(), SE3::Vector3(1., 0., 0.)), box));
+  // Far away from the arm
+  const GeomIndex far_id = geom_model.addGeometryObject(GeometryObject(
+    "far_box", 0, SE3(SE3::Matrix3::Identity(), SE3::Vector3(0., 0., 3.)), box));
+  // Reached by the arm for q = -0.3
+  const GeomIndex reached_id = geom_model.addGeometryObject(GeometryObject(
+    "reached_box", 0,
+    SE3(SE3::Matrix3::Identity(), SE3::Vector3(std::cos(0.3), 0., std::sin(0.3))), box));
+  // Out of reach by a few centimeters
+  const GeomIndex close_id = geom_model.addGeometryObject(GeometryObject(
+    "close_box", 0, SE3(SE3::Matrix3::Identity(), SE3::Vector3(1., 0., 0.75)), box));
+  geom_model.addCollisionPair(CollisionPair(arm_id, far_id));
+  geom_model.addCollisionPair(CollisionPair(arm_id, reached_id));
+  geom_model.addCollisionPair(CollisionPair(arm_id, close_id));
+
+  Data data(model);
+  GeometryData geom_data(geom_model);
+
+  CollisionPairPruningCache cache;
+  const std::size_t num_pruned_pairs =
+    computeCollisionPairPruning(model, data, geom_model, geom_data, cache);
+  BOOST_CHECK(num_pruned_pairs == 2);
+  BOOST_REQUIRE(cache.pruned_pairs.size() == 2);
+  BOOST_CHECK(cache.pruned_pairs[0] == CollisionPair(arm_id, far_id));
+  BOOST_CHECK(cache.pruned_pairs[1] == CollisionPair(arm_id, close_id));
+  BOOST_CHECK(cache.check(model, geom_model));
+
+  // The pruned pairs are collision free over the whole joint range.
+  for (int k = 0; k <= 1000; ++k)
+  {
+    const Eigen::VectorXd q = Eigen::VectorXd::Constant(1, -0.5 + 1e-3 * k);
+    updateGeometryPlacements(model, data, geom_model, geom_data, q);
+    BOOST_CHECK(!computeCollision(geom_model, geom_data, 0));
+    BOOST_CHECK(!computeCollision(geom_model, geom_data, 2));
+  }
+
+  // Without a budget for the bisection, only the far pair is certified.
+  CollisionPairPruningSettings settings;
+  settings.max_num_boxes = 1;
+  CollisionPairPruningCache cache_no_bisection;
+  BOOST_CHECK(
+    computeCollisionPairPruning(model, data, geom_model, geom_data, cache_no_bisection, settings)
+    == 1);
+
+  GeometryModel geom_model_pruned = geom_model;
+  removeCollisionPairs(model, geom_model_pruned, cache);
+  BOOST_REQUIRE(geom_model_pruned.collisionPairs.size() == 1);
+  BOOST_CHECK(geom_model_pruned.collisionPairs[0] == CollisionPair(arm_id, reached_id));
+  BOOST_CHECK(geom_model_pruned.existCollisionPair(CollisionPair(arm_id, reached_id)));
+  BOOST_CHECK(!geom_model_pruned.existCollisionPair(CollisionPair(arm_id, close_id)));
+
+  // The cache is not valid anymore once the joint limits have changed.
+  Model model_wider = model;
+  model_wider.upperPositionLimit[0] = 1.;
+  BOOST_CHECK(!cache.check(model_wider, geom_model));
+  BOOST_CHECK_THROW(
+    removeCollisionPairs(model_wider, geom_model_pruned, cache), std::invalid_argument);
+}
+
 #if defined(PINOCCHIO_WITH_URDFDOM)
 BOOST_AUTO_TEST_CASE(loading_model_and_check_distance)
 {
@@ -241,6 +372,90 @@ BOOST_AUTO_TEST_CASE(test_collisions)
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_collisions_with_temporal_coherence)
+{
+  typedef pinocchio::Model Model;
+  typedef pinocchio::GeometryModel GeometryModel;
+  typedef pinocchio::Data Data;
+  typedef pinocchio::GeometryData GeometryData;
+
+  const std::string filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/romeo_description/urdf/romeo_small.urdf");
+  std::vector<std::string> packageDirs;
+  const std::string meshDir =
+    boost::filesystem::path(EXAMPLE_ROBOT_DATA_MODEL_DIR).parent_path().parent_path().string();
+  packageDirs.push_back(meshDir);
+  const std::string srdf_filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/romeo_description/srdf/romeo.srdf");
+
+  Model model;
+  pinocchio::urdf::buildModel(filename, pinocchio::JointModelFreeFlyer(), model);
+  GeometryModel geom_model;
+  pinocchio::urdf::buildGeom(model, filename, pinocchio::COLLISION, geom_model, packageDirs);
+  geom_model.addAllCollisionPairs();
+  pinocchio::srdf::removeCollisionPairs(model, geom_model, srdf_filename, false);
+  pinocchio::srdf::loadReferenceConfigurations(model, srdf_filename, false);
+
+  Data data(model), data_ref(model);
+  GeometryData geom_data(geom_model), geom_data_ref(geom_model);
+
+  // The body radius are required by the coherence cache.
+  BOOST_CHECK_THROW(
+    computeCollisionsWithTemporalCoherence(
+      model, data, geom_model, geom_data, model.referenceConfigurations["half_sitting"]),
+    std::invalid_argument);
+  pinocchio::computeBodyRadius(model, geom_model, geom_data);
+
+  Data data_ccd(model);
+  GeometryData geom_data_ccd(geom_model);
+  pinocchio::computeBodyRadius(model, geom_model, geom_data_ccd);
+
+  // Dense trajectories from the half sitting configuration towards random configurations,
+  // some of them being in self collision.
+  const Eigen::VectorXd qmax = Eigen::VectorXd::Ones(model.nq);
+  const Eigen::VectorXd q0 = model.referenceConfigurations["half_sitting"];
+  for (int trajectory_id = 0; trajectory_id < 5; ++trajectory_id)
+  {
+    const Eigen::VectorXd q1 = pinocchio::randomConfiguration(model, -qmax, qmax);
+    double time_of_contact;
+    computeContinuousCollisions(
+      model, data_ccd, geom_model, geom_data_ccd, q0, q1, time_of_contact);
+
+    const int num_steps = 200;
+    for (int k = 0; k <= num_steps; ++k)
+    {
+      const Eigen::VectorXd q = pinocchio::interpolate(model, q0, q1, double(k) / num_steps);
+
+      const bool is_colliding =
+        computeCollisionsWithTemporalCoherence(model, data, geom_model, geom_data, q);
+      const bool is_colliding_ref =
+        computeCollisions(model, data_ref, geom_model, geom_data_ref, q);
+      BOOST_CHECK(is_colliding == is_colliding_ref);
+
+      // No sampled configuration collides before the time of contact of the continuous check.
+      if (double(k) / num_steps < time_of_contact)
+        BOOST_CHECK(!is_colliding_ref);
+
+      for (size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+      {
+        BOOST_CHECK(
+          geom_data.collisionResults[cp_index].isCollision()
+          == geom_data_ref.collisionResults[cp_index].isCollision());
+      }
+    }
+  }
+
+  // After a reset, all the pairs are checked again.
+  geom_data.resetCollisionCoherenceCache();
+  BOOST_CHECK(geom_data.coherence_joint_placements.empty());
+  BOOST_CHECK(!computeCollisionsWithTemporalCoherence(model, data, geom_model, geom_data, q0));
+  for (size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+  {
+    BOOST_CHECK(std::isfinite(geom_data.coherence_pair_distances[cp_index]));
+    BOOST_CHECK(geom_data.coherence_pair_displacements[cp_index] == 0.);
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_distances)
 {
   typedef pinocchio::Model Model;
@@ -282,6 +497,89 @@ BOOST_AUTO_TEST_CASE(test_distances)
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_distances_derivatives)
+{
+  Model model;
+  buildModels::humanoid(model);
+  Data data(model), data_fd(model);
+
+  GeometryModel geom_model;
+  buildModels::humanoidGeometries(model, geom_model);
+  geom_model.addAllCollisionPairs();
+  GeometryData geom_data(geom_model), geom_data_fd(geom_model);
+  geom_data.deactivateCollisionPair(0);
+
+  const Eigen::DenseIndex num_pairs = Eigen::DenseIndex(geom_model.collisionPairs.size());
+  Eigen::MatrixXd distance_jacobian(num_pairs, model.nv);
+  Eigen::MatrixXd distance_jacobian_fd(num_pairs, model.nv);
+  Eigen::VectorXd distances(num_pairs), v_eps(Eigen::VectorXd::Zero(model.nv));
+  const double eps = 1e-7;
+
+  for (int i = 0; i < 20; ++i)
+  {
+    const Eigen::VectorXd q = randomConfiguration(model);
+    const std::size_t min_index =
+      computeDistancesDerivatives(model, data, geom_model, geom_data, q, distance_jacobian);
+    BOOST_CHECK(min_index == computeDistances(model, data_fd, geom_model, geom_data_fd, q));
+    BOOST_CHECK(distance_jacobian.row(0).isZero(0.));
+
+    for (Eigen::DenseIndex k = 0; k < num_pairs; ++k)
+      distances[k] = geom_data.distanceResults[size_t(k)].min_distance;
+
+    for (Eigen::DenseIndex k = 0; k < model.nv; ++k)
+    {
+      v_eps[k] = eps;
+      computeDistances(model, data_fd, geom_model, geom_data_fd, integrate(model, q, v_eps));
+      for (Eigen::DenseIndex l = 1; l < num_pairs; ++l)
+        distance_jacobian_fd(l, k) =
+          (geom_data_fd.distanceResults[size_t(l)].min_distance - distances[l]) / eps;
+      v_eps[k] = 0.;
+    }
+
+    // The distance is only smooth for separated geometries
+    for (Eigen::DenseIndex l = 1; l < num_pairs; ++l)
+      if (distances[l] > 1e-3)
+        BOOST_CHECK_SMALL(
+          (distance_jacobian.row(l) - distance_jacobian_fd.row(l)).norm(), std::sqrt(eps));
+
+    // Same result from the already computed Jacobians and distances
+    Eigen::MatrixXd distance_jacobian_data(num_pairs, model.nv);
+    computeDistancesDerivatives(model, data, geom_model, geom_data, distance_jacobian_data);
+    BOOST_CHECK(distance_jacobian_data == distance_jacobian);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_geometry_placements_batch)
+{
+  Model model;
+  buildModels::humanoid(model);
+  Data data(model);
+
+  GeometryModel geom_model;
+  buildModels::humanoidGeometries(model, geom_model);
+  geom_model.addGeometryObject(
+    GeometryObject(
+      "ground", 0, SE3::Random(), std::shared_ptr<coal::Box>(new coal::Box(1., 1., 0.1))));
+  GeometryData geom_data_ref(geom_model), geom_data(geom_model);
+
+  GeometryPlacementsBatch batch(geom_model);
+  BOOST_CHECK(batch.size() == Eigen::Index(geom_model.ngeoms));
+  for (JointIndex joint_id = 0; joint_id + 1 < batch.joint_offsets.size(); ++joint_id)
+    for (Eigen::Index k = batch.joint_offsets[joint_id]; k < batch.joint_offsets[joint_id + 1];
+         ++k)
+      BOOST_CHECK(
+        geom_model.geometryObjects[batch.geometry_ids[size_t(k)]].parentJoint == joint_id);
+
+  for (int i = 0; i < 10; ++i)
+  {
+    const Eigen::VectorXd q = randomConfiguration(model);
+    updateGeometryPlacements(model, data, geom_model, geom_data_ref, q);
+    updateGeometryPlacements(model, data, geom_model, geom_data, batch, q);
+    for (GeomIndex geom_id = 0; geom_id < geom_model.ngeoms; ++geom_id)
+      BOOST_CHECK(geom_data.oMg[geom_id].isApprox(geom_data_ref.oMg[geom_id]));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_append_geom_models)
 {
   typedef pinocchio::Model Model;
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/algorithm/parallel/aba-derivatives.hpp"
+#include "pinocchio/algorithm/aba-derivatives.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/multibody/sample-models.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_parallel_aba_derivatives)
+{
+  pinocchio::Model model;
+  buildModels::humanoidRandom(model);
+  Data data_ref(model);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+
+  const Eigen::Index batch_size = 32;
+  const Eigen::Index nv = model.nv;
+  const size_t num_threads = (size_t)omp_get_max_threads();
+
+  Eigen::MatrixXd q(model.nq, batch_size);
+  Eigen::MatrixXd v(nv, batch_size);
+  Eigen::MatrixXd tau(nv, batch_size);
+
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    q.col(i) = randomConfiguration(model);
+    v.col(i) = Eigen::VectorXd::Random(nv);
+    tau.col(i) = Eigen::VectorXd::Random(nv);
+  }
+
+  Eigen::MatrixXd ddq_dq_ref(nv, nv * batch_size), ddq_dv_ref(nv, nv * batch_size),
+    ddq_dtau_ref(nv, nv * batch_size);
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    Eigen::MatrixXd ddq_dq(Eigen::MatrixXd::Zero(nv, nv)), ddq_dv(Eigen::MatrixXd::Zero(nv, nv)),
+      ddq_dtau(Eigen::MatrixXd::Zero(nv, nv));
+    computeABADerivatives(
+      model, data_ref, q.col(i), v.col(i), tau.col(i), ddq_dq, ddq_dv, ddq_dtau);
+    ddq_dq_ref.middleCols(i * nv, nv) = ddq_dq;
+    ddq_dv_ref.middleCols(i * nv, nv) = ddq_dv;
+    ddq_dtau_ref.middleCols(i * nv, nv) = ddq_dtau;
+  }
+
+  ModelPool pool(model);
+  Eigen::MatrixXd ddq_dq(nv, nv * batch_size), ddq_dv(nv, nv * batch_size),
+    ddq_dtau(nv, nv * batch_size);
+
+  computeABADerivativesInParallel(num_threads, pool, q, v, tau, ddq_dq, ddq_dv, ddq_dtau);
+  BOOST_CHECK(ddq_dq.isApprox(ddq_dq_ref));
+  BOOST_CHECK(ddq_dv.isApprox(ddq_dv_ref));
+  BOOST_CHECK(ddq_dtau.isApprox(ddq_dtau_ref));
+
+  ThreadPoolExecutor thread_pool_executor(num_threads);
+  ddq_dq.setZero();
+  ddq_dv.setZero();
+  ddq_dtau.setZero();
+  computeABADerivativesInParallel(
+    thread_pool_executor, pool, q, v, tau, ddq_dq, ddq_dv, ddq_dtau);
+  BOOST_CHECK(ddq_dq.isApprox(ddq_dq_ref));
+  BOOST_CHECK(ddq_dv.isApprox(ddq_dv_ref));
+  BOOST_CHECK(ddq_dtau.isApprox(ddq_dtau_ref));
+
+  Eigen::MatrixXd wrong_size(nv, nv * (batch_size - 1));
+  BOOST_CHECK_THROW(
+    computeABADerivativesInParallel(
+      thread_pool_executor, pool, q, v, tau, wrong_size, ddq_dv, ddq_dtau),
+    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -52,6 +52,25 @@ BOOST_AUTO_TEST_CASE(test_parallel_aba)
   }
 
   BOOST_CHECK(a == a_ref);
+
+  SerialExecutor serial_executor;
+  a.setZero();
+  abaInParallel(serial_executor, pool, q, v, tau, a);
+  BOOST_CHECK(a == a_ref);
+
+  OpenMPExecutor openmp_executor(num_threads, true);
+  a.setZero();
+  abaInParallel(openmp_executor, pool, q, v, tau, a);
+  BOOST_CHECK(a == a_ref);
+
+  ThreadPoolExecutor thread_pool_executor(num_threads);
+  a.setZero();
+  abaInParallel(thread_pool_executor, pool, q, v, tau, a);
+  BOOST_CHECK(a == a_ref);
+
+  ThreadPoolExecutor too_large_executor(pool.size() + 1);
+  BOOST_CHECK_THROW(
+    abaInParallel(too_large_executor, pool, q, v, tau, a), std::invalid_argument);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/algorithm/constraint-cholesky.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/constraints.hpp"
+#include "pinocchio/algorithm/solvers/admm-solver.hpp"
+#include "pinocchio/algorithm/parallel/admm-solver.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/crba.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+typedef JointFrictionConstraintModel FrictionConstraintModel;
+typedef FrictionConstraintModel::ConstraintData FrictionConstraintData;
+typedef std::vector<FrictionConstraintModel> ConstraintModelVector;
+typedef std::vector<FrictionConstraintData> ConstraintDataVector;
+
+// Batch of dry friction problems on a free floating box, pushed by different torques.
+struct BoxProblems
+{
+  explicit BoxProblems(const size_t batch_size)
+  {
+    Model model;
+    model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "free_flyer");
+    model.appendBodyToJoint(1, Inertia::FromBox(10., 1., 1., 1.));
+    model.gravity.setZero();
+    Data data(model);
+
+    const Eigen::VectorXd q0 = neutral(model);
+    const Eigen::VectorXd v0 = Eigen::VectorXd::Zero(model.nv);
+    const double dt = 1e-3;
+
+    ConstraintModelVector constraint_models_ref;
+    constraint_models_ref.push_back(
+      FrictionConstraintModel(model, FrictionConstraintModel::JointIndexVector(1, 1)));
+    constraint_models_ref[0].setFrictionLowerLimit(Eigen::VectorXd::Constant(6, -1.));
+    constraint_models_ref[0].setFrictionUpperLimit(Eigen::VectorXd::Constant(6, +1.));
+    ConstraintDataVector constraint_datas_ref;
+    constraint_datas_ref.push_back(constraint_models_ref[0].createData());
+
+    crba(model, data, q0, Convention::WORLD);
+    data.q_in = q0;
+    calc(model, data, constraint_models_ref, constraint_datas_ref);
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models_ref, constraint_datas_ref);
+    chol.rebuild(model, data, constraint_models_ref, constraint_datas_ref);
+    chol.compute(model, data, constraint_models_ref, constraint_datas_ref, 1e-10);
+    G = chol.getDelassusOperatorCholeskyExpression().matrix();
+
+    Eigen::MatrixXd constraint_jacobian(G.rows(), model.nv);
+    constraint_jacobian.setZero();
+    getConstraintsJacobian(
+      model, data, constraint_models_ref, constraint_datas_ref, constraint_jacobian);
+
+    for (size_t k = 0; k < batch_size; ++k)
+    {
+      const Eigen::VectorXd tau = 4. * Eigen::VectorXd::Random(model.nv) / dt;
+      const Eigen::VectorXd v_free = v0 + dt * aba(model, data, q0, v0, tau, Convention::WORLD);
+      gs.push_back(constraint_jacobian * v_free);
+
+      delassus_operators.push_back(DelassusOperatorDense(G));
+      delassus_operators.back().updateCompliance(Eigen::VectorXd::Zero(G.rows()));
+      constraint_models.push_back(constraint_models_ref);
+      constraint_datas.push_back(constraint_datas_ref);
+    }
+
+    settings.absolute_feasibility_tol = 1e-10;
+    settings.relative_feasibility_tol = 1e-12;
+    settings.absolute_complementarity_tol = 1e-10;
+    settings.relative_complementarity_tol = 1e-12;
+  }
+
+  Eigen::MatrixXd G;
+  std::vector<DelassusOperatorDense> delassus_operators;
+  std::vector<Eigen::VectorXd> gs;
+  std::vector<ConstraintModelVector> constraint_models;
+  std::vector<ConstraintDataVector> constraint_datas;
+  ADMMSolverSettings settings;
+};
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_solve_in_parallel)
+{
+  const size_t batch_size = 32;
+  const size_t num_threads = 4;
+  BoxProblems problems(batch_size);
+
+  // Reference solutions
+  std::vector<Eigen::VectorXd> impulses_ref;
+  std::size_t total_iterations_ref = 0;
+  double max_dual_feasibility_ref = 0.;
+  for (size_t k = 0; k < batch_size; ++k)
+  {
+    DelassusOperatorDense delassus(problems.G);
+    delassus.updateCompliance(Eigen::VectorXd::Zero(problems.G.rows()));
+    ADMMConstraintSolver solver;
+    ADMMSolverResult result;
+    BOOST_CHECK(solver.solve(
+      delassus, problems.gs[k], problems.constraint_models[k], problems.constraint_datas[k],
+      problems.settings, result));
+    impulses_ref.push_back(result.y);
+    total_iterations_ref += result.iterations;
+    max_dual_feasibility_ref = std::max(max_dual_feasibility_ref, result.dual_feasibility);
+  }
+
+  ADMMConstraintSolverPool pool(num_threads);
+  BOOST_CHECK(pool.size() == num_threads);
+
+  std::vector<ADMMSolverResult> results(batch_size);
+  const ADMMBatchSolverStats stats = solveConstraintProblemsInParallel(
+    num_threads, pool, problems.delassus_operators, problems.gs, problems.constraint_models,
+    problems.constraint_datas, problems.settings, results);
+
+  BOOST_CHECK(stats.num_problems == batch_size);
+  BOOST_CHECK(stats.allConverged());
+  BOOST_CHECK(stats.num_warmstarted == 0);
+  BOOST_CHECK(stats.total_iterations == total_iterations_ref);
+  BOOST_CHECK(stats.max_dual_feasibility == max_dual_feasibility_ref);
+  for (size_t k = 0; k < batch_size; ++k)
+  {
+    BOOST_CHECK(results[k].isValid());
+    BOOST_CHECK(results[k].y.isApprox(impulses_ref[k]));
+  }
+
+  // Solving again the same problems: the previous solutions are already optimal.
+  SerialExecutor executor;
+  const ADMMBatchSolverStats stats_warmstart = solveConstraintProblemsInParallel(
+    executor, pool, problems.delassus_operators, problems.gs, problems.constraint_models,
+    problems.constraint_datas, problems.settings, results);
+
+  BOOST_CHECK(stats_warmstart.allConverged());
+  BOOST_CHECK(stats_warmstart.num_warmstarted == batch_size);
+  BOOST_CHECK(stats_warmstart.total_iterations < stats.total_iterations);
+  for (size_t k = 0; k < batch_size; ++k)
+    BOOST_CHECK(results[k].y.isApprox(impulses_ref[k], 1e-8));
+
+  // Without warm start, the solver starts from scratch.
+  ThreadPoolExecutor thread_pool(num_threads);
+  const ADMMBatchSolverStats stats_cold = solveConstraintProblemsInParallel(
+    thread_pool, pool, problems.delassus_operators, problems.gs, problems.constraint_models,
+    problems.constraint_datas, problems.settings, results, false);
+  BOOST_CHECK(stats_cold.num_warmstarted == 0);
+  BOOST_CHECK(stats_cold.total_iterations == total_iterations_ref);
+}
+
+BOOST_AUTO_TEST_CASE(test_invalid_arguments)
+{
+  const size_t batch_size = 4;
+  BoxProblems problems(batch_size);
+
+  ADMMConstraintSolverPool pool(2);
+  std::vector<ADMMSolverResult> results(batch_size - 1);
+  BOOST_CHECK_THROW(
+    solveConstraintProblemsInParallel(
+      2, pool, problems.delassus_operators, problems.gs, problems.constraint_models,
+      problems.constraint_datas, problems.settings, results),
+    std::invalid_argument);
+
+  results.resize(batch_size);
+  BOOST_CHECK_THROW(
+    solveConstraintProblemsInParallel(
+      3, pool, problems.delassus_operators, problems.gs, problems.constraint_models,
+      problems.constraint_datas, problems.settings, results),
+    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
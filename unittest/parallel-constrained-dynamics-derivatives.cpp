@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/algorithm/parallel/constrained-dynamics-derivatives.hpp"
+#include "pinocchio/algorithm/constrained-dynamics.hpp"
+#include "pinocchio/algorithm/constrained-dynamics-derivatives.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/multibody/sample-models.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_parallel_constraint_dynamics_derivatives)
+{
+  pinocchio::Model model;
+  buildModels::humanoidRandom(model, true);
+  Data data_ref(model);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+
+  const Eigen::Index batch_size = 32;
+  const Eigen::Index nv = model.nv;
+  const size_t num_threads = (size_t)omp_get_max_threads();
+
+  const Model::JointIndex RF_id = model.getJointId("rleg6_joint");
+  const Model::JointIndex LF_id = model.getJointId("lleg6_joint");
+
+  std::vector<RigidConstraintModel> constraint_models;
+  RigidConstraintModel ci_LF(CONTACT_6D, model, LF_id, LOCAL);
+  ci_LF.joint1_placement.setRandom();
+  RigidConstraintModel ci_RF(CONTACT_3D, model, RF_id, LOCAL);
+  ci_RF.joint1_placement.setRandom();
+  constraint_models.push_back(ci_LF);
+  constraint_models.push_back(ci_RF);
+
+  Eigen::Index nc = 0;
+  for (const RigidConstraintModel & cmodel : constraint_models)
+    nc += cmodel.residualSize();
+
+  Eigen::MatrixXd q(model.nq, batch_size);
+  Eigen::MatrixXd v(nv, batch_size);
+  Eigen::MatrixXd tau(nv, batch_size);
+
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    q.col(i) = randomConfiguration(model);
+    v.col(i) = Eigen::VectorXd::Random(nv);
+    tau.col(i) = Eigen::VectorXd::Random(nv);
+  }
+
+  const ProximalSettings prox_settings(1e-12, 0., 1);
+
+  std::vector<RigidConstraintData> constraint_datas_ref = createData(constraint_models);
+  initConstraintDynamics(model, data_ref, constraint_models, constraint_datas_ref);
+
+  Eigen::MatrixXd ddq_dq_ref(nv, nv * batch_size), ddq_dv_ref(nv, nv * batch_size),
+    ddq_dtau_ref(nv, nv * batch_size);
+  Eigen::MatrixXd dlambda_dq_ref(nc, nv * batch_size), dlambda_dv_ref(nc, nv * batch_size),
+    dlambda_dtau_ref(nc, nv * batch_size);
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    ProximalSettings settings(prox_settings);
+    constraintDynamics(
+      model, data_ref, q.col(i), v.col(i), tau.col(i), constraint_models, constraint_datas_ref,
+      settings);
+    computeConstraintDynamicsDerivatives(
+      model, data_ref, constraint_models, constraint_datas_ref, settings);
+    ddq_dq_ref.middleCols(i * nv, nv) = data_ref.ddq_dq;
+    ddq_dv_ref.middleCols(i * nv, nv) = data_ref.ddq_dv;
+    ddq_dtau_ref.middleCols(i * nv, nv) = data_ref.ddq_dtau;
+    dlambda_dq_ref.middleCols(i * nv, nv) = data_ref.dlambda_dq;
+    dlambda_dv_ref.middleCols(i * nv, nv) = data_ref.dlambda_dv;
+    dlambda_dtau_ref.middleCols(i * nv, nv) = data_ref.dlambda_dtau;
+  }
+
+  ModelPool pool(model);
+  std::vector<std::vector<RigidConstraintData>> constraint_datas(pool.size());
+  for (size_t k = 0; k < pool.size(); ++k)
+  {
+    constraint_datas[k] = createData(constraint_models);
+    initConstraintDynamics(model, pool.getData(k), constraint_models, constraint_datas[k]);
+  }
+
+  Eigen::MatrixXd ddq_dq(nv, nv * batch_size), ddq_dv(nv, nv * batch_size),
+    ddq_dtau(nv, nv * batch_size);
+  Eigen::MatrixXd dlambda_dq(nc, nv * batch_size), dlambda_dv(nc, nv * batch_size),
+    dlambda_dtau(nc, nv * batch_size);
+
+  computeConstraintDynamicsDerivativesInParallel(
+    num_threads, pool, q, v, tau, constraint_models, constraint_datas, prox_settings, ddq_dq,
+    ddq_dv, ddq_dtau, dlambda_dq, dlambda_dv, dlambda_dtau);
+  BOOST_CHECK(ddq_dq.isApprox(ddq_dq_ref));
+  BOOST_CHECK(ddq_dv.isApprox(ddq_dv_ref));
+  BOOST_CHECK(ddq_dtau.isApprox(ddq_dtau_ref));
+  BOOST_CHECK(dlambda_dq.isApprox(dlambda_dq_ref));
+  BOOST_CHECK(dlambda_dv.isApprox(dlambda_dv_ref));
+  BOOST_CHECK(dlambda_dtau.isApprox(dlambda_dtau_ref));
+
+  ThreadPoolExecutor thread_pool_executor(num_threads);
+  ddq_dq.setZero();
+  dlambda_dq.setZero();
+  computeConstraintDynamicsDerivativesInParallel(
+    thread_pool_executor, pool, q, v, tau, constraint_models, constraint_datas, prox_settings,
+    ddq_dq, ddq_dv, ddq_dtau, dlambda_dq, dlambda_dv, dlambda_dtau);
+  BOOST_CHECK(ddq_dq.isApprox(ddq_dq_ref));
+  BOOST_CHECK(dlambda_dq.isApprox(dlambda_dq_ref));
+
+  // One vector of contact data per thread is required.
+  std::vector<std::vector<RigidConstraintData>> too_few_constraint_datas(
+    constraint_datas.begin(), constraint_datas.begin() + 1);
+  SerialExecutor serial_executor;
+  computeConstraintDynamicsDerivativesInParallel(
+    serial_executor, pool, q, v, tau, constraint_models, too_few_constraint_datas, prox_settings,
+    ddq_dq, ddq_dv, ddq_dtau, dlambda_dq, dlambda_dv, dlambda_dtau);
+  if (num_threads > 1)
+  {
+    BOOST_CHECK_THROW(
+      computeConstraintDynamicsDerivativesInParallel(
+        thread_pool_executor, pool, q, v, tau, constraint_models, too_few_constraint_datas,
+        prox_settings, ddq_dq, ddq_dv, ddq_dtau, dlambda_dq, dlambda_dv, dlambda_dtau),
+      std::invalid_argument);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,134 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/constraints.hpp"
+#include "pinocchio/multibody/sample-models.hpp"
+
+#include "pinocchio/algorithm/kinematics.hpp"
+#include "pinocchio/algorithm/jacobian.hpp"
+#include "pinocchio/algorithm/crba.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/algorithm/constraint-cholesky.hpp"
+#include "pinocchio/algorithm/parallel/constraint-cholesky.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_parallel_constraint_cholesky)
+{
+  pinocchio::Model model;
+  buildModels::humanoidRandom(model, true);
+  Data data(model);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+  const Eigen::VectorXd q = randomConfiguration(model);
+
+  const std::string RF = "rleg6_joint";
+  const std::string LF = "lleg6_joint";
+  const std::string RA = "rarm6_joint";
+  const std::string LA = "larm6_joint";
+
+  std::vector<RigidConstraintModel> constraint_models;
+  constraint_models.push_back(
+    RigidConstraintModel(CONTACT_6D, model, 0, model.getJointId(RF), LOCAL));
+  constraint_models.push_back(
+    RigidConstraintModel(CONTACT_3D, model, 0, model.getJointId(LF), LOCAL_WORLD_ALIGNED));
+  constraint_models.push_back(
+    RigidConstraintModel(CONTACT_6D, model, model.getJointId(RA), model.getJointId(LA), LOCAL));
+  constraint_models.push_back(
+    RigidConstraintModel(CONTACT_3D, model, 0, model.getJointId(LA), LOCAL));
+
+  std::vector<RigidConstraintData> constraint_datas;
+  for (const RigidConstraintModel & cmodel : constraint_models)
+    constraint_datas.push_back(RigidConstraintData(cmodel));
+
+  computeJointJacobians(model, data, q);
+  crba(model, data, q, Convention::WORLD);
+  calc(model, data, constraint_models, constraint_datas);
+
+  const double mu = 1e-4;
+  ConstraintCholeskyDecomposition chol_ref(model, data, constraint_models, constraint_datas);
+  chol_ref.updateDamping(mu);
+  chol_ref.compute(model, data, constraint_models, constraint_datas);
+
+  const auto check_decomposition = [&](const ConstraintCholeskyDecomposition & chol) {
+    BOOST_CHECK(!chol.isDirty());
+    BOOST_CHECK(chol.D.isApprox(chol_ref.D));
+    BOOST_CHECK(chol.Dinv.isApprox(chol_ref.Dinv));
+    BOOST_CHECK(chol.U.isApprox(chol_ref.U));
+    BOOST_CHECK(chol.matrix().isApprox(chol_ref.matrix()));
+    BOOST_CHECK(chol.getInverseOperationalSpaceInertiaMatrix().isApprox(
+      chol_ref.getInverseOperationalSpaceInertiaMatrix()));
+    BOOST_CHECK(chol.getOperationalSpaceInertiaMatrix().isApprox(
+      chol_ref.getOperationalSpaceInertiaMatrix()));
+  };
+
+  const size_t num_threads = (size_t)omp_get_max_threads();
+
+  {
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+    chol.updateDamping(mu);
+    computeConstraintCholeskyInParallel(
+      num_threads, model, data, constraint_models, constraint_datas, chol);
+    check_decomposition(chol);
+  }
+
+  {
+    SerialExecutor executor;
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+    chol.updateDamping(mu);
+    computeConstraintCholeskyInParallel(
+      executor, model, data, constraint_models, constraint_datas, chol);
+    check_decomposition(chol);
+  }
+
+  {
+    OpenMPExecutor executor(num_threads, true);
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+    chol.updateDamping(mu);
+    computeConstraintCholeskyInParallel(
+      executor, model, data, constraint_models, constraint_datas, chol);
+    check_decomposition(chol);
+  }
+
+  {
+    ThreadPoolExecutor executor(num_threads);
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+    chol.updateDamping(mu);
+    computeConstraintCholeskyInParallel(
+      executor, model, data, constraint_models, constraint_datas, chol);
+    check_decomposition(chol);
+
+    // The decomposition can be updated for a new configuration
+    const Eigen::VectorXd q_new = randomConfiguration(model);
+    computeJointJacobians(model, data, q_new);
+    crba(model, data, q_new, Convention::WORLD);
+    calc(model, data, constraint_models, constraint_datas);
+
+    chol_ref.compute(model, data, constraint_models, constraint_datas);
+    computeConstraintCholeskyInParallel(
+      executor, model, data, constraint_models, constraint_datas, chol);
+    check_decomposition(chol);
+  }
+
+  {
+    OpenMPExecutor executor(num_threads);
+    ConstraintCholeskyDecomposition chol(model, data, constraint_models, constraint_datas);
+    const std::vector<RigidConstraintModel> constraint_models_subset(
+      constraint_models.begin(), constraint_models.begin() + 2);
+    const std::vector<RigidConstraintData> constraint_datas_subset(
+      constraint_datas.begin(), constraint_datas.begin() + 2);
+    BOOST_CHECK_THROW(
+      computeConstraintCholeskyInParallel(
+        executor, model, data, constraint_models_subset, constraint_datas_subset, chol),
+      std::invalid_argument);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -18,6 +18,7 @@
 #include <coal/broadphase/broadphase_dynamic_AABB_tree.h>
 #include <coal/mesh_loader/loader.h>
 
+#include <algorithm>
 #include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
@@ -281,6 +282,127 @@ BOOST_AUTO_TEST_CASE(test_talos)
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_talos_pair_level)
+{
+  const std::string filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/talos_data/robots/talos_reduced.urdf");
+
+  pinocchio::Model model;
+  pinocchio::urdf::buildModel(filename, JointModelFreeFlyer(), model);
+  Data data(model);
+
+  const std::string package_path =
+    boost::filesystem::path(EXAMPLE_ROBOT_DATA_MODEL_DIR).parent_path().parent_path().string();
+  coal::MeshLoaderPtr mesh_loader = std::make_shared<coal::CachedMeshLoader>();
+  const std::string srdf_filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/talos_data/srdf/talos.srdf");
+  std::vector<std::string> package_paths(1, package_path);
+  pinocchio::GeometryModel geometry_model;
+  pinocchio::urdf::buildGeom(
+    model, filename, COLLISION, geometry_model, package_paths, mesh_loader);
+
+  geometry_model.addAllCollisionPairs();
+  pinocchio::srdf::removeCollisionPairs(model, geometry_model, srdf_filename, false);
+
+  GeometryData geometry_data_ref(geometry_model), geometry_data(geometry_model);
+  const size_t num_pairs = geometry_model.collisionPairs.size();
+  const size_t num_thread = (size_t)omp_get_max_threads();
+  ThreadPoolExecutor executor(num_thread);
+
+  const Eigen::VectorXd qmax = Eigen::VectorXd::Ones(model.nq);
+  size_t num_colliding = 0;
+  for (int k = 0; k < 20; ++k)
+  {
+    const Eigen::VectorXd q = randomConfiguration(model, -qmax, qmax);
+    updateGeometryPlacements(model, data, geometry_model, geometry_data_ref, q);
+    geometry_data.oMg = geometry_data_ref.oMg;
+
+    // All the pairs are evaluated
+    const bool res_ref = computeCollisions(geometry_model, geometry_data_ref, false);
+    if (res_ref)
+      ++num_colliding;
+
+    const bool res = computeCollisionsInParallel(num_thread, geometry_model, geometry_data);
+    BOOST_CHECK(res == res_ref);
+    const bool res_executor = computeCollisionsInParallel(executor, geometry_model, geometry_data);
+    BOOST_CHECK(res_executor == res_ref);
+    if (res_ref)
+      BOOST_CHECK(geometry_data.collisionPairIndex == geometry_data_ref.collisionPairIndex);
+    for (size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+      BOOST_CHECK(
+        geometry_data.collisionResults[cp_index].isCollision()
+        == geometry_data_ref.collisionResults[cp_index].isCollision());
+
+    // Stop at the first colliding pair
+    const bool res_stop =
+      computeCollisionsInParallel(executor, geometry_model, geometry_data, true);
+    BOOST_CHECK(res_stop == res_ref);
+    if (res_ref)
+    {
+      const size_t first_collision = geometry_data_ref.collisionPairIndex;
+      BOOST_CHECK(geometry_data.collisionPairIndex == first_collision);
+      for (size_t cp_index = 0; cp_index < num_pairs; ++cp_index)
+        BOOST_CHECK(
+          geometry_data.collisionResults[cp_index].isCollision()
+          == (cp_index <= first_collision
+              && geometry_data_ref.collisionResults[cp_index].isCollision()));
+    }
+  }
+  BOOST_CHECK(num_colliding > 0);
+}
+
+BOOST_AUTO_TEST_CASE(test_talos_distances_derivatives)
+{
+  const std::string filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/talos_data/robots/talos_reduced.urdf");
+
+  pinocchio::Model model;
+  pinocchio::urdf::buildModel(filename, JointModelFreeFlyer(), model);
+  Data data_ref(model), data(model);
+
+  const std::string package_path =
+    boost::filesystem::path(EXAMPLE_ROBOT_DATA_MODEL_DIR).parent_path().parent_path().string();
+  coal::MeshLoaderPtr mesh_loader = std::make_shared<coal::CachedMeshLoader>();
+  const std::string srdf_filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/talos_data/srdf/talos.srdf");
+  std::vector<std::string> package_paths(1, package_path);
+  pinocchio::GeometryModel geometry_model;
+  pinocchio::urdf::buildGeom(
+    model, filename, COLLISION, geometry_model, package_paths, mesh_loader);
+
+  geometry_model.addAllCollisionPairs();
+  pinocchio::srdf::removeCollisionPairs(model, geometry_model, srdf_filename, false);
+
+  GeometryData geometry_data_ref(geometry_model), geometry_data(geometry_model);
+  const Eigen::DenseIndex num_pairs = Eigen::DenseIndex(geometry_model.collisionPairs.size());
+  const size_t num_thread = (size_t)omp_get_max_threads();
+  ThreadPoolExecutor executor(num_thread);
+
+  Eigen::MatrixXd distance_jacobian_ref(num_pairs, model.nv);
+  Eigen::MatrixXd distance_jacobian(num_pairs, model.nv);
+  const Eigen::VectorXd qmax = Eigen::VectorXd::Ones(model.nq);
+  for (int k = 0; k < 10; ++k)
+  {
+    const Eigen::VectorXd q = randomConfiguration(model, -qmax, qmax);
+    const size_t min_index_ref = computeDistancesDerivatives(
+      model, data_ref, geometry_model, geometry_data_ref, q, distance_jacobian_ref);
+
+    distance_jacobian.setRandom();
+    BOOST_CHECK(
+      computeDistancesDerivativesInParallel(
+        num_thread, model, data, geometry_model, geometry_data, q, distance_jacobian)
+      == min_index_ref);
+    BOOST_CHECK(distance_jacobian.isApprox(distance_jacobian_ref));
+
+    distance_jacobian.setRandom();
+    BOOST_CHECK(
+      computeDistancesDerivativesInParallel(
+        executor, model, data, geometry_model, geometry_data, q, distance_jacobian)
+      == min_index_ref);
+    BOOST_CHECK(distance_jacobian.isApprox(distance_jacobian_ref));
+  }
+}
+
 BOOST_AUTO_TEST_CASE(test_pool_talos_memory)
 {
   const std::string filename =
@@ -401,6 +523,57 @@ BOOST_AUTO_TEST_CASE(test_pool_talos)
       if (res4[k])
         BOOST_CHECK(res_ref[k]);
     }
+
+    // Stream of configurations
+    const auto configuration_generator = [&](const Eigen::Index i, Eigen::VectorXd & q_i) {
+      q_i = q.col(i);
+    };
+
+    // The callback is called concurrently: the checks are performed afterwards.
+    VectorXb res_stream(batch_size), res_evaluated(batch_size), q_streamed(batch_size);
+    res_stream.fill(false);
+    res_evaluated.fill(false);
+    q_streamed.fill(false);
+    const auto result_callback = [&](
+                                   const Eigen::Index i, const Eigen::VectorXd & q_i,
+                                   const bool is_colliding) {
+      q_streamed[i] = q_i == q.col(i);
+      res_stream[i] = is_colliding;
+      res_evaluated[i] = true;
+    };
+
+    ThreadPoolExecutor executor(num_thread);
+    const bool is_colliding = computeCollisionsInParallel(
+      executor, broadphase_manager_pool, batch_size, configuration_generator, result_callback,
+      true, false);
+    BOOST_CHECK(is_colliding);
+    BOOST_CHECK(res_evaluated.all());
+    BOOST_CHECK(q_streamed.all());
+    BOOST_CHECK(res_stream == res_ref);
+
+    // Early cancellation of the batch
+    res_stream.fill(false);
+    res_evaluated.fill(false);
+    const bool is_colliding_batch = computeCollisionsInParallel(
+      num_thread, broadphase_manager_pool, batch_size, configuration_generator, result_callback);
+    BOOST_CHECK(is_colliding_batch);
+    BOOST_CHECK(res_stream.any());
+    for (Eigen::Index k = 0; k < batch_size; ++k)
+    {
+      if (res_evaluated[k])
+        BOOST_CHECK(res_stream[k] == res_ref[k]);
+    }
+
+    // Collision-free stream
+    const Eigen::Index first_free = Eigen::Index(
+      std::find(res_ref.data(), res_ref.data() + batch_size, false) - res_ref.data());
+    BOOST_REQUIRE(first_free < batch_size);
+    SerialExecutor serial_executor;
+    const bool is_colliding_free = computeCollisionsInParallel(
+      serial_executor, broadphase_manager_pool, 4,
+      [&](const Eigen::Index, Eigen::VectorXd & q_i) { q_i = q.col(first_free); },
+      [&](const Eigen::Index, const Eigen::VectorXd &, const bool res) { BOOST_CHECK(!res); });
+    BOOST_CHECK(!is_colliding_free);
   }
 
   {
@@ -0,0 +1,245 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/algorithm/constraint-cholesky.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/constraints.hpp"
+#include "pinocchio/algorithm/solvers/pgs-solver.hpp"
+#include "pinocchio/algorithm/parallel/pgs-solver.hpp"
+#include "pinocchio/algorithm/aba.hpp"
+#include "pinocchio/algorithm/crba.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+typedef PointContactConstraintModel ConstraintModel;
+typedef ConstraintModel::ConstraintData ConstraintData;
+
+void buildStackOfCubesModel(
+  const std::size_t n_cubes,
+  ::pinocchio::Model & model,
+  std::vector<ConstraintModel> & constraint_models,
+  Eigen::VectorXd & q0)
+{
+  const SE3::Vector3 box_dims = SE3::Vector3::Ones();
+
+  for (std::size_t i = 0; i < n_cubes; i++)
+  {
+    const double box_mass = 1e-3 * double(i + 1);
+    const Inertia box_inertia = Inertia::FromBox(box_mass, box_dims[0], box_dims[1], box_dims[2]);
+    JointIndex joint_id =
+      model.addJoint(0, JointModelFreeFlyer(), SE3::Identity(), "free_flyer_" + std::to_string(i));
+    model.appendBodyToJoint(joint_id, box_inertia);
+  }
+
+  const double friction_value = 0.4;
+  for (std::size_t i = 0; i < n_cubes; i++)
+  {
+    const SE3 local_placement_box_1(
+      SE3::Matrix3::Identity(), 0.5 * SE3::Vector3(box_dims[0], box_dims[1], box_dims[2]));
+    const SE3 local_placement_box_2(
+      SE3::Matrix3::Identity(), 0.5 * SE3::Vector3(box_dims[0], box_dims[1], -box_dims[2]));
+    SE3::Matrix3 rot = SE3::Matrix3::Identity();
+    for (int j = 0; j < 4; ++j)
+    {
+      const SE3 local_placement_1(
+        SE3::Matrix3::Identity(), rot * local_placement_box_1.translation());
+      const SE3 local_placement_2(
+        SE3::Matrix3::Identity(), rot * local_placement_box_2.translation());
+      ConstraintModel cm(
+        model, (JointIndex)i, local_placement_1, (JointIndex)i + 1, local_placement_2);
+      cm.setFriction(friction_value);
+      constraint_models.push_back(cm);
+      rot = Eigen::AngleAxisd(M_PI / 2, Eigen::Vector3d::UnitZ()).toRotationMatrix() * rot;
+    }
+  }
+
+  q0 = neutral(model);
+  for (std::size_t i = 0; i < n_cubes; i++)
+    q0[Eigen::Index(7 * i + 2)] = double(i) * box_dims[2] + box_dims[2] / 2;
+}
+
+struct StackOfCubesProblem
+{
+  explicit StackOfCubesProblem(const std::size_t n_cubes)
+  {
+    Eigen::VectorXd q0;
+    buildStackOfCubesModel(n_cubes, model, constraint_models, q0);
+    data = Data(model);
+    for (const auto & cm : constraint_models)
+      constraint_datas.push_back(cm.createData());
+
+    const Eigen::VectorXd v0 = Eigen::VectorXd::Zero(model.nv);
+    const Eigen::VectorXd tau0 = Eigen::VectorXd::Zero(model.nv);
+    const double dt = 1e-3;
+    const Eigen::VectorXd v_free = v0 + dt * aba(model, data, q0, v0, tau0, Convention::WORLD);
+    data.q_in = q0;
+    calc(model, data, constraint_models, constraint_datas);
+
+    crba(model, data, q0, Convention::WORLD);
+    chol = ConstraintCholeskyDecomposition(model, data, constraint_models, constraint_datas);
+    chol.compute(model, data, constraint_models, constraint_datas, 1e-10);
+
+    const Eigen::Index constraint_size = getTotalConstraintResidualSize(constraint_models);
+    Eigen::MatrixXd constraint_jacobian = Eigen::MatrixXd::Zero(constraint_size, model.nv);
+    getConstraintsJacobian(model, data, constraint_models, constraint_datas, constraint_jacobian);
+    g = constraint_jacobian * v_free;
+
+    settings.max_iterations = 100000;
+    settings.absolute_feasibility_tol = 1e-10;
+    settings.relative_feasibility_tol = 1e-12;
+    settings.absolute_complementarity_tol = 1e-10;
+    settings.relative_complementarity_tol = 1e-12;
+  }
+
+  Model model;
+  Data data;
+  std::vector<ConstraintModel> constraint_models;
+  std::vector<ConstraintData> constraint_datas;
+  ConstraintCholeskyDecomposition chol;
+  Eigen::VectorXd g;
+  PGSSolverSettings settings;
+};
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_constraint_graph_coloring)
+{
+  const std::size_t n_cubes = 5;
+  StackOfCubesProblem problem(n_cubes);
+
+  std::vector<std::size_t> constraint_colors;
+  const std::size_t num_colors = computeConstraintGraphColoring(
+    problem.model, problem.data, problem.constraint_models, problem.constraint_datas,
+    constraint_colors);
+
+  // The 4 contacts between two cubes are coupled together and with the contacts of the
+  // neighboring cubes, but not with the contacts located two levels above or below.
+  BOOST_CHECK(num_colors == 8);
+  BOOST_CHECK(constraint_colors.size() == problem.constraint_models.size());
+  for (std::size_t i = 0; i < n_cubes; ++i)
+  {
+    for (std::size_t j = 0; j < 4; ++j)
+      BOOST_CHECK(constraint_colors[4 * i + j] == 4 * (i % 2) + j);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_parallel_pgs_solver)
+{
+  const std::size_t n_cubes = 6;
+  StackOfCubesProblem problem(n_cubes);
+  auto G_expression = problem.chol.getDelassusOperatorCholeskyExpression();
+
+  PGSConstraintSolver pgs_solver_ref;
+  PGSSolverResult pgs_result_ref;
+  const bool has_converged_ref = pgs_solver_ref.solve(
+    G_expression, problem.g, problem.constraint_models, problem.constraint_datas,
+    problem.settings, pgs_result_ref);
+  BOOST_CHECK(has_converged_ref);
+  Eigen::VectorXd impulses_ref(problem.g.size()), velocities_ref(problem.g.size());
+  pgs_result_ref.retrieveConstraintImpulses(impulses_ref);
+  pgs_result_ref.retrieveConstraintVelocities(velocities_ref);
+
+  std::vector<std::size_t> constraint_colors;
+  computeConstraintGraphColoring(
+    problem.model, problem.data, problem.constraint_models, problem.constraint_datas,
+    constraint_colors);
+
+  // The total contact force supporting each cube does not depend on the sweep order.
+  const auto check_result = [&](const bool has_converged, const PGSSolverResult & pgs_result) {
+    BOOST_CHECK(has_converged);
+    Eigen::VectorXd impulses(problem.g.size()), velocities(problem.g.size());
+    pgs_result.retrieveConstraintImpulses(impulses);
+    pgs_result.retrieveConstraintVelocities(velocities);
+    BOOST_CHECK(velocities.isZero(2e-6));
+    for (std::size_t i = 0; i < n_cubes; ++i)
+    {
+      Eigen::Vector3d f_tot = Eigen::Vector3d::Zero(), f_tot_ref = Eigen::Vector3d::Zero();
+      for (Eigen::Index k = 0; k < 4; ++k)
+      {
+        f_tot += impulses.segment<3>(Eigen::Index(12 * i) + 3 * k);
+        f_tot_ref += impulses_ref.segment<3>(Eigen::Index(12 * i) + 3 * k);
+      }
+      BOOST_CHECK(f_tot.isApprox(f_tot_ref, 1e-3));
+    }
+  };
+
+  const size_t num_threads = (size_t)omp_get_max_threads();
+
+  {
+    PGSConstraintSolver pgs_solver;
+    PGSSolverResult pgs_result;
+    const bool has_converged = solveConstraintProblemInParallel(
+      num_threads, pgs_solver, G_expression, problem.g, problem.constraint_models,
+      problem.constraint_datas, constraint_colors, problem.settings, pgs_result);
+    check_result(has_converged, pgs_result);
+    BOOST_CHECK(pgs_solver.isValid());
+  }
+
+  {
+    SerialExecutor executor;
+    PGSConstraintSolver pgs_solver;
+    PGSSolverResult pgs_result;
+    const bool has_converged = solveConstraintProblemInParallel(
+      executor, pgs_solver, G_expression, problem.g, problem.constraint_models,
+      problem.constraint_datas, constraint_colors, problem.settings, pgs_result);
+    check_result(has_converged, pgs_result);
+  }
+
+  {
+    ThreadPoolExecutor executor(num_threads);
+    PGSConstraintSolver pgs_solver;
+    PGSSolverResult pgs_result;
+    const bool has_converged = solveConstraintProblemInParallel(
+      executor, pgs_solver, G_expression, problem.g, problem.constraint_models,
+      problem.constraint_datas, constraint_colors, problem.settings, pgs_result);
+    check_result(has_converged, pgs_result);
+
+    // Warm start from the previous solution
+    Eigen::VectorXd impulses(problem.g.size());
+    pgs_result.retrieveConstraintImpulses(impulses);
+    pgs_result.setConstraintImpulseGuess(impulses);
+    const bool has_converged_warm_start = solveConstraintProblemInParallel(
+      executor, pgs_solver, G_expression, problem.g, problem.constraint_models,
+      problem.constraint_datas, constraint_colors, problem.settings, pgs_result);
+    check_result(has_converged_warm_start, pgs_result);
+  }
+
+  // With one color per constraint, the sweep matches the sequential one.
+  {
+    std::vector<std::size_t> sequential_colors(problem.constraint_models.size());
+    for (std::size_t k = 0; k < sequential_colors.size(); ++k)
+      sequential_colors[k] = k;
+
+    OpenMPExecutor executor(num_threads, true);
+    PGSConstraintSolver pgs_solver;
+    PGSSolverResult pgs_result;
+    const bool has_converged = solveConstraintProblemInParallel(
+      executor, pgs_solver, G_expression, problem.g, problem.constraint_models,
+      problem.constraint_datas, sequential_colors, problem.settings, pgs_result);
+    BOOST_CHECK(has_converged);
+    BOOST_CHECK(pgs_result.iterations == pgs_result_ref.iterations);
+
+    Eigen::VectorXd impulses(problem.g.size());
+    pgs_result.retrieveConstraintImpulses(impulses);
+    BOOST_CHECK(impulses.isApprox(impulses_ref));
+  }
+
+  {
+    OpenMPExecutor executor(num_threads);
+    PGSConstraintSolver pgs_solver;
+    PGSSolverResult pgs_result;
+    const std::vector<std::size_t> wrong_colors(
+      constraint_colors.begin() + 1, constraint_colors.end());
+    BOOST_CHECK_THROW(
+      solveConstraintProblemInParallel(
+        executor, pgs_solver, G_expression, problem.g, problem.constraint_models,
+        problem.constraint_datas, wrong_colors, problem.settings, pgs_result),
+      std::invalid_argument);
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,80 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/algorithm/parallel/rnea-derivatives.hpp"
+#include "pinocchio/algorithm/rnea-derivatives.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/multibody/sample-models.hpp"
+
+#include <boost/test/unit_test.hpp>
+#include <boost/utility/binary.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_parallel_rnea_derivatives)
+{
+  pinocchio::Model model;
+  buildModels::humanoidRandom(model);
+  Data data_ref(model);
+
+  model.lowerPositionLimit.head<3>().fill(-1.);
+  model.upperPositionLimit.head<3>().fill(1.);
+
+  const Eigen::Index batch_size = 32;
+  const Eigen::Index nv = model.nv;
+  const size_t num_threads = (size_t)omp_get_max_threads();
+
+  Eigen::MatrixXd q(model.nq, batch_size);
+  Eigen::MatrixXd v(nv, batch_size);
+  Eigen::MatrixXd a(nv, batch_size);
+
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    q.col(i) = randomConfiguration(model);
+    v.col(i) = Eigen::VectorXd::Random(nv);
+    a.col(i) = Eigen::VectorXd::Random(nv);
+  }
+
+  Eigen::MatrixXd dtau_dq_ref(nv, nv * batch_size), dtau_dv_ref(nv, nv * batch_size),
+    dtau_da_ref(nv, nv * batch_size);
+  for (Eigen::Index i = 0; i < batch_size; ++i)
+  {
+    Eigen::MatrixXd dtau_dq(Eigen::MatrixXd::Zero(nv, nv)), dtau_dv(Eigen::MatrixXd::Zero(nv, nv)),
+      dtau_da(Eigen::MatrixXd::Zero(nv, nv));
+    computeRNEADerivatives(
+      model, data_ref, q.col(i), v.col(i), a.col(i), dtau_dq, dtau_dv, dtau_da);
+    dtau_dq_ref.middleCols(i * nv, nv) = dtau_dq;
+    dtau_dv_ref.middleCols(i * nv, nv) = dtau_dv;
+    dtau_da_ref.middleCols(i * nv, nv) = dtau_da;
+  }
+
+  ModelPool pool(model);
+  Eigen::MatrixXd dtau_dq(nv, nv * batch_size), dtau_dv(nv, nv * batch_size),
+    dtau_da(nv, nv * batch_size);
+
+  computeRNEADerivativesInParallel(num_threads, pool, q, v, a, dtau_dq, dtau_dv, dtau_da);
+  BOOST_CHECK(dtau_dq.isApprox(dtau_dq_ref));
+  BOOST_CHECK(dtau_dv.isApprox(dtau_dv_ref));
+  BOOST_CHECK(dtau_da.isApprox(dtau_da_ref));
+
+  ThreadPoolExecutor thread_pool_executor(num_threads);
+  dtau_dq.setRandom();
+  dtau_dv.setRandom();
+  dtau_da.setRandom();
+  computeRNEADerivativesInParallel(
+    thread_pool_executor, pool, q, v, a, dtau_dq, dtau_dv, dtau_da);
+  BOOST_CHECK(dtau_dq.isApprox(dtau_dq_ref));
+  BOOST_CHECK(dtau_dv.isApprox(dtau_dv_ref));
+  BOOST_CHECK(dtau_da.isApprox(dtau_da_ref));
+
+  Eigen::MatrixXd wrong_size(nv, nv * (batch_size - 1));
+  BOOST_CHECK_THROW(
+    computeRNEADerivativesInParallel(
+      thread_pool_executor, pool, q, v, a, wrong_size, dtau_dv, dtau_da),
+    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -49,6 +49,16 @@ BOOST_AUTO_TEST_CASE(test_parallel_rnea)
   }
 
   BOOST_CHECK(tau == tau_ref);
+
+  OpenMPExecutor openmp_executor(num_thread, true);
+  tau.setZero();
+  rneaInParallel(openmp_executor, pool, q, v, a, tau);
+  BOOST_CHECK(tau == tau_ref);
+
+  ThreadPoolExecutor thread_pool_executor(num_thread);
+  tau.setZero();
+  rneaInParallel(thread_pool_executor, pool, q, v, a, tau);
+  BOOST_CHECK(tau == tau_ref);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
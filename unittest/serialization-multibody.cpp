@@ -47,6 +47,31 @@ BOOST_AUTO_TEST_CASE(test_collision_pair)
   generic_test(collision_pair, TEST_SERIALIZATION_FOLDER "/CollisionPair", "CollisionPair");
 }
 
+BOOST_AUTO_TEST_CASE(test_collision_pair_pruning_cache)
+{
+  using namespace pinocchio;
+
+  CollisionPairPruningCache cache;
+  cache.lowerPositionLimit = Eigen::VectorXd::Constant(2, -1.);
+  cache.upperPositionLimit = Eigen::VectorXd::Constant(2, 1.);
+  cache.geometry_names = {"geom_1", "geom_2", "geom_3"};
+  cache.security_margin = 1e-3;
+  cache.pruned_pairs.push_back(CollisionPair(0, 2));
+  cache.pruned_pairs.push_back(CollisionPair(1, 2));
+  generic_test(
+    cache, TEST_SERIALIZATION_FOLDER "/CollisionPairPruningCache", "CollisionPairPruningCache");
+}
+
+BOOST_AUTO_TEST_CASE(test_signed_distance_field)
+{
+  using namespace pinocchio;
+
+  SignedDistanceField field(
+    Eigen::Vector3d(-1., -0.5, 0.), 0.25, SignedDistanceField::Index3(3, 2, 4));
+  field.values.setRandom();
+  generic_test(field, TEST_SERIALIZATION_FOLDER "/SignedDistanceField", "SignedDistanceField");
+}
+
 BOOST_AUTO_TEST_CASE(test_model_item)
 {
   using namespace pinocchio;
@@ -0,0 +1,87 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/collision/collision.hpp"
+#include "pinocchio/collision/distance.hpp"
+#include "pinocchio/collision/signed-distance-field.hpp"
+
+#include <coal/shape/geometric_shapes.h>
+
+#include <cmath>
+#include <memory>
+#include <boost/test/unit_test.hpp>
+
+using namespace pinocchio;
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_evaluate)
+{
+  // Field of the plane z = 0, extrapolated outside of the grid
+  SignedDistanceField field(
+    SignedDistanceField::Vector3(-1., -1., -1.), 0.5, SignedDistanceField::Index3(5, 5, 5));
+  for (Eigen::Index k = 0; k < 5; ++k)
+    for (Eigen::Index j = 0; j < 5; ++j)
+      for (Eigen::Index i = 0; i < 5; ++i)
+        field.value(i, j, k) = field.nodePosition(i, j, k)[2];
+
+  SignedDistanceField::Vector3 gradient;
+  BOOST_CHECK_CLOSE(field.evaluate(Eigen::Vector3d(0.3, -0.2, 0.4), gradient), 0.4, 1e-8);
+  BOOST_CHECK(gradient.isApprox(Eigen::Vector3d::UnitZ()));
+
+  BOOST_CHECK_CLOSE(field.evaluate(Eigen::Vector3d(0., 0., 3.), gradient), 3., 1e-8);
+  BOOST_CHECK(gradient.isApprox(Eigen::Vector3d::UnitZ()));
+}
+
+BOOST_AUTO_TEST_CASE(test_distance_and_collision)
+{
+  const double resolution = 0.05;
+  std::shared_ptr<coal::Box> box(new coal::Box(1., 2., 0.5));
+
+  GeometryModel geom_model, geom_model_field;
+  const GeomIndex box_id = geom_model.addGeometryObject(
+    GeometryObject("box", 0, SE3(SE3::Matrix3::Identity(), SE3::Vector3(0.1, 0., 0.)), box));
+  const GeomIndex sphere_id = geom_model.addGeometryObject(
+    GeometryObject("sphere", 0, SE3::Identity(), std::make_shared<coal::Sphere>(0.1)));
+  const GeomIndex capsule_id = geom_model.addGeometryObject(
+    GeometryObject("capsule", 0, SE3::Identity(), std::make_shared<coal::Capsule>(0.05, 0.4)));
+  geom_model.addCollisionPair(CollisionPair(box_id, sphere_id));
+  geom_model.addCollisionPair(CollisionPair(capsule_id, box_id));
+
+  geom_model_field = geom_model;
+  geom_model_field.geometryObjects[box_id].distanceField =
+    std::make_shared<SignedDistanceField>(computeSignedDistanceField(*box, resolution, 1.5));
+  BOOST_CHECK(geom_model_field.geometryObjects[box_id] != geom_model.geometryObjects[box_id]);
+
+  // The sphere and the capsule stay within the grid
+  GeometryData geom_data(geom_model), geom_data_field(geom_model_field);
+  for (int i = 0; i < 100; ++i)
+  {
+    geom_data.oMg[box_id] = geom_model.geometryObjects[box_id].placement;
+    geom_data.oMg[sphere_id] = SE3::Random();
+    geom_data.oMg[capsule_id] = SE3::Random();
+    geom_data_field.oMg = geom_data.oMg;
+
+    for (PairIndex pair_id = 0; pair_id < geom_model.collisionPairs.size(); ++pair_id)
+    {
+      const coal::DistanceResult & distance_result =
+        computeDistance(geom_model, geom_data, pair_id);
+      const coal::DistanceResult & distance_result_field =
+        computeDistance(geom_model_field, geom_data_field, pair_id);
+      BOOST_CHECK_SMALL(
+        distance_result_field.min_distance - distance_result.min_distance, 2 * resolution);
+      if (pair_id == 0 && distance_result.min_distance > 2 * resolution)
+        BOOST_CHECK(
+          (distance_result_field.nearest_points[0] - distance_result.nearest_points[0]).norm()
+          < 4 * resolution);
+
+      const bool collision = computeCollision(geom_model_field, geom_data_field, pair_id);
+      BOOST_CHECK(collision == (distance_result_field.min_distance <= 0.));
+      if (std::fabs(distance_result.min_distance) > 2 * resolution)
+        BOOST_CHECK(collision == computeCollision(geom_model, geom_data, pair_id));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#include "pinocchio/multibody/sample-models.hpp"
+#include "pinocchio/algorithm/joint-configuration.hpp"
+#include "pinocchio/collision/collision.hpp"
+#include "pinocchio/collision/sphere-tree.hpp"
+
+#include <coal/shape/geometric_shapes.h>
+
+#include <boost/test/unit_test.hpp>
+
+using namespace pinocchio;
+
+namespace
+{
+  // Whether each level of the tree covers the point
+  bool covers(const SphereTree & tree, const Eigen::Vector3d & point)
+  {
+    for (std::size_t level = 0; level < tree.numLevels(); ++level)
+    {
+      const Eigen::VectorXd distances =
+        (tree.centers[level].colwise() - point).colwise().norm().transpose();
+      if (((distances - tree.radii[level]).array() > 0.).all())
+        return false;
+    }
+    return true;
+  }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(BOOST_TEST_MODULE)
+
+BOOST_AUTO_TEST_CASE(test_sphere_tree)
+{
+  const std::size_t num_levels = 4;
+
+  // All the cells of a box intersect it
+  const coal::Box box(0.4, 0.2, 0.6);
+  const SphereTree box_tree = computeSphereTree(box, num_levels);
+  BOOST_CHECK(box_tree.numLevels() == num_levels);
+  BOOST_CHECK(box_tree.children.size() == num_levels - 1);
+  for (std::size_t level = 0; level < num_levels; ++level)
+    BOOST_CHECK(box_tree.centers[level].cols() == Eigen::Index(1) << (3 * level));
+  BOOST_CHECK_CLOSE(box_tree.radii[0][0], 0.5 * Eigen::Vector3d(0.4, 0.2, 0.6).norm(), 1e-8);
+
+  // Only the cells close to a capsule are kept
+  const coal::Capsule capsule(0.1, 0.6);
+  const SphereTree capsule_tree = computeSphereTree(capsule, num_levels);
+  BOOST_CHECK(capsule_tree.centers.back().cols() < Eigen::Index(1) << (3 * (num_levels - 1)));
+  for (std::size_t level = 0; level + 1 < num_levels; ++level)
+  {
+    const SphereTree::IndexVector & children = capsule_tree.children[level];
+    BOOST_CHECK(children.size() == capsule_tree.centers[level].cols() + 1);
+    BOOST_CHECK(children[0] == 0);
+    BOOST_CHECK(children[children.size() - 1] == capsule_tree.centers[level + 1].cols());
+  }
+
+  // Each level covers the geometry
+  for (int i = 0; i < 1000; ++i)
+  {
+    const Eigen::Vector3d box_point =
+      Eigen::Vector3d::Random().cwiseProduct(Eigen::Vector3d(0.2, 0.1, 0.3));
+    BOOST_CHECK(covers(box_tree, box_point));
+
+    Eigen::Vector3d capsule_point = Eigen::Vector3d::Random();
+    capsule_point.head<2>() *= 0.1 / (capsule_point.head<2>().norm() + 1.);
+    capsule_point[2] *= 0.3;
+    BOOST_CHECK(covers(capsule_tree, capsule_point));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_collisions_with_sphere_trees)
+{
+  Model model;
+  buildModels::humanoid(model);
+  Data data(model);
+
+  GeometryModel geom_model;
+  buildModels::humanoidGeometries(model, geom_model);
+  geom_model.addAllCollisionPairs();
+  GeometryData geom_data(geom_model), geom_data_sphere_trees(geom_model);
+
+  const SphereTreeModel sphere_tree_model = buildSphereTreeModel(geom_model, 3);
+  SphereTreeData sphere_tree_data(sphere_tree_model);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    const Eigen::VectorXd q = randomConfiguration(model);
+
+    const bool res = computeCollisions(model, data, geom_model, geom_data, q);
+    BOOST_CHECK(
+      computeCollisionsWithSphereTrees(
+        model, data, geom_model, geom_data_sphere_trees, sphere_tree_model, sphere_tree_data, q)
+      == res);
+    for (std::size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+      BOOST_CHECK(
+        geom_data_sphere_trees.collisionResults[cp_index].isCollision()
+        == geom_data.collisionResults[cp_index].isCollision());
+
+    // The check without narrow phase is conservative
+    const bool conservative_res = computeCollisionsWithSphereTrees(
+      model, data, geom_model, geom_data_sphere_trees, sphere_tree_model, sphere_tree_data, q,
+      false, false);
+    BOOST_CHECK(conservative_res || !res);
+    for (std::size_t cp_index = 0; cp_index < geom_model.collisionPairs.size(); ++cp_index)
+    {
+      const CollisionPair & cp = geom_model.collisionPairs[cp_index];
+      if (geom_data.collisionResults[cp_index].isCollision())
+        BOOST_CHECK(computeSphereTreeCollision(
+          sphere_tree_model, sphere_tree_data, cp.first, cp.second,
+          geom_data.collisionRequests[cp_index].security_margin));
+    }
+  }
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -10,6 +10,7 @@
 
 #include <coal/broadphase/broadphase_dynamic_AABB_tree.h>
 
+#include <algorithm>
 #include <vector>
 #include <boost/filesystem.hpp>
 #include <boost/test/unit_test.hpp>
@@ -79,4 +80,79 @@ BOOST_AUTO_TEST_CASE(test_collisions)
   }
 }
 
+BOOST_AUTO_TEST_CASE(test_incremental_update)
+{
+  const std::string filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/romeo_description/urdf/romeo_small.urdf");
+  std::vector<std::string> packageDirs;
+  const std::string meshDir =
+    boost::filesystem::path(EXAMPLE_ROBOT_DATA_MODEL_DIR).parent_path().parent_path().string();
+  packageDirs.push_back(meshDir);
+  const std::string srdf_filename =
+    EXAMPLE_ROBOT_DATA_MODEL_DIR + std::string("/romeo_description/srdf/romeo.srdf");
+
+  Model model;
+  pinocchio::urdf::buildModel(filename, pinocchio::JointModelFreeFlyer(), model);
+  GeometryModel geom_model;
+  pinocchio::urdf::buildGeom(model, filename, pinocchio::COLLISION, geom_model, packageDirs);
+  geom_model.addAllCollisionPairs();
+  pinocchio::srdf::removeCollisionPairs(model, geom_model, srdf_filename, false);
+
+  Data data(model), data_broadphase(model);
+  GeometryData geom_data(geom_model), geom_data_broadphase(geom_model);
+
+  pinocchio::srdf::loadReferenceConfigurations(model, srdf_filename, false);
+  const Eigen::VectorXd q = model.referenceConfigurations["half_sitting"];
+
+  TreeBroadPhaseManagerTpl<coal::DynamicAABBTreeCollisionManager> broadphase_manager(
+    &model, &geom_model, &geom_data_broadphase);
+
+  // The first update refits all the managers
+  updateGeometryPlacements(model, data_broadphase, geom_model, geom_data_broadphase, q);
+  broadphase_manager.update(q);
+  const std::vector<bool> & dirty_joints = broadphase_manager.getDirtyJoints();
+  BOOST_CHECK(std::count(dirty_joints.begin(), dirty_joints.end(), true) == model.njoints);
+  BOOST_CHECK(broadphase_manager.check());
+
+  // Only the subtree of the moving joint is refit
+  const JointIndex arm_joint_id = model.getJointId("LShoulderPitch");
+  Eigen::VectorXd q_arm = q;
+  q_arm[model.joints[arm_joint_id].idx_q()] += 0.1;
+  updateGeometryPlacements(model, data_broadphase, geom_model, geom_data_broadphase, q_arm);
+  broadphase_manager.update(q_arm);
+  for (JointIndex joint_id = 0; joint_id < JointIndex(model.njoints); ++joint_id)
+  {
+    const bool is_in_subtree =
+      std::find(
+        model.subtrees[arm_joint_id].begin(), model.subtrees[arm_joint_id].end(), joint_id)
+      != model.subtrees[arm_joint_id].end();
+    BOOST_CHECK(dirty_joints[joint_id] == is_in_subtree);
+  }
+
+  // Nothing is refit when the configuration does not change
+  broadphase_manager.update(q_arm);
+  BOOST_CHECK(std::count(dirty_joints.begin(), dirty_joints.end(), true) == 0);
+
+  // The incremental updates of the arm give the same collisions as the complete computation
+  const int num_configs = 1000;
+  Eigen::VectorXd q_rand = q;
+  for (int i = 0; i < num_configs; ++i)
+  {
+    const Eigen::VectorXd q_sample = randomConfiguration(model);
+    for (const JointIndex joint_id : model.subtrees[arm_joint_id])
+    {
+      const int idx_q = model.idx_qs[joint_id];
+      const int nq = model.nqs[joint_id];
+      q_rand.segment(idx_q, nq) = q_sample.segment(idx_q, nq);
+    }
+
+    updateGeometryPlacements(model, data_broadphase, geom_model, geom_data_broadphase, q_rand);
+    broadphase_manager.update(q_rand);
+    BOOST_CHECK(broadphase_manager.check());
+    BOOST_CHECK(
+      computeCollisions(broadphase_manager, false)
+      == computeCollisions(model, data, geom_model, geom_data, q_rand));
+  }
+}
+
 BOOST_AUTO_TEST_SUITE_END()